@@ -0,0 +1,736 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "bench.hpp"
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "srsran/phy/modem/demod_soft.h"
+#include "srsran/phy/utils/bit.h"
+#include "srsran/phy/utils/vector.h"
+}
+
+#include "dectnrp/common/json/json_export.hpp"
+#include "dectnrp/common/randomgen.hpp"
+#include "dectnrp/constants.hpp"
+#include "dectnrp/mac/contact_list.hpp"
+#include "dectnrp/phy/dft/ofdm.hpp"
+#include "dectnrp/phy/fec/fec.hpp"
+#include "dectnrp/phy/harq/process_pool.hpp"
+#include "dectnrp/phy/phy_config.hpp"
+#include "dectnrp/phy/resample/resampler.hpp"
+#include "dectnrp/phy/resample/resampler_param.hpp"
+#include "dectnrp/phy/rx/rx_synced/channel_estimation/channel_lut.hpp"
+#include "dectnrp/phy/rx/rx_synced/demapper.hpp"
+#include "dectnrp/phy/rx/rx_synced/rx_synced_kernels.hpp"
+#include "dectnrp/phy/rx/rx_synced/rx_synced_param.hpp"
+#include "dectnrp/phy/rx/sync/autocorrelator_detection.hpp"
+#include "dectnrp/phy/rx/sync/sync_param.hpp"
+#include "dectnrp/phy/rx/sync/sync_report.hpp"
+#include "dectnrp/phy/tx/tx.hpp"
+#include "dectnrp/phy/tx/tx_descriptor.hpp"
+#include "dectnrp/radio/hw_simulator.hpp"
+#include "dectnrp/sections_part3/derivative/packet_sizes.hpp"
+#include "dectnrp/sections_part3/derivative/packet_sizes_lut.hpp"
+#include "dectnrp/sections_part3/fix/mod.hpp"
+#include "dectnrp/sections_part3/numerologies.hpp"
+#include "dectnrp/sections_part3/physical_resources.hpp"
+#include "dectnrp/sections_part3/radio_device_class.hpp"
+#include "dectnrp/sections_part3/stf.hpp"
+#include "dectnrp/simulation/hardware/noise.hpp"
+#include "dectnrp/simulation/vspace.hpp"
+
+namespace dectnrp::bench {
+
+/// all vectors allocated with srsRAN are freed once the benchmark is finished
+static std::vector<cf_t*> get_random_iq(common::randomgen_t& randomgen,
+                                        const uint32_t nof_antennas,
+                                        const uint32_t nof_samples,
+                                        const float std) {
+    std::vector<cf_t*> ret;
+    for (uint32_t ant_idx = 0; ant_idx < nof_antennas; ++ant_idx) {
+        ret.push_back(srsran_vec_cf_malloc(nof_samples));
+        for (uint32_t i = 0; i < nof_samples; ++i) {
+            ret.back()[i] = cf_t{randomgen.randn(0.0f, std), randomgen.randn(0.0f, std)};
+        }
+    }
+    return ret;
+}
+
+static void free_iq(std::vector<cf_t*>& iq) {
+    for (auto* ptr : iq) {
+        free(ptr);
+    }
+    iq.clear();
+}
+
+/// packet of maximum length within the limits of the radio device class with a specific MCS
+static sp3::packet_sizes_opt_t get_packet_sizes_mcs(const sp3::radio_device_class_t& rdc,
+                                                    const uint32_t mcs_index) {
+    const sp3::packet_sizes_def_t psdef = {.u = rdc.u_min,
+                                           .b = rdc.b_min,
+                                           .PacketLengthType = 0,
+                                           .PacketLength = rdc.PacketLength_min,
+                                           .tm_mode_index = 0,
+                                           .mcs_index = mcs_index,
+                                           .Z = rdc.Z_min};
+
+    return sp3::get_packet_sizes(psdef);
+}
+
+static void bench_resampler(bench_t& bench, const std::string& rdc_string) {
+    const auto rdc = sp3::get_radio_device_class(rdc_string);
+
+    common::randomgen_t randomgen;
+
+    // same number of samples as one full slot at the maximum DECT NR+ sample rate of the class
+    const uint32_t nof_samples =
+        rdc.u_min * rdc.b_min * constants::samp_rate_min_u_b / constants::slots_per_sec;
+
+    auto input_iq = get_random_iq(randomgen, rdc.N_TX_min, nof_samples, 0.1f);
+    const std::vector<const cf_t*> input(input_iq.begin(), input_iq.end());
+
+    // L and M as used for USRPs, see tx_packet_random.cpp
+    for (const auto& [L, M] : std::vector<std::pair<uint32_t, uint32_t>>{{10, 9}, {40, 27}}) {
+        const uint32_t os_min = 1;
+
+        phy::resampler_t resampler(
+            rdc.N_TX_min,
+            L,
+            M,
+            phy::resampler_param_t::f_pass_norm[phy::resampler_param_t::user_t::TX][os_min],
+            phy::resampler_param_t::f_stop_norm[phy::resampler_param_t::user_t::TX][os_min],
+            phy::resampler_param_t::PASSBAND_RIPPLE_DONT_CARE,
+            phy::resampler_param_t::f_stop_att_dB[phy::resampler_param_t::user_t::TX][os_min]);
+
+        auto output_iq = get_random_iq(
+            randomgen, rdc.N_TX_min, resampler.get_N_samples_after_resampling(nof_samples), 0.0f);
+
+        bench.run("resampler",
+                  {{"rdc", rdc_string}, {"L", L}, {"M", M}},
+                  uint64_t{nof_samples} * rdc.N_TX_min,
+                  [&]() {
+                      resampler.reset();
+                      resampler.resample(input, output_iq, nof_samples);
+                      resampler.resample_final_samples(output_iq);
+                  });
+
+        free_iq(output_iq);
+    }
+
+    free_iq(input_iq);
+}
+
+static void bench_noise(bench_t& bench, const std::string& rdc_string) {
+    const auto rdc = sp3::get_radio_device_class(rdc_string);
+
+    common::randomgen_t randomgen;
+
+    // same number of samples as one full slot at the maximum DECT NR+ sample rate of the class
+    const uint32_t nof_samples =
+        rdc.u_min * rdc.b_min * constants::samp_rate_min_u_b / constants::slots_per_sec;
+
+    auto iq = get_random_iq(randomgen, rdc.N_TX_min, nof_samples, 0.1f);
+
+    simulation::noise_t noise(123, 0);
+
+    bench.run("noise", {{"rdc", rdc_string}}, uint64_t{nof_samples} * rdc.N_TX_min, [&]() {
+        for (uint32_t i = 0; i < rdc.N_TX_min; ++i) {
+            noise.awgn(i, iq[i], iq[i], nof_samples, 1.0f, 10.0f);
+        }
+    });
+
+    free_iq(iq);
+}
+
+static void bench_autocorrelator_detection(bench_t& bench, const std::string& rdc_string) {
+    const auto rdc = sp3::get_radio_device_class(rdc_string);
+
+    common::randomgen_t randomgen;
+
+    // same derivation as in sync_chunk_t with os_min = 1
+    const uint32_t nof_antennas_limited =
+        std::min(rdc.N_TX_min, RX_SYNC_PARAM_AUTOCORRELATOR_ANTENNA_LIMIT);
+    const uint32_t stf_nof_pattern = sp3::stf_t::get_N_stf_pattern(rdc.u_min);
+    const uint32_t stf_bos_length_samples = sp3::stf_t::get_N_samples_stf(rdc.u_min) * rdc.b_min;
+    const uint32_t stf_bos_pattern_length_samples = stf_bos_length_samples / stf_nof_pattern;
+    const uint32_t dect_samp_rate_max = rdc.u_min * rdc.b_min * constants::samp_rate_min_u_b;
+    const uint32_t search_length_samples = dect_samp_rate_max / constants::slots_per_sec;
+
+    // noise only, so this is the steady-state cost of searching for packets
+    auto localbuffer = get_random_iq(randomgen,
+                                     nof_antennas_limited,
+                                     search_length_samples + 2 * stf_bos_length_samples,
+                                     0.1f);
+
+    phy::autocorrelator_detection_t autocorrelator_detection(localbuffer,
+                                                             nof_antennas_limited,
+                                                             stf_bos_length_samples,
+                                                             stf_bos_pattern_length_samples,
+                                                             search_length_samples,
+                                                             dect_samp_rate_max);
+
+    phy::sync_report_t sync_report(nof_antennas_limited);
+
+    bench.run("autocorrelator_detection",
+              {{"rdc", rdc_string}},
+              uint64_t{search_length_samples} * nof_antennas_limited,
+              [&]() {
+                  autocorrelator_detection.reset();
+                  autocorrelator_detection.set_power_of_first_stf_pattern(
+                      stf_bos_pattern_length_samples);
+                  while (autocorrelator_detection.search_by_correlation(search_length_samples,
+                                                                        sync_report)) {
+                  }
+              });
+
+    free_iq(localbuffer);
+}
+
+static void bench_ofdm(bench_t& bench, const std::string& rdc_string) {
+    const auto rdc = sp3::get_radio_device_class(rdc_string);
+
+    common::randomgen_t randomgen;
+
+    const auto numerology = sp3::get_numerologies(rdc.u_min, rdc.b_min);
+
+    phy::dft::ofdm_t ofdm;
+    phy::dft::get_ofdm(ofdm, numerology.N_b_DFT);
+
+    auto in = get_random_iq(randomgen, 1, numerology.N_b_DFT + numerology.N_b_CP, 1.0f);
+    auto out = get_random_iq(randomgen, 1, numerology.N_b_DFT + numerology.N_b_CP, 0.0f);
+
+    bench.run("ofdm_tx", {{"rdc", rdc_string}}, numerology.N_b_DFT, [&]() {
+        phy::dft::single_symbol_tx_ofdm(ofdm, in[0], out[0], numerology.N_b_CP);
+    });
+
+    bench.run("ofdm_rx", {{"rdc", rdc_string}}, numerology.N_b_DFT, [&]() {
+        phy::dft::single_symbol_rx_ofdm(ofdm, out[0], in[0], numerology.N_b_CP);
+    });
+
+    free_iq(in);
+    free_iq(out);
+    phy::dft::free_ofdm(ofdm);
+}
+
+static void bench_channel_lut(bench_t& bench, const std::string& rdc_string) {
+    const auto rdc = sp3::get_radio_device_class(rdc_string);
+    const auto packet_sizes_maximum = sp3::get_maximum_packet_sizes(rdc_string);
+
+    const auto numerology = sp3::get_numerologies(rdc.u_min, 1);
+
+    // same channel statistics as the first LUT in rx_synced_t
+    const std::vector<double> V0 = RX_SYNCED_PARAM_NU_MAX_HZ_VEC;
+    const std::vector<double> V1 = RX_SYNCED_PARAM_TAU_RMS_SEC_VEC;
+    const std::vector<double> V2 = RX_SYNCED_PARAM_SNR_DB_VEC;
+    const std::vector<uint32_t> V3 = RX_SYNCED_PARAM_NOF_DRS_INTERP_LR_VEC;
+    const std::vector<uint32_t> V4 = RX_SYNCED_PARAM_NOF_DRS_INTERP_L_VEC;
+
+    const phy::channel_statistics_t chst(
+        numerology.delta_u_f, numerology.T_u_symb, V0[0], V1[0], V2[0], V3[0], V4[0]);
+
+    const uint32_t N_eff_TX_max = packet_sizes_maximum.tm_mode.N_TX;
+
+    // construction solves the Wiener-Hopf equations for all interpolation weights
+    bench.run("channel_lut_init", {{"rdc", rdc_string}}, 1, [&]() {
+        phy::channel_lut_t channel_lut(rdc.b_min, N_eff_TX_max, chst);
+    });
+
+    phy::channel_lut_t channel_lut(rdc.b_min, N_eff_TX_max, chst);
+
+    const uint32_t b_idx = sp3::phyres::b2b_idx[rdc.b_min];
+
+    // lookups of interpolation indices as done for every OFDM symbol of a processing stage
+    bench.run("channel_lut_lookup", {{"rdc", rdc_string}}, 4, [&]() {
+        channel_lut.set_configuration_packet(b_idx, N_eff_TX_max);
+        channel_lut.set_configuration_ps(true, 0);
+        uint32_t idx_sum = 0;
+        for (uint32_t ofdm_symb_ps_idx = 0; ofdm_symb_ps_idx < 4; ++ofdm_symb_ps_idx) {
+            const auto& idx_pilot = channel_lut.get_idx_pilot_symb(ofdm_symb_ps_idx);
+            const auto& idx_weights = channel_lut.get_idx_weights_symb(ofdm_symb_ps_idx);
+
+            // read the indices of the first subcarrier, interpolation starts there
+            idx_sum += idx_pilot[0][0] + idx_weights[0][0];
+        }
+        do_not_optimize(idx_sum);
+    });
+}
+
+static void bench_packet_sizes(bench_t& bench, const std::string& rdc_string) {
+    const auto rdc = sp3::get_radio_device_class(rdc_string);
+    const auto packet_sizes_maximum = sp3::get_maximum_packet_sizes(rdc_string);
+
+    bench.run("packet_sizes_lut_init", {{"rdc", rdc_string}}, 1, [&]() {
+        const sp3::packet_sizes_lut_t packet_sizes_lut(packet_sizes_maximum);
+    });
+
+    const sp3::packet_sizes_lut_t packet_sizes_lut(packet_sizes_maximum);
+
+    // as done for every HARQ process allocation
+    bench.run("packet_sizes_compute", {{"rdc", rdc_string}}, 1, [&]() {
+        [[maybe_unused]] const auto q = sp3::get_packet_sizes(packet_sizes_maximum.psdef);
+    });
+
+    bench.run("packet_sizes_lookup", {{"rdc", rdc_string}}, 1, [&]() {
+        [[maybe_unused]] const auto* q =
+            packet_sizes_lut.get_packet_sizes(packet_sizes_maximum.psdef);
+    });
+
+    // link adaptation, shortest packet for a number of bytes
+    bench.run("packet_sizes_lookup_min", {{"rdc", rdc_string}}, 1, [&]() {
+        [[maybe_unused]] const auto* q =
+            packet_sizes_lut.get_packet_sizes_min(packet_sizes_maximum.N_TB_byte / 2,
+                                                  rdc.u_min,
+                                                  rdc.b_min,
+                                                  1,
+                                                  0,
+                                                  rdc.mcs_index_min);
+    });
+}
+
+static void bench_channel_interpolation(bench_t& bench, const std::string& rdc_string) {
+    const auto rdc = sp3::get_radio_device_class(rdc_string);
+    const auto packet_sizes_maximum = sp3::get_maximum_packet_sizes(rdc_string);
+
+    common::randomgen_t randomgen;
+
+    const auto numerology_lut = sp3::get_numerologies(rdc.u_min, 1);
+    const auto numerology = sp3::get_numerologies(rdc.u_min, rdc.b_min);
+    const uint32_t N_b_OCC_plus_DC = numerology.N_b_OCC + 1;
+
+    const std::vector<double> V0 = RX_SYNCED_PARAM_NU_MAX_HZ_VEC;
+    const std::vector<double> V1 = RX_SYNCED_PARAM_TAU_RMS_SEC_VEC;
+    const std::vector<double> V2 = RX_SYNCED_PARAM_SNR_DB_VEC;
+    const std::vector<uint32_t> V3 = RX_SYNCED_PARAM_NOF_DRS_INTERP_LR_VEC;
+    const std::vector<uint32_t> V4 = RX_SYNCED_PARAM_NOF_DRS_INTERP_L_VEC;
+
+    const uint32_t N_eff_TX_max = packet_sizes_maximum.tm_mode.N_TX;
+    const uint32_t b_idx = sp3::phyres::b2b_idx[rdc.b_min];
+
+    auto drs_zf = get_random_iq(randomgen, 1, N_b_OCC_plus_DC, 1.0f);
+    auto chestim = get_random_iq(randomgen, 1, N_b_OCC_plus_DC, 0.0f);
+
+    // one LUT per interpolation length, same as in rx_synced_t
+    for (uint32_t i = 0; i < V0.size(); ++i) {
+        const phy::channel_statistics_t chst(
+            numerology_lut.delta_u_f, numerology_lut.T_u_symb, V0[i], V1[i], V2[i], V3[i], V4[i]);
+
+        phy::channel_lut_t channel_lut(rdc.b_min, N_eff_TX_max, chst);
+        channel_lut.set_configuration_packet(b_idx, N_eff_TX_max);
+        channel_lut.set_configuration_ps(true, 0);
+
+        const uint32_t nof_drs_subc_interp = channel_lut.get_nof_drs_subc_interp();
+        const auto* idx_pilot = channel_lut.get_idx_pilot_symb(0)[0];
+        const auto* idx_weights = channel_lut.get_idx_weights_symb(0)[0];
+        const auto* weight_vecs = channel_lut.get_weight_vecs();
+
+        const nlohmann::ordered_json param_generic = {
+            {"rdc", rdc_string},
+            {"nof_drs_subc_interp", nof_drs_subc_interp},
+            {"kernel", "generic"}};
+
+        bench.run("channel_interpolation", param_generic, N_b_OCC_plus_DC, [&]() {
+            for (uint32_t subc_idx = 0; subc_idx < N_b_OCC_plus_DC; ++subc_idx) {
+#if RX_SYNCED_PARAM_WEIGHTS_TYPE_CHOICE == RX_SYNCED_PARAM_WEIGHTS_TYPE_REAL
+                volk_32fc_32f_dot_prod_32fc_u(
+                    (lv_32fc_t*)&chestim[0][subc_idx],
+                    (const lv_32fc_t*)&drs_zf[0][idx_pilot[subc_idx]],
+                    &weight_vecs[idx_weights[subc_idx] * nof_drs_subc_interp],
+                    nof_drs_subc_interp);
+#endif
+            }
+        });
+
+        const auto interp_kernel = phy::kernels::get_interp(nof_drs_subc_interp);
+
+        if (interp_kernel == nullptr) {
+            continue;
+        }
+
+        const nlohmann::ordered_json param_specialized = {
+            {"rdc", rdc_string},
+            {"nof_drs_subc_interp", nof_drs_subc_interp},
+            {"kernel", "specialized"}};
+
+        bench.run("channel_interpolation", param_specialized, N_b_OCC_plus_DC, [&]() {
+            interp_kernel(
+                chestim[0], drs_zf[0], idx_pilot, idx_weights, weight_vecs, N_b_OCC_plus_DC);
+        });
+    }
+
+    free_iq(drs_zf);
+    free_iq(chestim);
+}
+
+static void bench_mrc(bench_t& bench, const std::string& rdc_string) {
+    const auto rdc = sp3::get_radio_device_class(rdc_string);
+
+    common::randomgen_t randomgen;
+
+    const auto numerology = sp3::get_numerologies(rdc.u_min, rdc.b_min);
+
+    // one spectrum half as in rx_synced_t::run_pdc_mode_single_antenna()
+    const uint32_t step_width = numerology.N_b_OCC / 2;
+    const uint32_t N_RX = rdc.N_TX_min;
+
+    auto y = get_random_iq(randomgen, N_RX, step_width, 1.0f);
+    auto h = get_random_iq(randomgen, N_RX, step_width, 1.0f);
+    auto stage = get_random_iq(randomgen, 3, step_width, 0.0f);
+
+    bench.run("mrc",
+              {{"rdc", rdc_string}, {"kernel", "generic"}},
+              uint64_t{step_width} * N_RX,
+              [&]() {
+                  srsran_vec_cf_zero(stage[0], step_width);
+                  srsran_vec_cf_zero(stage[1], step_width);
+                  for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
+                      volk_32fc_x2_multiply_conjugate_32fc(
+                          (lv_32fc_t*)stage[2], (lv_32fc_t*)y[ant_idx], (lv_32fc_t*)h[ant_idx],
+                          step_width);
+                      volk_32fc_x2_add_32fc(
+                          (lv_32fc_t*)stage[0], (lv_32fc_t*)stage[0], (lv_32fc_t*)stage[2],
+                          step_width);
+                      volk_32fc_x2_multiply_conjugate_32fc(
+                          (lv_32fc_t*)stage[2], (lv_32fc_t*)h[ant_idx], (lv_32fc_t*)h[ant_idx],
+                          step_width);
+                      volk_32fc_x2_add_32fc(
+                          (lv_32fc_t*)stage[1], (lv_32fc_t*)stage[1], (lv_32fc_t*)stage[2],
+                          step_width);
+                  }
+                  volk_32fc_x2_divide_32fc(
+                      (lv_32fc_t*)stage[0], (lv_32fc_t*)stage[0], (lv_32fc_t*)stage[1], step_width);
+              });
+
+    const auto mrc_kernel = phy::kernels::get_mrc(N_RX);
+
+    if (mrc_kernel != nullptr) {
+        const std::vector<const cf_t*> y_const(y.begin(), y.end());
+        const std::vector<const cf_t*> h_const(h.begin(), h.end());
+
+        bench.run("mrc",
+                  {{"rdc", rdc_string}, {"kernel", "specialized"}},
+                  uint64_t{step_width} * N_RX,
+                  [&]() { mrc_kernel(stage[0], y_const.data(), h_const.data(), 0, step_width); });
+    }
+
+    free_iq(y);
+    free_iq(h);
+    free_iq(stage);
+}
+
+static void bench_demapping(bench_t& bench, const std::string& rdc_string) {
+    const auto rdc = sp3::get_radio_device_class(rdc_string);
+
+    common::randomgen_t randomgen;
+
+    for (uint32_t mcs_index = 0; mcs_index <= rdc.mcs_index_min; ++mcs_index) {
+        const auto packet_sizes = get_packet_sizes_mcs(rdc, mcs_index);
+
+        if (!packet_sizes.has_value()) {
+            continue;
+        }
+
+        const uint32_t N_PDC_subc = packet_sizes->N_PDC_subc;
+
+        auto symbols = get_random_iq(randomgen, 1, N_PDC_subc, 0.7f);
+        int16_t* llr = static_cast<int16_t*>(
+            srsran_vec_malloc(N_PDC_subc * packet_sizes->mcs.N_bps * sizeof(int16_t)));
+
+        const srsran_mod_t srsran_mod = sp3::fix::get_srsran_mod(packet_sizes->mcs.N_bps);
+
+        bench.run("demapping",
+                  {{"rdc", rdc_string}, {"mcs", mcs_index}},
+                  uint64_t{N_PDC_subc} * packet_sizes->mcs.N_bps,
+                  [&]() {
+                      srsran_demod_soft_demodulate_s(srsran_mod, symbols[0], llr, N_PDC_subc);
+                  });
+
+        // demapping including descrambling, as used by rx_synced_t for the PDC
+        std::vector<uint8_t> c(N_PDC_subc * packet_sizes->mcs.N_bps);
+        for (auto& bit : c) {
+            bit = static_cast<uint8_t>(randomgen.randi(0, 1));
+        }
+
+        const float llr_scale = phy::demapper::get_llr_scale(packet_sizes->mcs.N_bps, 20.0f);
+
+        bench.run("demapping_fused",
+                  {{"rdc", rdc_string}, {"mcs", mcs_index}},
+                  uint64_t{N_PDC_subc} * packet_sizes->mcs.N_bps,
+                  [&]() {
+                      phy::demapper::demap_and_descramble(packet_sizes->mcs.N_bps,
+                                                          symbols[0],
+                                                          llr_scale,
+                                                          c.data(),
+                                                          llr,
+                                                          N_PDC_subc);
+                  });
+
+        free(llr);
+        free_iq(symbols);
+    }
+}
+
+static void bench_fec(bench_t& bench, const std::string& rdc_string) {
+    const auto rdc = sp3::get_radio_device_class(rdc_string);
+    const auto packet_sizes_maximum = sp3::get_maximum_packet_sizes(rdc_string);
+
+    auto hb_tx = std::make_unique<phy::harq::buffer_tx_t>(
+        phy::harq::buffer_tx_t::COMPONENT_T::TRANSPORT_BLOCK,
+        packet_sizes_maximum.N_TB_byte,
+        packet_sizes_maximum.G,
+        packet_sizes_maximum.C,
+        packet_sizes_maximum.psdef.Z);
+
+    auto hb_rx = std::make_unique<phy::harq::buffer_rx_t>(packet_sizes_maximum.N_TB_byte,
+                                                          packet_sizes_maximum.G,
+                                                          packet_sizes_maximum.C,
+                                                          packet_sizes_maximum.psdef.Z);
+
+    auto fec = std::make_unique<phy::fec_t>(packet_sizes_maximum);
+
+    const uint32_t network_id = 123456789;
+    fec->add_new_network_id(network_id);
+
+    uint8_t* const d_unpacked = srsran_vec_u8_malloc(packet_sizes_maximum.G);
+
+    for (uint32_t mcs_index = 0; mcs_index <= rdc.mcs_index_min; ++mcs_index) {
+        const auto packet_sizes = get_packet_sizes_mcs(rdc, mcs_index);
+
+        // srsran has a size limitation
+        if (!packet_sizes.has_value() || packet_sizes->C > SRSRAN_MAX_CODEBLOCKS) {
+            continue;
+        }
+
+        uint8_t* a = hb_tx->get_a();
+        for (uint32_t i = 0; i < packet_sizes->N_TB_byte; ++i) {
+            a[i] = static_cast<uint8_t>(std::rand() % 256);
+        }
+
+        const sp3::fec_cfg_t cfg = {.PLCF_type = 2,
+                                    .closed_loop = false,
+                                    .beamforming = false,
+                                    .N_TB_bits = packet_sizes->N_TB_bits,
+                                    .N_bps = packet_sizes->mcs.N_bps,
+                                    .rv = 0,
+                                    .G = packet_sizes->G,
+                                    .network_id = network_id,
+                                    .Z = packet_sizes->psdef.Z};
+
+        const nlohmann::ordered_json param = {{"rdc", rdc_string},
+                                              {"mcs", mcs_index},
+                                              {"N_TB_byte", packet_sizes->N_TB_byte}};
+
+        bench.run("fec_encode", param, packet_sizes->N_TB_bits, [&]() {
+            hb_tx->reset_a_cnt_and_softbuffer();
+            fec->segmentate_and_pick_scrambling_sequence(cfg);
+            fec->encode_tb(cfg, *hb_tx);
+        });
+
+        // noiseless soft bits, decoder converges in the first iteration
+        srsran_bit_unpack_vector(hb_tx->get_d(), d_unpacked, cfg.G);
+        PHY_D_RX_DATA_TYPE* d_rx = reinterpret_cast<PHY_D_RX_DATA_TYPE*>(hb_rx->get_d());
+        for (uint32_t i = 0; i < cfg.G; ++i) {
+            d_rx[i] = (d_unpacked[i] > 0) ? 10 : -10;
+        }
+
+        bench.run("fec_decode", param, packet_sizes->N_TB_bits, [&]() {
+            hb_rx->reset_a_cnt_and_softbuffer();
+            fec->segmentate_and_pick_scrambling_sequence(cfg);
+            fec->decode_tb(cfg, *hb_rx, cfg.G);
+        });
+    }
+
+    free(d_unpacked);
+}
+
+static void bench_tx(bench_t& bench, const std::string& rdc_string) {
+    const auto packet_sizes_maximum = sp3::get_maximum_packet_sizes(rdc_string);
+
+    auto hpp = std::make_unique<phy::harq::process_pool_t>(packet_sizes_maximum, 1, 1);
+
+    // no oversampling and no resampling, resampling is measured separately
+    const uint32_t os_min = 1;
+    const uint32_t dect_samp_rate_os = packet_sizes_maximum.numerology.B_u_b_DFT * os_min;
+
+    const radio::hw_config_t hw_config = {.nof_buffer_tx_max_length = 1, .rx_prestream_ms = 0};
+    radio::hw_config_t::sim_samp_rate_lte = false;
+
+    simulation::vspace_t vspace(123, 123, "awgn", "awgn", "relative");
+
+    auto hw = std::make_unique<radio::hw_simulator_t>(hw_config, vspace);
+    hw->set_nof_antennas(packet_sizes_maximum.tm_mode.N_TX);
+    hw->set_samp_rate(dect_samp_rate_os);
+
+    const auto resampler_param = phy::phy_config_t::get_resampler_param_verified(
+        hw->get_samp_rate(), dect_samp_rate_os, true);
+
+    hw->initialize_buffer_tx_pool(
+        sp3::get_N_samples_in_packet_length_max(packet_sizes_maximum, hw->get_samp_rate()));
+
+    auto tx = std::make_unique<phy::tx_t>(packet_sizes_maximum, os_min, resampler_param);
+
+    const uint32_t network_id = 123456789;
+    tx->add_new_network_id(network_id);
+
+    const phy::tx_meta_t tx_meta = {.optimal_scaling_DAC = false,
+                                    .DAC_scale = 1.0f,
+                                    .iq_phase_rad = 0.0f,
+                                    .iq_phase_increment_s2s_post_resampling_rad = 0.0f,
+                                    .GI_percentage = 5};
+
+    const radio::buffer_tx_meta_t buffer_tx_meta = {
+        .tx_order_id = 0, .tx_time_64 = 0, .busy_wait_us = 0};
+
+    bench.run("tx_generate_tx_packet",
+              {{"rdc", rdc_string}, {"mcs", packet_sizes_maximum.psdef.mcs_index}},
+              packet_sizes_maximum.N_samples_packet,
+              [&]() {
+                  auto* hp_tx =
+                      hpp->get_process_tx(2,
+                                          network_id,
+                                          packet_sizes_maximum.psdef,
+                                          phy::harq::finalize_tx_t::reset_and_terminate);
+
+                  dectnrp_assert(hp_tx != nullptr, "no HARQ buffer available");
+
+                  const phy::tx_descriptor_t tx_descriptor(*hp_tx, 0, tx_meta, buffer_tx_meta);
+
+                  auto* buffer_tx = hw->buffer_tx_pool->get_buffer_tx_to_fill(
+                      tx->get_N_samples_buffer_tx(hp_tx->get_packet_sizes()));
+
+                  dectnrp_assert(buffer_tx != nullptr, "buffer unavailable");
+
+                  tx->generate_tx_packet(tx_descriptor, *buffer_tx);
+
+                  hw->set_all_buffers_as_transmitted();
+
+                  hp_tx->finalize();
+              });
+}
+
+static void bench_contact_list(bench_t& bench) {
+    // number of packets from random contacts per measured call
+    constexpr uint32_t N_lookup = 1000;
+
+    common::randomgen_t randomgen;
+
+    for (const uint32_t N_contacts : {10U, 100U, 1000U}) {
+        // unique and valid identifiers of all contacts
+        std::vector<uint32_t> srdid_vec(N_contacts);
+        std::iota(srdid_vec.begin(), srdid_vec.end(), 1);
+        std::vector<uint32_t> lrdid_vec(srdid_vec);
+        for (auto& lrdid : lrdid_vec) {
+            lrdid = lrdid * 0x10001U + 0x1000U;
+        }
+
+        mac::contact_list_t<mac::contact_t> contact_list;
+        contact_list.reserve(N_contacts);
+
+        for (uint32_t i = 0; i < N_contacts; ++i) {
+            contact_list.add_new_contact_and_setup_indexing(
+                sp4::mac_architecture::identity_t(1, lrdid_vec[i], srdid_vec[i]), i, i);
+        }
+
+        std::vector<uint32_t> srdid_lookup_vec(N_lookup);
+        std::vector<uint32_t> lrdid_lookup_vec(N_lookup);
+        for (uint32_t i = 0; i < N_lookup; ++i) {
+            const uint32_t idx = randomgen.randi(0, N_contacts - 1);
+            srdid_lookup_vec[i] = srdid_vec[idx];
+            lrdid_lookup_vec[i] = lrdid_vec[idx];
+        }
+
+        // as done for every PCC
+        bench.run("contact_list_pcc", {{"N_contacts", N_contacts}}, N_lookup, [&]() {
+            for (const auto srdid : srdid_lookup_vec) {
+                const auto idx = contact_list.get_idx_from_srdid(srdid);
+                auto& contact = contact_list.get_contact_from_idx(idx.value());
+                ++contact.conn_idx_server;
+            }
+        });
+
+        // as done for every PDC
+        bench.run("contact_list_pdc", {{"N_contacts", N_contacts}}, N_lookup, [&]() {
+            for (const auto lrdid : lrdid_lookup_vec) {
+                auto& contact = contact_list.get_contact(lrdid);
+                ++contact.conn_idx_server;
+            }
+        });
+    }
+}
+
+}  // namespace dectnrp::bench
+
+int main(int argc, char** argv) {
+    /* Usage:
+     *
+     *      dectnrp_bench [results.json] [filter]
+     *
+     * The filter is matched against benchmark names, e.g. "fec" runs fec_encode and fec_decode.
+     */
+    const std::string filename = argc > 1 ? argv[1] : BENCH_RESULTS_FILENAME_DEFAULT;
+    const std::string filter = argc > 2 ? argv[2] : "";
+
+    std::srand(0);
+
+    dectnrp::bench::bench_t bench(BENCH_NOF_WARMUP, BENCH_NOF_RUNS, filter);
+
+    const std::vector<std::string> rdc_vec = {
+        "1.1.1.A", "8.1.1.A", "1.8.1.A", "2.8.2.A", "2.12.4.A", "8.12.8.A", "8.16.8.A"};
+
+    for (const auto& rdc : rdc_vec) {
+        dectnrp::bench::bench_resampler(bench, rdc);
+        dectnrp::bench::bench_noise(bench, rdc);
+        dectnrp::bench::bench_autocorrelator_detection(bench, rdc);
+        dectnrp::bench::bench_ofdm(bench, rdc);
+        dectnrp::bench::bench_channel_lut(bench, rdc);
+        dectnrp::bench::bench_packet_sizes(bench, rdc);
+        dectnrp::bench::bench_channel_interpolation(bench, rdc);
+        dectnrp::bench::bench_mrc(bench, rdc);
+        dectnrp::bench::bench_demapping(bench, rdc);
+        dectnrp::bench::bench_fec(bench, rdc);
+        dectnrp::bench::bench_tx(bench, rdc);
+    }
+
+    dectnrp::bench::bench_contact_list(bench);
+
+    if (bench.get_results().empty()) {
+        dectnrp_print_wrn("no benchmark selected by filter {}", filter);
+        return EXIT_FAILURE;
+    }
+
+    nlohmann::ordered_json json;
+    json["nof_warmup"] = bench.nof_warmup;
+    json["nof_runs"] = bench.nof_runs;
+    json["results"] = bench.get_results();
+
+    dectnrp::common::json_export_t::write_to_disk(json, filename);
+
+    dectnrp_print_inf("results written to {}", filename);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/common/thread/watch.hpp"
+#include "header_only/nlohmann/json.hpp"
+
+/// unmeasured calls before measuring, warms up caches and branch predictors
+#define BENCH_NOF_WARMUP 10
+
+/// measured calls per benchmark, percentiles are derived from these
+#define BENCH_NOF_RUNS 200
+
+/// default file name of machine-readable results
+#define BENCH_RESULTS_FILENAME_DEFAULT "bench_results.json"
+
+namespace dectnrp::bench {
+
+/// keeps the compiler from discarding a computation whose result is otherwise unused
+template <typename T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * \brief Runs a callable repeatedly, measures the duration of each call and collects the
+ * statistics of all benchmarks in a single JSON. Each benchmark is identified by a name and a set
+ * of parameters, so that results of different releases can be compared entry by entry.
+ */
+class bench_t {
+    public:
+        explicit bench_t(const uint32_t nof_warmup_,
+                         const uint32_t nof_runs_,
+                         const std::string filter_)
+            : nof_warmup(nof_warmup_),
+              nof_runs(nof_runs_),
+              filter(filter_) {
+            dectnrp_assert(0 < nof_runs, "number of runs must be positive");
+            durations_ns.resize(nof_runs);
+            results = nlohmann::ordered_json::array();
+        };
+
+        bench_t() = delete;
+        bench_t(const bench_t&) = delete;
+        bench_t& operator=(const bench_t&) = delete;
+        bench_t(bench_t&&) = delete;
+        bench_t& operator=(bench_t&&) = delete;
+
+        /// benchmarks are skipped if the filter is not part of their name
+        bool is_selected(const std::string& name) const {
+            return filter.empty() || name.find(filter) != std::string::npos;
+        }
+
+        /**
+         * \brief Measure a callable.
+         *
+         * \param name unique name of the benchmark, e.g. "fec_encode"
+         * \param param parameters of this run, e.g. radio device class and MCS
+         * \param nof_items items processed per call (samples, bits etc.) to derive throughput
+         * \param func callable to measure
+         */
+        template <typename F>
+        void run(const std::string& name,
+                 nlohmann::ordered_json param,
+                 const uint64_t nof_items,
+                 F&& func) {
+            if (!is_selected(name)) {
+                return;
+            }
+
+            for (uint32_t i = 0; i < nof_warmup; ++i) {
+                func();
+            }
+
+            common::watch_t watch;
+
+            for (uint32_t i = 0; i < nof_runs; ++i) {
+                watch.reset();
+                func();
+                durations_ns[i] = watch.get_elapsed();
+            }
+
+            std::sort(durations_ns.begin(), durations_ns.end());
+
+            int64_t sum{0};
+            for (const auto d : durations_ns) {
+                sum += d;
+            }
+
+            const int64_t median = get_percentile(50);
+            const double items_per_s =
+                median > 0 ? static_cast<double>(nof_items) * 1.0e9 / static_cast<double>(median)
+                           : 0.0;
+
+            dectnrp_print_inf("{:<24} {:<48} median {:>10} ns  p90 {:>10} ns  {:.3e} items/s",
+                              name,
+                              param.dump(),
+                              median,
+                              get_percentile(90),
+                              items_per_s);
+
+            nlohmann::ordered_json entry;
+            entry["name"] = name;
+            entry["param"] = std::move(param);
+            entry["nof_runs"] = nof_runs;
+            entry["nof_items"] = nof_items;
+            entry["min_ns"] = durations_ns.front();
+            entry["median_ns"] = median;
+            entry["p90_ns"] = get_percentile(90);
+            entry["p99_ns"] = get_percentile(99);
+            entry["max_ns"] = durations_ns.back();
+            entry["mean_ns"] = sum / static_cast<int64_t>(nof_runs);
+            entry["items_per_s"] = items_per_s;
+
+            results.push_back(std::move(entry));
+        }
+
+        const nlohmann::ordered_json& get_results() const { return results; };
+
+        const uint32_t nof_warmup;
+        const uint32_t nof_runs;
+        const std::string filter;
+
+    private:
+        /// sorted after each benchmark
+        std::vector<int64_t> durations_ns;
+
+        nlohmann::ordered_json results;
+
+        int64_t get_percentile(const uint32_t percentile) const {
+            const std::size_t idx = (durations_ns.size() - 1) * percentile / 100;
+            return durations_ns[idx];
+        }
+};
+
+}  // namespace dectnrp::bench
@@ -18,16 +18,22 @@
  * and at http://www.gnu.org/licenses/.
  */
 
+#include <algorithm>
 #include <atomic>
 #include <csignal>
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "dectnrp/build_info.hpp"
 #include "dectnrp/common/prog/assert.hpp"
 #include "dectnrp/common/prog/log.hpp"
+#include "dectnrp/common/prog/metrics.hpp"
 #include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/common/prog/trace.hpp"
+#include "dectnrp/common/thread/cpu_topology.hpp"
+#include "dectnrp/common/thread/thread_placement.hpp"
 #include "dectnrp/common/thread/watch.hpp"
 #include "dectnrp/phy/phy.hpp"
 #include "dectnrp/phy/phy_config.hpp"
@@ -46,6 +52,98 @@ static void signal_handler([[maybe_unused]] int signo) {
     ctrl_c_pressed.store(true, std::memory_order_release);
 }
 
+/**
+ * \brief Resolves all threads configured with cpu_core_auto. Every hw, its worker_pool and the
+ * application threads of its tpoint form one group placed on one CPU domain, so that samples and
+ * packets of one radio device never cross a NUMA node or L3 cache.
+ */
+static void place_threads(dectnrp::radio::radio_config_t& radio_config,
+                          dectnrp::phy::phy_config_t& phy_config,
+                          dectnrp::upper::upper_config_t& upper_config) {
+    using thread_t = dectnrp::common::thread_placement_t::thread_t;
+
+    const dectnrp::common::cpu_topology_t cpu_topology;
+    dectnrp::common::thread_placement_t thread_placement(cpu_topology);
+
+    const std::size_t nof_pairs =
+        std::min(radio_config.get_nof_layer_unit_config(), phy_config.get_nof_layer_unit_config());
+
+    bool any_auto = false;
+
+    for (std::size_t id = 0; id < nof_pairs; ++id) {
+        auto& hw_config = radio_config.get_layer_unit_config(id);
+        auto& worker_pool_config = phy_config.get_layer_unit_config(id);
+
+        std::vector<thread_t> thread_vec;
+        thread_vec.push_back(thread_t{"hw_tx", &hw_config.tx_thread_config});
+        thread_vec.push_back(thread_t{"hw_rx", &hw_config.rx_thread_config});
+        if (hw_config.hw_name == "usrp") {
+            thread_vec.push_back(
+                thread_t{"hw_tx_async_helper", &hw_config.usrp_tx_async_helper_thread_config});
+        }
+
+        for (std::size_t i = 0; i < worker_pool_config.threads_core_prio_config_sync_vec.size();
+             ++i) {
+            thread_vec.push_back(
+                thread_t{"sync_" + std::to_string(i),
+                         &worker_pool_config.threads_core_prio_config_sync_vec[i]});
+        }
+
+        for (std::size_t i = 0; i < worker_pool_config.threads_core_prio_config_tx_rx_vec.size();
+             ++i) {
+            thread_vec.push_back(
+                thread_t{"tx_rx_" + std::to_string(i),
+                         &worker_pool_config.threads_core_prio_config_tx_rx_vec[i]});
+
+            auto& lane_vec = worker_pool_config.threads_core_prio_config_tx_lane_vec[i];
+            for (std::size_t j = 0; j < lane_vec.size(); ++j) {
+                thread_vec.push_back(thread_t{
+                    "tx_rx_" + std::to_string(i) + "_lane_" + std::to_string(j + 1), &lane_vec[j]});
+            }
+        }
+
+        // a single tpoint for many pairs is placed with the first pair
+        if (id < upper_config.get_nof_layer_unit_config()) {
+            auto& tpoint_config = upper_config.get_layer_unit_config(id);
+            thread_vec.push_back(thread_t{"application_server",
+                                          &tpoint_config.application_server_thread_config});
+            thread_vec.push_back(thread_t{"application_client",
+                                          &tpoint_config.application_client_thread_config});
+        }
+
+        worker_pool_config.cpu_domain =
+            thread_placement.add_group("pair_" + std::to_string(id), thread_vec);
+
+        any_auto = any_auto || worker_pool_config.cpu_domain.is_valid();
+    }
+
+    if (!any_auto) {
+        return;
+    }
+
+    for (const auto& cpu_domain : cpu_topology.get_domains()) {
+        dectnrp_log_inf("thread placement cpu domain {}", cpu_domain.get_string());
+    }
+
+    for (const auto& line : thread_placement.get_plan()) {
+        dectnrp_log_inf("thread placement {}", line);
+    }
+}
+
+/// only sync and TX/RX threads of the PHY record trace events
+[[maybe_unused]] static uint32_t get_nof_trace_threads(
+    const dectnrp::phy::phy_config_t& phy_config) {
+    std::size_t nof_threads = 0;
+
+    for (std::size_t id = 0; id < phy_config.get_nof_layer_unit_config(); ++id) {
+        const auto& worker_pool_config = phy_config.get_layer_unit_config(id);
+        nof_threads += worker_pool_config.threads_core_prio_config_sync_vec.size();
+        nof_threads += worker_pool_config.threads_core_prio_config_tx_rx_vec.size();
+    }
+
+    return static_cast<uint32_t>(nof_threads);
+}
+
 int main(int argc, char** argv) {
     // register signal handler
     signal(SIGINT, signal_handler);
@@ -90,6 +188,12 @@ int main(int argc, char** argv) {
         return EXIT_FAILURE;
     }
 
+    // resolve automatic CPU cores before any layer allocates buffers or starts threads
+    place_threads(radio_config, phy_config, upper_config);
+
+    // trace buffers must not be allocated by real-time threads
+    dectnrp_trace_init(get_nof_trace_threads(phy_config));
+
     // init all layers of stack
     std::unique_ptr<dectnrp::radio::radio_t> radio;
     std::unique_ptr<dectnrp::phy::phy_t> phy;
@@ -109,6 +213,8 @@ int main(int argc, char** argv) {
     phy->start_threads_of_all_layer_units();    // get ready to process IQ samples
     radio->start_threads_of_all_layer_units();  // start streaming IQ samples
 
+    dectnrp_metrics_start(dectnrp::metrics::server_port);
+
     // wait for user to press ctrl+c
     while (!ctrl_c_pressed.load(std::memory_order_acquire)) {
         dectnrp::common::watch_t::sleep<dectnrp::common::milli>(250);
@@ -123,11 +229,16 @@ int main(int argc, char** argv) {
     radio->stop_all_layer_units();  // stop streaming samples, stopped last as many
                                     // components depend on an increasing sample time
 
+    dectnrp_metrics_stop();
+
     // log and print stop time
     const auto stop_time_str = dectnrp::common::watch_t::get_date_and_time();
     dectnrp_log_inf("dectnrp stopped at: {}", stop_time_str);
     dectnrp_print_inf("dectnrp stopped at: {}", stop_time_str);
 
+    // all threads have stopped, so trace events can be read safely
+    dectnrp_trace_save("trace.json");
+
     dectnrp_log_save();
 
     return EXIT_SUCCESS;
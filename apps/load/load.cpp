@@ -0,0 +1,526 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "load.hpp"
+
+#include <poll.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "dectnrp/apps/pacer.hpp"
+#include "dectnrp/apps/udp.hpp"
+#include "dectnrp/common/json/json_export.hpp"
+#include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/common/thread/threads.hpp"
+#include "dectnrp/common/thread/watch.hpp"
+#include "header_only/argparse/argparse.hpp"
+#include "header_only/nlohmann/json.hpp"
+
+// ctrl+c
+static std::atomic<bool> ctrl_c_pressed{false};
+static void signal_handler([[maybe_unused]] int signo) {
+    ctrl_c_pressed.store(true, std::memory_order_release);
+}
+
+// threading
+static pthread_t tx_thread;
+static pthread_t rx_thread;
+static std::atomic<bool> tx_stop{false};
+static std::atomic<bool> rx_stop{false};
+
+/// prepended to every datagram, the remaining payload is zero
+struct load_header_t {
+        uint32_t flow_id;
+        uint32_t reserved;
+        uint64_t seq;
+        int64_t tx_time_ns;
+};
+
+/// statistics of one direction of a flow, only accessed by the RX thread while running
+struct direction_stats_t {
+        uint64_t rx{0};
+        uint64_t rx_byte{0};
+        uint64_t rx_byte_last_print{0};
+
+        /// datagrams with a sequence number smaller than the largest seen so far
+        uint64_t reordered{0};
+        uint64_t seq_max{0};
+
+        std::vector<int64_t> latency_ns;
+
+        void add(const uint64_t seq, const std::size_t n_byte, const int64_t latency_ns_64) {
+            if (rx > 0 && seq < seq_max) {
+                ++reordered;
+            } else {
+                seq_max = seq;
+            }
+
+            ++rx;
+            rx_byte += n_byte;
+
+            if (latency_ns.size() < LOAD_LATENCY_SAMPLES_MAX) {
+                latency_ns.push_back(latency_ns_64);
+            }
+        }
+};
+
+/**
+ * \brief A flow transmits to port_tx and receives on port_rx. If echo ports are given, every
+ * datagram received on port_rx is sent back to port_echo_tx and finally received on port_echo_rx,
+ * which yields the round-trip latency in addition to the one-way latency.
+ */
+struct flow_t {
+        uint32_t port_tx{};
+        uint32_t port_rx{};
+        bool has_echo{false};
+        uint32_t port_echo_tx{};
+        uint32_t port_echo_rx{};
+
+        std::size_t conn_tx{};
+        std::size_t conn_rx{};
+        std::size_t conn_echo_tx{};
+        std::size_t conn_echo_rx{};
+
+        /// only accessed by the TX thread while running
+        dectnrp::apps::pacer_t pacer;
+        uint64_t tx{0};
+
+        direction_stats_t oneway;
+        direction_stats_t roundtrip;
+};
+
+// UDP
+static dectnrp::apps::udp_t udp;
+
+// flows
+static std::vector<flow_t> flows;
+
+// config
+static std::size_t datagram_size{};
+static int64_t duration_sec_64{};
+
+static int64_t get_now_ns() {
+    return dectnrp::common::watch_t::
+        get_elapsed_since_epoch<int64_t, dectnrp::common::nano, dectnrp::common::steady_clock>();
+}
+
+static int64_t get_now_us() {
+    return dectnrp::common::watch_t::
+        get_elapsed_since_epoch<int64_t, dectnrp::common::micro, dectnrp::common::steady_clock>();
+}
+
+static void* tx_thread_routine([[maybe_unused]] void* ptr) {
+    uint8_t tx_buffer[LOAD_DATAGRAM_SIZE_MAX_BYTE]{};
+
+    // create vector of next departure times of each flow
+    std::vector<int64_t> next_vec(flows.size());
+
+    // start in the near future so that all flows start at the same time
+    const int64_t start_us_64 = get_now_us() + 100000;
+
+    for (std::size_t i = 0; i < flows.size(); ++i) {
+        next_vec.at(i) = flows.at(i).pacer.set_start_us(start_us_64);
+    }
+
+    while (!tx_stop.load(std::memory_order_acquire)) {
+        // find next flow to transmit
+        const std::size_t idx =
+            std::distance(next_vec.begin(), std::min_element(next_vec.begin(), next_vec.end()));
+
+        // if we are late, transmit immediately to keep up the average rate
+        dectnrp::common::watch_t::sleep_until<dectnrp::common::micro,
+                                              dectnrp::common::steady_clock>(next_vec.at(idx));
+
+        auto& flow = flows.at(idx);
+
+        const load_header_t header{.flow_id = static_cast<uint32_t>(idx),
+                                   .reserved = 0,
+                                   .seq = flow.tx,
+                                   .tx_time_ns = get_now_ns()};
+
+        std::memcpy(tx_buffer, &header, sizeof(header));
+
+        if (udp.tx(flow.conn_tx, tx_buffer, datagram_size) < 0) {
+            dectnrp_print_wrn("flow {} unable to transmit datagram {}", idx, flow.tx);
+        }
+
+        ++flow.tx;
+
+        next_vec.at(idx) = flow.pacer.get_next_us();
+    }
+
+    return nullptr;
+}
+
+/// for every polled file descriptor, which flow and which direction does it belong to?
+struct pollfd_target_t {
+        std::size_t flow_idx;
+        bool is_echo;
+};
+
+static void print_interval(const int64_t interval_ns_64) {
+    for (std::size_t i = 0; i < flows.size(); ++i) {
+        auto& stats = flows.at(i).has_echo ? flows.at(i).roundtrip : flows.at(i).oneway;
+
+        const double mbps = static_cast<double>(stats.rx_byte - stats.rx_byte_last_print) * 8.0 /
+                            static_cast<double>(interval_ns_64) * 1.0e3;
+
+        stats.rx_byte_last_print = stats.rx_byte;
+
+        dectnrp_print_inf("flow {} rx {} goodput {:.3f} Mbit/s", i, stats.rx, mbps);
+    }
+}
+
+static void* rx_thread_routine([[maybe_unused]] void* ptr) {
+    uint8_t rx_buffer[LOAD_DATAGRAM_SIZE_MAX_BYTE]{};
+
+    std::vector<struct pollfd> pollfd_vec;
+    std::vector<pollfd_target_t> pollfd_target_vec;
+
+    for (std::size_t i = 0; i < flows.size(); ++i) {
+        pollfd_vec.push_back({udp.get_socket_fd_rx(flows.at(i).conn_rx), POLLIN, 0});
+        pollfd_target_vec.push_back({i, false});
+
+        if (flows.at(i).has_echo) {
+            pollfd_vec.push_back({udp.get_socket_fd_rx(flows.at(i).conn_echo_rx), POLLIN, 0});
+            pollfd_target_vec.push_back({i, true});
+        }
+    }
+
+    int64_t last_print_ns_64 = get_now_ns();
+
+    while (!rx_stop.load(std::memory_order_acquire)) {
+        const int ret = poll(pollfd_vec.data(), pollfd_vec.size(), LOAD_RX_POLL_TIMEOUT_MS);
+
+        dectnrp_assert(0 <= ret || errno == EINTR, "poll failed");
+
+        for (std::size_t i = 0; 0 < ret && i < pollfd_vec.size(); ++i) {
+            if ((pollfd_vec.at(i).revents & POLLIN) == 0) {
+                continue;
+            }
+
+            const auto& target = pollfd_target_vec.at(i);
+            auto& flow = flows.at(target.flow_idx);
+
+            const ssize_t n = udp.rx(target.is_echo ? flow.conn_echo_rx : flow.conn_rx,
+                                     rx_buffer,
+                                     LOAD_DATAGRAM_SIZE_MAX_BYTE);
+
+            const int64_t now_ns_64 = get_now_ns();
+
+            if (n < static_cast<ssize_t>(sizeof(load_header_t))) {
+                continue;
+            }
+
+            load_header_t header;
+            std::memcpy(&header, rx_buffer, sizeof(header));
+
+            if (header.flow_id != target.flow_idx) {
+                dectnrp_print_wrn("flow {} received datagram of flow {}",
+                                  target.flow_idx,
+                                  header.flow_id);
+                continue;
+            }
+
+            if (target.is_echo) {
+                flow.roundtrip.add(header.seq, n, now_ns_64 - header.tx_time_ns);
+            } else {
+                flow.oneway.add(header.seq, n, now_ns_64 - header.tx_time_ns);
+
+                if (flow.has_echo) {
+                    udp.tx(flow.conn_echo_tx, rx_buffer, n);
+                }
+            }
+        }
+
+        const int64_t now_ns_64 = get_now_ns();
+
+        if (1000000000 <= now_ns_64 - last_print_ns_64) {
+            print_interval(now_ns_64 - last_print_ns_64);
+            last_print_ns_64 = now_ns_64;
+        }
+    }
+
+    return nullptr;
+}
+
+/// nearest-rank percentile, latency_ns must be sorted
+static double get_percentile_us(const std::vector<int64_t>& latency_ns, const double p) {
+    if (latency_ns.empty()) {
+        return 0.0;
+    }
+
+    const std::size_t rank = static_cast<std::size_t>(
+        std::ceil(p / 100.0 * static_cast<double>(latency_ns.size())));
+
+    const std::size_t idx = std::clamp(rank, std::size_t{1}, latency_ns.size()) - 1;
+
+    return static_cast<double>(latency_ns.at(idx)) / 1.0e3;
+}
+
+static nlohmann::ordered_json report_direction(const std::string identifier,
+                                               const std::size_t flow_idx,
+                                               const uint64_t tx,
+                                               direction_stats_t& stats,
+                                               const double elapsed_sec) {
+    std::sort(stats.latency_ns.begin(), stats.latency_ns.end());
+
+    // duplicates could make rx larger than tx
+    const uint64_t lost = tx > stats.rx ? tx - stats.rx : 0;
+    const double loss = tx > 0 ? static_cast<double>(lost) / static_cast<double>(tx) : 0.0;
+    const double mbps = static_cast<double>(stats.rx_byte) * 8.0 / elapsed_sec / 1.0e6;
+
+    const double p50_us = get_percentile_us(stats.latency_ns, 50.0);
+    const double p99_us = get_percentile_us(stats.latency_ns, 99.0);
+    const double p999_us = get_percentile_us(stats.latency_ns, 99.9);
+    const double max_us = get_percentile_us(stats.latency_ns, 100.0);
+
+    dectnrp_print_inf("flow {} {} tx {} rx {} loss {:.4f} reordered {} goodput {:.3f} Mbit/s",
+                      flow_idx,
+                      identifier,
+                      tx,
+                      stats.rx,
+                      loss,
+                      stats.reordered,
+                      mbps);
+    dectnrp_print_inf("flow {} {} p50 {:.1f} us p99 {:.1f} us p99.9 {:.1f} us max {:.1f} us",
+                      flow_idx,
+                      identifier,
+                      p50_us,
+                      p99_us,
+                      p999_us,
+                      max_us);
+
+    nlohmann::ordered_json j;
+    j["tx"] = tx;
+    j["rx"] = stats.rx;
+    j["loss"] = loss;
+    j["reordered"] = stats.reordered;
+    j["goodput_mbps"] = mbps;
+    j["p50_us"] = p50_us;
+    j["p99_us"] = p99_us;
+    j["p999_us"] = p999_us;
+    j["max_us"] = max_us;
+
+    return j;
+}
+
+/// format is tx_port:rx_port or tx_port:rx_port:echo_tx_port:echo_rx_port
+static flow_t get_flow_from_string(const std::string& str) {
+    std::vector<uint32_t> ports;
+
+    std::size_t pos = 0;
+    while (pos <= str.size()) {
+        const std::size_t end = std::min(str.find(':', pos), str.size());
+        ports.push_back(static_cast<uint32_t>(std::stoul(str.substr(pos, end - pos))));
+        pos = end + 1;
+    }
+
+    dectnrp_assert(ports.size() == 2 || ports.size() == 4, "flow {} ill-defined", str);
+
+    flow_t flow;
+    flow.port_tx = ports.at(0);
+    flow.port_rx = ports.at(1);
+
+    if (ports.size() == 4) {
+        flow.has_echo = true;
+        flow.port_echo_tx = ports.at(2);
+        flow.port_echo_rx = ports.at(3);
+    }
+
+    return flow;
+}
+
+int main(int argc, char** argv) {
+    // register signal handler
+    signal(SIGINT, signal_handler);
+
+    dectnrp_print_inf("load started at: {}", dectnrp::common::watch_t::get_date_and_time());
+
+    // create parser
+    argparse::ArgumentParser argparse("load");
+
+    argparse.add_argument("-f", "--flow")
+        .default_value(std::vector<std::string>{"8000:8150"})
+        .append()
+        .help("tx_port:rx_port[:echo_tx_port:echo_rx_port], repeat for concurrent flows");
+
+    argparse.add_argument("-m", "--mode")
+        .default_value(std::string{"cbr"})
+        .help("pacing of every flow, cbr, poisson or bursty");
+
+    argparse.add_argument("-r", "--rate")
+        .default_value(double{100.0})
+        .help("average number of datagrams per second and flow")
+        .scan<'g', double>();
+
+    argparse.add_argument("-b", "--burst")
+        .default_value(int64_t{10})
+        .help("number of back-to-back datagrams in bursty mode")
+        .scan<'i', int64_t>();
+
+    argparse.add_argument("-s", "--size")
+        .default_value(int64_t{100})
+        .help("datagram size in byte")
+        .scan<'i', int64_t>();
+
+    argparse.add_argument("-d", "--duration")
+        .default_value(int64_t{10})
+        .help("transmission duration in seconds")
+        .scan<'i', int64_t>();
+
+    argparse.add_argument("-i", "--ip")
+        .default_value(std::string{"127.0.0.1"})
+        .help("IP address of the SDR");
+
+    argparse.add_argument("-j", "--json")
+        .default_value(std::string{""})
+        .help("filename of JSON export, no export if empty");
+
+    try {
+        argparse.parse_args(argc, argv);
+    } catch (const std::exception& err) {
+        dectnrp_assert_failure("unable to parse arguments");
+        return EXIT_FAILURE;
+    }
+
+    const auto mode = dectnrp::apps::pacer_t::get_mode_from_string(argparse.get<std::string>("-m"));
+    const double rate = argparse.get<double>("-r");
+    const int64_t burst_size_64 = argparse.get<int64_t>("-b");
+    const int64_t size_64 = argparse.get<int64_t>("-s");
+    const std::string ip = argparse.get<std::string>("-i");
+    const std::string json_filename = argparse.get<std::string>("-j");
+    duration_sec_64 = argparse.get<int64_t>("-d");
+
+    dectnrp_assert(0.0 < rate, "rate ill-defined");
+    dectnrp_assert(1 <= burst_size_64, "burst_size ill-defined");
+    dectnrp_assert(static_cast<int64_t>(sizeof(load_header_t)) <= size_64, "size too small");
+    dectnrp_assert(size_64 <= LOAD_DATAGRAM_SIZE_MAX_BYTE, "size too large");
+    dectnrp_assert(1 <= duration_sec_64, "duration ill-defined");
+
+    datagram_size = static_cast<std::size_t>(size_64);
+
+    // flows
+    const auto flow_strings = argparse.get<std::vector<std::string>>("-f");
+
+    // samples expected per flow and direction
+    const std::size_t n_samples_expected = std::min(
+        static_cast<std::size_t>(rate * static_cast<double>(duration_sec_64)) + 1,
+        static_cast<std::size_t>(LOAD_LATENCY_SAMPLES_MAX));
+
+    for (std::size_t i = 0; i < flow_strings.size(); ++i) {
+        flow_t flow = get_flow_from_string(flow_strings.at(i));
+
+        flow.conn_tx = udp.add_connection_tx(ip, flow.port_tx);
+        flow.conn_rx = udp.add_connection_rx("127.0.0.1", flow.port_rx, 0);
+        flow.oneway.latency_ns.reserve(n_samples_expected);
+
+        if (flow.has_echo) {
+            flow.conn_echo_tx = udp.add_connection_tx(ip, flow.port_echo_tx);
+            flow.conn_echo_rx = udp.add_connection_rx("127.0.0.1", flow.port_echo_rx, 0);
+            flow.roundtrip.latency_ns.reserve(n_samples_expected);
+        }
+
+        flow.pacer = dectnrp::apps::pacer_t(
+            mode, rate, static_cast<uint32_t>(burst_size_64), static_cast<uint32_t>(i + 1));
+
+        dectnrp_print_inf("flow {} {} {}", i, flow_strings.at(i), flow.has_echo ? "rtt" : "");
+
+        flows.push_back(std::move(flow));
+    }
+
+    // core and priority of threads, start with sudo if elevated
+    dectnrp::common::threads_core_prio_config_t threads_core_prio_config;
+    threads_core_prio_config.prio_offset = LOAD_RUN_WITH_THREAD_PRIORITY_OFFSET;
+
+    // start receiving before transmitting
+    threads_core_prio_config.cpu_core = LOAD_RX_RUN_ON_CORE;
+    if (!dectnrp::common::threads_new_rt_mask_custom(
+            &rx_thread, &rx_thread_routine, NULL, threads_core_prio_config)) {
+        dectnrp_print_wrn("Unable to start rx_thread.");
+        return EXIT_FAILURE;
+    }
+
+    dectnrp::common::watch_t watch;
+
+    threads_core_prio_config.cpu_core = LOAD_TX_RUN_ON_CORE;
+    if (!dectnrp::common::threads_new_rt_mask_custom(
+            &tx_thread, &tx_thread_routine, NULL, threads_core_prio_config)) {
+        dectnrp_print_wrn("Unable to start tx_thread.");
+        return EXIT_FAILURE;
+    }
+
+    // ctrl+c or duration
+    while (!ctrl_c_pressed.load(std::memory_order_acquire) &&
+           watch.get_elapsed<int64_t, dectnrp::common::seconds>() < duration_sec_64) {
+        dectnrp::common::watch_t::sleep<dectnrp::common::milli>(250);
+    }
+
+    tx_stop.store(true, std::memory_order_release);
+    pthread_join(tx_thread, NULL);
+
+    const double elapsed_sec =
+        static_cast<double>(watch.get_elapsed<int64_t, dectnrp::common::micro>()) / 1.0e6;
+
+    // collect datagrams still in flight
+    dectnrp::common::watch_t::sleep<dectnrp::common::milli>(LOAD_RX_DRAIN_MS);
+
+    rx_stop.store(true, std::memory_order_release);
+    pthread_join(rx_thread, NULL);
+
+    nlohmann::ordered_json j;
+    j["mode"] = dectnrp::apps::pacer_t::get_string_from_mode(mode);
+    j["rate"] = rate;
+    j["burst_size"] = burst_size_64;
+    j["datagram_size"] = datagram_size;
+    j["elapsed_sec"] = elapsed_sec;
+
+    for (std::size_t i = 0; i < flows.size(); ++i) {
+        auto& flow = flows.at(i);
+
+        nlohmann::ordered_json j_flow;
+        j_flow["flow"] = flow_strings.at(i);
+        j_flow["oneway"] = report_direction("oneway", i, flow.tx, flow.oneway, elapsed_sec);
+
+        if (flow.has_echo) {
+            j_flow["roundtrip"] =
+                report_direction("roundtrip", i, flow.tx, flow.roundtrip, elapsed_sec);
+        }
+
+        j["flows"].push_back(j_flow);
+    }
+
+    if (!json_filename.empty()) {
+        dectnrp::common::json_export_t::write_to_disk(j, json_filename);
+    }
+
+    dectnrp_print_inf("load stopped at: {}", dectnrp::common::watch_t::get_date_and_time());
+
+    return EXIT_SUCCESS;
+}
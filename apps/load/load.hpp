@@ -0,0 +1,38 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+/// priority and core of TX and RX thread, -1 means no elevated priority and no fixed core
+#define LOAD_RUN_WITH_THREAD_PRIORITY_OFFSET -1
+#define LOAD_TX_RUN_ON_CORE -1
+#define LOAD_RX_RUN_ON_CORE -1
+
+/// limits of a single datagram, the lower limit is given by the load header
+#define LOAD_DATAGRAM_SIZE_MAX_BYTE 65507
+
+/// timeout of poll() in the RX thread, also the resolution of the stop condition
+#define LOAD_RX_POLL_TIMEOUT_MS 100
+
+/// after the last transmission, keep receiving for this long to collect datagrams in flight
+#define LOAD_RX_DRAIN_MS 1000
+
+/// upper limit of latency samples kept per flow and direction
+#define LOAD_LATENCY_SAMPLES_MAX 10000000
@@ -25,6 +25,7 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "dectnrp/application/queue/queue.hpp"
@@ -92,6 +93,9 @@ class application_t {
         /// one queue per connection
         std::vector<std::unique_ptr<queue_t>> queue_vec;
 
+        /// one gauge per queue, kind distinguishes servers and clients with the same id
+        void register_metrics(const std::string& kind) const;
+
         /// actual work done in work_thread + work_spawn(), sc = server client
         virtual void work_sc() = 0;
 
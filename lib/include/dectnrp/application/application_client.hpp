@@ -20,7 +20,11 @@
 
 #pragma once
 
+#include <array>
+
 #include "dectnrp/application/application.hpp"
+#include "dectnrp/application/queue/datagram_ref.hpp"
+#include "dectnrp/common/thread/pinnable.hpp"
 
 #define APPLICATION_APP_CLIENT_CONDITION_VARIABLE_OR_BUSY_WAITING
 #ifdef APPLICATION_APP_CLIENT_CONDITION_VARIABLE_OR_BUSY_WAITING
@@ -58,6 +62,22 @@ class application_client_t : public application_t {
                                                  const uint8_t* inp,
                                                  const uint32_t n) = 0;
 
+        /**
+         * \brief Zero-copy alternative to write_nto(). Only a reference to inp is queued, and owner
+         * is pinned until the datagram has been forwarded by the client thread. If the pin budget
+         * of the owner is exhausted, inp is copied as in write_nto().
+         *
+         * \param conn_idx
+         * \param inp source, for instance user plane data in a HARQ buffer
+         * \param n
+         * \param owner owner of inp, caller must hold a pin
+         * \return either 0 if the queue is full, or n
+         */
+        [[nodiscard]] virtual uint32_t write_ref_nto(const uint32_t conn_idx,
+                                                     const uint8_t* inp,
+                                                     const uint32_t n,
+                                                     common::pinnable_t* owner) = 0;
+
         void trigger_forward_nto(const uint32_t datagram_cnt);
 
     protected:
@@ -80,13 +100,27 @@ class application_client_t : public application_t {
          */
         [[nodiscard]] virtual bool filter_egress_datagram(const uint32_t conn_idx) = 0;
 
+        /**
+         * \brief Every deriving class must forward a batch of egress datagrams, ideally with a
+         * single system call.
+         *
+         * \param conn_idx
+         * \param batch views of datagrams still held by the queue
+         * \param n number of datagrams in batch
+         * \return number of datagrams forwarded
+         */
+        [[nodiscard]] virtual uint32_t write_immediate_batch(const uint32_t conn_idx,
+                                                             const datagram_ref_t* batch,
+                                                             const uint32_t n) = 0;
+
         void inc_indicator_cnt_under_lock(const uint32_t datagram_cnt);
-        void dec_indicator_cnt_under_lock();
+        void dec_indicator_cnt_under_lock(const uint32_t datagram_cnt);
         [[nodiscard]] uint32_t get_indicator_cnt_under_lock();
 
         void forward_under_lock();
 
-        [[nodiscard]] virtual uint32_t copy_from_queue_to_localbuffer(const uint32_t conn_idx) = 0;
+        /// views of the datagrams forwarded with the next system call
+        std::array<datagram_ref_t, limits::application_max_client_batch> datagram_batch;
 };
 
 }  // namespace dectnrp::application
@@ -20,18 +20,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <optional>
 #include <vector>
 
-#define APPLICATION_QUEUE_QUEUE_MUTEX_OR_SPINLOCK
-#ifdef APPLICATION_QUEUE_QUEUE_MUTEX_OR_SPINLOCK
-#include <mutex>
-#else
-#include "dectnrp/common/thread/spinlock.hpp"
-#endif
-
+#include "dectnrp/application/queue/datagram_ref.hpp"
 #include "dectnrp/application/queue/queue_level.hpp"
 #include "dectnrp/application/queue/queue_size.hpp"
+#include "dectnrp/common/thread/pinnable.hpp"
+#include "dectnrp/constants.hpp"
 
 namespace dectnrp::application {
 
@@ -43,6 +41,16 @@ class queue_t {
          * can be written to this class or read from it. Furthermore, classes can request the
          * current status of each instance of queue_t.
          *
+         * Each queue has exactly one producer and one consumer. For servers, the producer is the
+         * thread of application_server_t and the consumer is the firmware. For clients, it is the
+         * other way around. Therefore, the queue is implemented as a lock-free single-producer
+         * single-consumer ring buffer. Neither side ever blocks, so the *_nto() and *_try()
+         * functions are identical and only kept for compatibility of the interfaces.
+         *
+         * Datagrams are either copied into the queue, or the queue holds a reference to external
+         * memory which is pinned until the datagram has been consumed. The consumer can peek at
+         * multiple datagrams and forward them in a single batch before popping them.
+         *
          * \param queue_size_
          */
         explicit queue_t(const queue_size_t queue_size_);
@@ -56,8 +64,8 @@ class queue_t {
 
         /**
          * \brief Get current level of the last n datagrams. The level is the number of bytes
-         * written in a datagram. If less than n datagrams are held, return less than n. Function
-         * is thread-safe and waits for the lock indefinitely, i.e. with no timeout (nto).
+         * written in a datagram. If less than n datagrams are held, return less than n. Must be
+         * called by the consumer. Wait-free.
          *
          * \param n number of oldest datagrams to consider
          * \return
@@ -67,8 +75,7 @@ class queue_t {
 
         /**
          * \brief Write a new datagram to the queue. If all internal datagrams slots are used, data
-         * is not written. Function is thread-safe and waits for the lock indefinitely, i.e. with no
-         * timeout (nto).
+         * is not written. Must be called by the producer. Wait-free.
          *
          * \param inp source
          * \param n number of bytes, i.e. level
@@ -78,9 +85,24 @@ class queue_t {
         [[nodiscard]] uint32_t write_try(const uint8_t* inp, const uint32_t n);
 
         /**
-         * \brief Copy binary data of oldest datagram to dst. With no timeout means that we wait for
-         * the lock indefinitely. Function is thread-safe and waits for the lock indefinitely, i.e.
-         * with no timeout (nto).
+         * \brief Write a reference to a datagram in external memory without copying it, for
+         * instance to a transport block in a HARQ buffer. The owner of the memory is pinned until
+         * the consumer has read the datagram. If the owner cannot be pinned because its pin budget
+         * is exhausted, the datagram is copied instead. Must be called by the producer while it
+         * holds a pin on the owner. Wait-free.
+         *
+         * \param inp source, must remain valid until the owner is unpinned
+         * \param n number of bytes, i.e. level
+         * \param owner pinned by the queue if the datagram is written and not copied
+         * \return either 0 is all internal datagram slots are used, or n
+         */
+        [[nodiscard]] uint32_t write_ref_nto(const uint8_t* inp,
+                                             const uint32_t n,
+                                             common::pinnable_t* owner);
+
+        /**
+         * \brief Copy binary data of oldest datagram to dst. Must be called by the consumer.
+         * Wait-free.
          *
          * \param dst if set to nullptr oldest datagram is invalidated, i.e. read without copying
          * \return number of bytes read
@@ -88,29 +110,66 @@ class queue_t {
         [[nodiscard]] uint32_t read_nto(uint8_t* dst);
         [[nodiscard]] uint32_t read_try(uint8_t* dst);
 
+        /**
+         * \brief Get views of the oldest datagrams without copying or consuming them. Must be
+         * called by the consumer. Wait-free.
+         *
+         * \param dst array of at least n views
+         * \param n maximum number of datagrams
+         * \return number of views written to dst
+         */
+        [[nodiscard]] uint32_t peek_nto(datagram_ref_t* dst, const uint32_t n) const;
+
+        /**
+         * \brief Consume the n oldest datagrams, for instance after peeking. Owners of referenced
+         * datagrams are unpinned. Must be called by the consumer. Wait-free.
+         *
+         * \param n number of datagrams, must not exceed the number of datagrams held
+         */
+        void pop_nto(const uint32_t n);
+
+        /// discards all datagrams, must be called by the consumer or while the consumer is idle
         void clear();
 
+        /// number of datagrams held, can be called by any thread but may be outdated
+        [[nodiscard]] uint32_t get_nof_datagrams_any() const;
+
         const queue_size_t queue_size;
 
     private:
-        uint32_t w_idx{0};
-        uint32_t r_idx{0};
+        /// producer side, w_idx is only written by the producer
+        alignas(constants::cache_line_size_byte) std::atomic<uint32_t> w_idx{0};
 
-#ifdef APPLICATION_QUEUE_QUEUE_MUTEX_OR_SPINLOCK
-        mutable std::mutex lockv;
-#else
-        mutable common::spinlock_t lockv;
-#endif
+        /// producer's last known value of r_idx, refreshed only if the queue appears full
+        uint32_t r_idx_cached{0};
 
-        std::vector<uint8_t*> datagram_vec;
+        /// consumer side, r_idx is only written by the consumer
+        alignas(constants::cache_line_size_byte) std::atomic<uint32_t> r_idx{0};
+
+        /// consumer's last known value of w_idx, refreshed only if the queue appears empty
+        mutable uint32_t w_idx_cached{0};
+
+        /// read-only after construction, separated from the indices to avoid false sharing
+        alignas(constants::cache_line_size_byte) std::vector<uint8_t*> datagram_vec;
         std::vector<uint32_t> datagram_level_vec;
 
-        [[nodiscard]] queue_level_t get_queue_level_under_lock(const uint32_t n) const;
-        [[nodiscard]] uint32_t write_under_lock(const uint8_t* inp, const uint32_t n);
-        [[nodiscard]] uint32_t read_under_lock(uint8_t* dst);
+        /// datagrams are read from here, points either to datagram_vec or to external memory
+        std::vector<const uint8_t*> datagram_ptr_vec;
+
+        /// owner of external memory, nullptr if the datagram was copied to datagram_vec
+        std::vector<common::pinnable_t*> datagram_owner_vec;
+
+        uint32_t get_next_idx(const uint32_t idx) const {
+            return idx + 1 == queue_size.N_datagram ? 0 : idx + 1;
+        }
+
+        [[nodiscard]] uint32_t get_used(const uint32_t w_idx_, const uint32_t r_idx_) const;
+
+        /// returns index of slot to write to, or none if all slots are used
+        [[nodiscard]] std::optional<uint32_t> get_w_idx_if_not_full();
 
-        [[nodiscard]] uint32_t get_free() const;
-        [[nodiscard]] uint32_t get_used() const;
+        /// unpins owner of external memory, if any
+        void release_slot(const uint32_t idx);
 };
 
 }  // namespace dectnrp::application
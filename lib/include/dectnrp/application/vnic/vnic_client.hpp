@@ -51,12 +51,17 @@ class vnic_client_t final : public application_client_t, public vnic_t {
         [[nodiscard]] uint32_t write_try(const uint32_t conn_idx,
                                          const uint8_t* inp,
                                          const uint32_t n) override final;
+        [[nodiscard]] uint32_t write_ref_nto(const uint32_t conn_idx,
+                                             const uint8_t* inp,
+                                             const uint32_t n,
+                                             common::pinnable_t* owner) override final;
 
     private:
         bool filter_egress_datagram(const uint32_t conn_idx) override final;
 
-        [[nodiscard]] uint32_t copy_from_queue_to_localbuffer(
-            const uint32_t conn_idx) override final;
+        [[nodiscard]] uint32_t write_immediate_batch(const uint32_t conn_idx,
+                                                     const datagram_ref_t* batch,
+                                                     const uint32_t n) override final;
 
         const int tuntap_fd;
 };
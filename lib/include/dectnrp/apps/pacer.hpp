@@ -0,0 +1,85 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace dectnrp::apps {
+
+/**
+ * \brief Generates departure times of datagrams for a load generator. The average rate is the same
+ * for all modes, only the distribution of the inter-departure times differs.
+ */
+class pacer_t {
+    public:
+        enum class mode_t {
+            /// constant bit rate, fixed inter-departure time
+            cbr,
+            /// exponentially distributed inter-departure times
+            poisson,
+            /// burst_size datagrams back-to-back, bursts with constant spacing
+            bursty
+        };
+
+        pacer_t() = default;
+
+        /**
+         * \brief
+         *
+         * \param mode_ distribution of inter-departure times
+         * \param rate_ average number of datagrams per second
+         * \param burst_size_ number of back-to-back datagrams, only used in bursty mode
+         * \param seed seed for poisson mode
+         */
+        pacer_t(const mode_t mode_,
+                const double rate_,
+                const uint32_t burst_size_,
+                const uint32_t seed);
+
+        static constexpr int64_t mega{1000000};
+
+        /// set the first departure time, returns the same value
+        int64_t set_start_us(const int64_t start_us_64);
+
+        /// next departure time in microseconds, always monotonically increasing
+        int64_t get_next_us();
+
+        [[nodiscard]] static mode_t get_mode_from_string(const std::string& str);
+        [[nodiscard]] static std::string get_string_from_mode(const mode_t mode);
+
+    private:
+        mode_t mode{mode_t::cbr};
+        double rate{1.0};
+        uint32_t burst_size{1};
+
+        /// next departure time as double to avoid accumulating rounding errors
+        double next_us{};
+
+        /// position within current burst
+        uint32_t burst_cnt{};
+
+        std::mt19937 gen;
+        std::exponential_distribution<double> exp_dist;
+};
+
+}  // namespace dectnrp::apps
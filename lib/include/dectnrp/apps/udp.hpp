@@ -48,6 +48,9 @@ class udp_t {
         ssize_t tx(const std::size_t idx, const uint8_t* buffer, const std::size_t buffer_len);
         ssize_t rx(const std::size_t idx, const uint8_t* buffer, const std::size_t buffer_len);
 
+        /// file descriptor of an RX connection, e.g. to poll() multiple connections at once
+        int get_socket_fd_rx(const std::size_t idx) const { return conn_rx.at(idx).socked_fd; };
+
         template <typename Res = common::micro, typename Clock = common::utc_clock>
         ssize_t tx_timed(const std::size_t idx,
                          const uint8_t* buffer,
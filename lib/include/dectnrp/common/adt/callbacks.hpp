@@ -24,11 +24,10 @@
 #include <array>
 #include <cstdint>
 #include <functional>
-#include <iterator>
-#include <limits>
 #include <optional>
 #include <type_traits>
 
+#include "dectnrp/common/adt/timer_wheel.hpp"
 #include "dectnrp/common/prog/assert.hpp"
 #include "dectnrp/limits.hpp"
 
@@ -37,7 +36,11 @@ namespace dectnrp::common::adt {
 template <typename R, typename... Args>
 class callbacks_t {
     public:
-        callbacks_t() = default;
+        callbacks_t() {
+            for (size_t i = 0; i < free_idx.size(); ++i) {
+                free_idx[i] = free_idx.size() - 1 - i;
+            }
+        };
 
         /// signature every callback must adhere to, however, callbacks may not use all arguments
         /// https://stackoverflow.com/questions/29609866/stdbind-makes-no-sense-to-me-whatsoever
@@ -50,40 +53,42 @@ class callbacks_t {
                                            const int64_t period_64) {
             dectnrp_assert(!is_in_callback, "changing callback from callback");
 
-            auto it = std::find_if(callbacks.begin(), callbacks.end(), [](const auto& elem) {
-                return elem.cb == nullptr;
-            });
-
-            if (it == callbacks.end()) {
+            if (free_cnt == 0) {
                 return std::nullopt;
             }
 
-            it->cb = callback;
-            it->next_64 = next_64;
-            it->period_64 = period_64;
+            const size_t idx = free_idx[--free_cnt];
 
-            set_it_next();
+            callbacks[idx].cb = callback;
+            callbacks[idx].period_64 = period_64;
 
-            return std::distance(std::begin(callbacks), it);
+            wheel.insert(idx, next_64);
+
+            return idx;
         }
 
         /// https://stackoverflow.com/questions/20833453/comparing-stdfunctions-for-equality
         void rm_callback(const size_t idx) {
             dectnrp_assert(!is_in_callback, "changing callback from callback");
-            callbacks.at(idx).cb = callback_entry_t();
-            set_it_next();
+            dectnrp_assert(callbacks.at(idx).cb != nullptr, "callback not added");
+            callbacks.at(idx) = callback_entry_t();
+            wheel.cancel(idx);
+            free_idx[free_cnt++] = idx;
         }
 
         void update_next(const size_t idx, const size_t next_64) {
             dectnrp_assert(!is_in_callback, "changing callback from callback");
-            callbacks.at(idx).next_64 = next_64;
-            set_it_next();
+            dectnrp_assert(callbacks.at(idx).cb != nullptr, "callback not added");
+            wheel.cancel(idx);
+            wheel.insert(idx, next_64);
         }
 
         void adjust_next(const size_t idx, const size_t next_adjustment_64) {
             dectnrp_assert(!is_in_callback, "changing callback from callback");
-            callbacks.at(idx).next_64 += next_adjustment_64;
-            set_it_next();
+            dectnrp_assert(callbacks.at(idx).cb != nullptr, "callback not added");
+            const int64_t next_64 = wheel.get_due(idx) + next_adjustment_64;
+            wheel.cancel(idx);
+            wheel.insert(idx, next_64);
         }
 
         void update_period(const size_t idx, const size_t period_64) {
@@ -96,28 +101,37 @@ class callbacks_t {
             callbacks.at(idx).period_64 += period_adjustment_64;
         }
 
+        /**
+         * \brief Time the next callback is due, can be used to request an irregular call exactly
+         * when run() has work to do.
+         *
+         * \return time in samples, std::numeric_limits<int64_t>::max() if no callback was added
+         */
+        [[nodiscard]] int64_t get_next_64() const { return wheel.get_next_due(); };
+
         R run(const int64_t now_64, Args... args)
             requires(std::is_same_v<R, void>)
         {
             is_in_callback = true;
 
-            while (it_next->next_64 <= now_64) {
-                dectnrp_assert(now_64 < it_next->next_64 + it_next->period_64, "callback skipped");
+            wheel.advance(std::max(now_64, wheel.get_now()));
+
+            while (const auto idx = wheel.pop_expired()) {
+                int64_t next_64 = wheel.get_due(*idx);
+                callback_entry_t& entry = callbacks[*idx];
+
+                dectnrp_assert(now_64 < next_64 + entry.period_64, "callback skipped");
 
-                it_next->cb(now_64,
-                            std::distance(std::begin(callbacks), it_next),
-                            it_next->next_64,
-                            it_next->period_64,
-                            args...);
+                entry.cb(now_64, *idx, next_64, entry.period_64, args...);
 
-                dectnrp_assert(it_next->next_64 > 0, "next must be positive");
-                dectnrp_assert(it_next->period_64 > 0, "period must be positive");
+                dectnrp_assert(next_64 > 0, "next must be positive");
+                dectnrp_assert(entry.period_64 > 0, "period must be positive");
 
-                it_next->next_64 += it_next->period_64;
+                next_64 += entry.period_64;
 
-                dectnrp_assert(now_64 < it_next->next_64, "adjusted period before now_64");
+                dectnrp_assert(now_64 < next_64, "adjusted period before now_64");
 
-                set_it_next();
+                wheel.insert(*idx, next_64);
             }
 
             is_in_callback = false;
@@ -130,23 +144,24 @@ class callbacks_t {
 
             std::optional<R> ret{std::nullopt};
 
-            while (it_next->next_64 <= now_64) {
-                dectnrp_assert(now_64 < it_next->next_64 + it_next->period_64, "callback skipped");
+            wheel.advance(std::max(now_64, wheel.get_now()));
 
-                ret = it_next->cb(now_64,
-                                  std::distance(std::begin(callbacks), it_next),
-                                  it_next->next_64,
-                                  it_next->period_64,
-                                  args...);
+            while (const auto idx = wheel.pop_expired()) {
+                int64_t next_64 = wheel.get_due(*idx);
+                callback_entry_t& entry = callbacks[*idx];
 
-                dectnrp_assert(it_next->next_64 > 0, "next must be positive");
-                dectnrp_assert(it_next->period_64 > 0, "period must be positive");
+                dectnrp_assert(now_64 < next_64 + entry.period_64, "callback skipped");
 
-                it_next->next_64 += it_next->period_64;
+                ret = entry.cb(now_64, *idx, next_64, entry.period_64, args...);
 
-                dectnrp_assert(now_64 < it_next->next_64, "adjusted period before now_64");
+                dectnrp_assert(next_64 > 0, "next must be positive");
+                dectnrp_assert(entry.period_64 > 0, "period must be positive");
 
-                set_it_next();
+                next_64 += entry.period_64;
+
+                dectnrp_assert(now_64 < next_64, "adjusted period before now_64");
+
+                wheel.insert(*idx, next_64);
             }
 
             is_in_callback = false;
@@ -157,26 +172,22 @@ class callbacks_t {
     private:
         struct callback_entry_t {
                 cb_t cb{nullptr};
-                int64_t next_64{std::numeric_limits<int64_t>::max()};
                 int64_t period_64{0};
         };
 
         std::array<callback_entry_t, limits::max_callbacks> callbacks;
 
-        /// index of next callback, so we don't have to search the array with every call of run()
-        decltype(callbacks.begin()) it_next{nullptr};
+        /// indices of callbacks not in use
+        std::array<size_t, limits::max_callbacks> free_idx;
+        size_t free_cnt{limits::max_callbacks};
 
-        /// update time and index of next callback to call
-        void set_it_next() {
-            it_next =
-                std::min_element(callbacks.begin(), callbacks.end(), [](auto& lhs, auto& rhs) {
-                    return lhs.next_64 < rhs.next_64;
-                });
-        }
+        /// time each callback is due next, so we don't have to search callbacks with every call
+        timer_wheel_t<limits::max_callbacks> wheel;
 
         /**
          * \brief Removing and updating callbacks from callbacks is not possible as this would
-         * change the value of it_next. This guard variable prevents this mistake.
+         * change the state of the wheel while it is being processed. This guard variable prevents
+         * this mistake.
          */
         bool is_in_callback{false};
 };
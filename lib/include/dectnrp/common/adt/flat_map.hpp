@@ -0,0 +1,136 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "dectnrp/common/prog/assert.hpp"
+
+namespace dectnrp::common::adt {
+
+/**
+ * \brief Open addressing map from integral keys to 32-bit values, e.g. identifiers to local
+ * indices. Keys and values are stored side by side in a single array with linear probing, so a
+ * lookup usually touches one cache line and never follows a pointer. Keys are spread with a
+ * multiplicative hash. Entries can't be erased.
+ *
+ * \tparam K unsigned integral key
+ */
+template <std::unsigned_integral K>
+class flat_map_t {
+    public:
+        flat_map_t() { rehash(N_entries_min); };
+
+        /// value marking unused entries, can't be inserted
+        static constexpr uint32_t empty{std::numeric_limits<uint32_t>::max()};
+
+        void insert(const K k, const uint32_t v) noexcept {
+            dectnrp_assert(v != empty, "value reserved");
+            dectnrp_assert(!is_k_known(k), "k already known");
+
+            // keep load factor at or below 1/2
+            if (entries.size() < 2 * (cnt + 1)) {
+                rehash(2 * entries.size());
+            }
+
+            insert_unchecked(k, v);
+        }
+
+        bool is_k_known(const K k) const noexcept { return find(k) != nullptr; };
+
+        /// unknown keys terminate the program, also without assertions
+        uint32_t get_v(const K k) const noexcept {
+            dectnrp_assert(is_k_known(k), "k unknown");
+            return get_v_as_opt(k).value();
+        }
+
+        std::optional<uint32_t> get_v_as_opt(const K k) const noexcept {
+            const uint32_t* v = find(k);
+            return v != nullptr ? std::optional<uint32_t>(*v) : std::nullopt;
+        }
+
+        uint32_t get_cnt() const noexcept { return cnt; };
+
+        void reserve(const std::size_t N) {
+            if (entries.size() < 2 * N) {
+                rehash(2 * N);
+            }
+        };
+
+    private:
+        static constexpr std::size_t N_entries_min{16};
+
+        struct entry_t {
+                K k{};
+                uint32_t v{empty};
+        };
+
+        std::vector<entry_t> entries;
+        std::size_t mask;
+        uint32_t cnt{0};
+
+        /// Fibonacci hashing, upper bits of the product are used as the start index
+        std::size_t get_start(const K k) const noexcept {
+            const uint64_t h = static_cast<uint64_t>(k) * uint64_t{0x9E3779B97F4A7C15};
+            return static_cast<std::size_t>(h >> (64 - std::countr_zero(entries.size())));
+        }
+
+        const uint32_t* find(const K k) const noexcept {
+            for (std::size_t i = get_start(k);; i = (i + 1) & mask) {
+                if (entries[i].v == empty) {
+                    return nullptr;
+                }
+                if (entries[i].k == k) {
+                    return &entries[i].v;
+                }
+            }
+        }
+
+        void insert_unchecked(const K k, const uint32_t v) noexcept {
+            std::size_t i = get_start(k);
+            while (entries[i].v != empty) {
+                i = (i + 1) & mask;
+            }
+            entries[i] = entry_t{k, v};
+            ++cnt;
+        }
+
+        void rehash(const std::size_t N) {
+            std::vector<entry_t> old(std::bit_ceil(std::max(N, N_entries_min)));
+            old.swap(entries);
+            mask = entries.size() - 1;
+            cnt = 0;
+
+            for (const auto& entry : old) {
+                if (entry.v != empty) {
+                    insert_unchecked(entry.k, entry.v);
+                }
+            }
+        }
+};
+
+}  // namespace dectnrp::common::adt
@@ -0,0 +1,317 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+#include "dectnrp/common/prog/assert.hpp"
+
+namespace dectnrp::common::adt {
+
+/**
+ * \brief Hierarchical timing wheel for up to N timers on the sample time base. Every level has 64
+ * slots, a slot on level l spans 64^l samples. Timers are kept in intrusive lists, so arming and
+ * cancelling a timer is O(1) and never allocates. When advancing, the wheel jumps from one
+ * occupied slot to the next and moves the timers of higher levels down, each timer is moved at
+ * most once per level. Timers further ahead than the top level are parked on the top level and
+ * re-sorted once it is reached.
+ *
+ * \tparam N maximum number of timers, timers are identified by their index in [0, N)
+ */
+template <uint32_t N>
+class timer_wheel_t {
+    public:
+        timer_wheel_t() { clear(); };
+
+        static constexpr int64_t undefined_late{std::numeric_limits<int64_t>::max()};
+
+        void clear() {
+            for (auto& timer : timers) {
+                timer = timer_t();
+            }
+
+            heads.fill(NIL);
+            occupied.fill(0);
+            now_64 = 0;
+            next_due_64 = undefined_late;
+            next_due_valid = true;
+        }
+
+        /**
+         * \brief Arms a timer. Timers due at or before the current time of the wheel are expired
+         * right away.
+         *
+         * \param idx timer index, must not be armed
+         * \param due_64 time in samples the timer is due
+         */
+        void insert(const uint32_t idx, const int64_t due_64) {
+            dectnrp_assert(!is_armed(idx), "timer already armed");
+
+            timers[idx].due_64 = due_64;
+
+            if (due_64 <= now_64) {
+                link(idx, LIST_EXPIRED);
+            } else {
+                // timers further ahead than the top level are parked on the top level
+                const int64_t tick_64 =
+                    due_64 - now_64 <= delta_max_64 ? due_64 : now_64 + delta_max_64;
+
+                const uint32_t level =
+                    (std::bit_width(static_cast<uint64_t>(tick_64 - now_64)) - 1) / N_BITS;
+                const uint32_t slot = get_slot(level, tick_64);
+
+                link(idx, level * N_SLOTS + slot);
+
+                occupied[level] |= uint64_t{1} << slot;
+            }
+
+            if (next_due_valid && due_64 < next_due_64) {
+                next_due_64 = due_64;
+            }
+        }
+
+        /// disarms a timer, must be armed
+        void cancel(const uint32_t idx) {
+            dectnrp_assert(is_armed(idx), "timer not armed");
+
+            const uint32_t list = timers[idx].list;
+
+            unlink(idx);
+
+            if (list != LIST_EXPIRED && heads[list] == NIL) {
+                occupied[list / N_SLOTS] &= ~(uint64_t{1} << (list % N_SLOTS));
+            }
+
+            if (timers[idx].due_64 <= next_due_64) {
+                next_due_valid = false;
+            }
+        }
+
+        bool is_armed(const uint32_t idx) const { return timers.at(idx).list != LIST_NONE; };
+
+        int64_t get_due(const uint32_t idx) const { return timers.at(idx).due_64; };
+
+        int64_t get_now() const { return now_64; };
+
+        /**
+         * \brief Advances the time of the wheel. Afterwards, all timers due at or before now_64
+         * can be collected with pop_expired().
+         *
+         * \param now_64_ new time in samples, must not be in the past
+         */
+        void advance(const int64_t now_64_) {
+            dectnrp_assert(now_64 <= now_64_, "time out-of-order");
+
+            std::array<uint32_t, N_LEVELS> slot_arr;
+
+            while (true) {
+                // find the next time at which at least one slot is reached
+                int64_t start_64 = undefined_late;
+                std::array<int64_t, N_LEVELS> start_arr;
+
+                for (uint32_t level = 0; level < N_LEVELS; ++level) {
+                    start_arr[level] = get_earliest_slot_start(level, slot_arr[level]);
+                    start_64 = std::min(start_64, start_arr[level]);
+                }
+
+                if (now_64_ < start_64) {
+                    break;
+                }
+
+                now_64 = start_64;
+
+                // move timers of reached slots to lower levels or into the expired list
+                for (uint32_t level = 0; level < N_LEVELS; ++level) {
+                    if (start_arr[level] == start_64) {
+                        cascade(level, slot_arr[level]);
+                    }
+                }
+            }
+
+            now_64 = now_64_;
+        }
+
+        /// returns the expired timer with the earliest due time and disarms it
+        [[nodiscard]] std::optional<uint32_t> pop_expired() {
+            if (heads[LIST_EXPIRED] == NIL) {
+                return std::nullopt;
+            }
+
+            const uint32_t idx = get_earliest_in_list(LIST_EXPIRED);
+
+            cancel(idx);
+
+            return idx;
+        }
+
+        /// earliest due time of all armed timers, undefined_late if no timer is armed
+        [[nodiscard]] int64_t get_next_due() const {
+            if (next_due_valid) {
+                return next_due_64;
+            }
+
+            int64_t ret = undefined_late;
+
+            if (heads[LIST_EXPIRED] != NIL) {
+                ret = timers[get_earliest_in_list(LIST_EXPIRED)].due_64;
+            }
+
+            // timers in a slot are due before the start of the next slot on the same level
+            for (uint32_t level = 0; level < N_LEVELS - 1; ++level) {
+                uint32_t slot;
+                if (get_earliest_slot_start(level, slot) < ret) {
+                    const int32_t idx = get_earliest_in_list(level * N_SLOTS + slot);
+                    ret = std::min(ret, timers[idx].due_64);
+                }
+            }
+
+            // parked timers can be due later than timers in subsequent slots of the top level
+            for (uint32_t slot = 0; slot < N_SLOTS; ++slot) {
+                const uint32_t list = (N_LEVELS - 1) * N_SLOTS + slot;
+                if (heads[list] != NIL) {
+                    ret = std::min(ret, timers[get_earliest_in_list(list)].due_64);
+                }
+            }
+
+            next_due_64 = ret;
+            next_due_valid = true;
+
+            return ret;
+        }
+
+    private:
+        /// 64 slots per level, 8 levels cover 2^48 samples
+        static constexpr uint32_t N_BITS{6};
+        static constexpr uint32_t N_SLOTS{1 << N_BITS};
+        static constexpr uint32_t N_LEVELS{8};
+        static constexpr int64_t delta_max_64{(int64_t{1} << (N_BITS * N_LEVELS)) - 1};
+
+        /// lists of slots are followed by the list of expired timers
+        static constexpr uint32_t LIST_EXPIRED{N_LEVELS * N_SLOTS};
+        static constexpr uint32_t LIST_NONE{LIST_EXPIRED + 1};
+        static constexpr int32_t NIL{-1};
+
+        struct timer_t {
+                int64_t due_64{undefined_late};
+                int32_t prev{NIL};
+                int32_t next{NIL};
+                uint32_t list{LIST_NONE};
+        };
+
+        std::array<timer_t, N> timers;
+
+        /// first timer of every list
+        std::array<int32_t, LIST_EXPIRED + 1> heads;
+
+        /// one bit per slot with at least one timer
+        std::array<uint64_t, N_LEVELS> occupied;
+
+        /// time of the wheel, all timers in slots are due after now_64
+        int64_t now_64;
+
+        /// cached result of get_next_due()
+        mutable int64_t next_due_64;
+        mutable bool next_due_valid;
+
+        static uint32_t get_slot(const uint32_t level, const int64_t tick_64) {
+            return (static_cast<uint64_t>(tick_64) >> (level * N_BITS)) % N_SLOTS;
+        }
+
+        /// time at which a slot is reached next, always after now_64
+        int64_t get_slot_start(const uint32_t level, const uint32_t slot) const {
+            const int64_t span_64 = int64_t{1} << ((level + 1) * N_BITS);
+            const int64_t start_64 =
+                (now_64 & ~(span_64 - 1)) + (int64_t{slot} << (level * N_BITS));
+            return start_64 <= now_64 ? start_64 + span_64 : start_64;
+        }
+
+        int64_t get_earliest_slot_start(const uint32_t level, uint32_t& slot) const {
+            if (occupied[level] == 0) {
+                return undefined_late;
+            }
+
+            // search starts right after the slot of now_64
+            const uint32_t first = (get_slot(level, now_64) + 1) % N_SLOTS;
+            const uint32_t k = std::countr_zero(std::rotr(occupied[level], first));
+
+            slot = (first + k) % N_SLOTS;
+
+            return get_slot_start(level, slot);
+        }
+
+        uint32_t get_earliest_in_list(const uint32_t list) const {
+            int32_t ret = heads[list];
+            for (int32_t idx = timers[ret].next; idx != NIL; idx = timers[idx].next) {
+                if (timers[idx].due_64 < timers[ret].due_64) {
+                    ret = idx;
+                }
+            }
+            return ret;
+        }
+
+        void cascade(const uint32_t level, const uint32_t slot) {
+            const uint32_t list = level * N_SLOTS + slot;
+
+            int32_t idx = heads[list];
+
+            heads[list] = NIL;
+            occupied[level] &= ~(uint64_t{1} << slot);
+
+            while (idx != NIL) {
+                const int32_t next = timers[idx].next;
+                timers[idx].list = LIST_NONE;
+                insert(idx, timers[idx].due_64);
+                idx = next;
+            }
+        }
+
+        void link(const uint32_t idx, const uint32_t list) {
+            timers[idx].list = list;
+            timers[idx].prev = NIL;
+            timers[idx].next = heads[list];
+            if (heads[list] != NIL) {
+                timers[heads[list]].prev = idx;
+            }
+            heads[list] = idx;
+        }
+
+        void unlink(const uint32_t idx) {
+            timer_t& timer = timers[idx];
+            if (timer.prev != NIL) {
+                timers[timer.prev].next = timer.next;
+            } else {
+                heads[timer.list] = timer.next;
+            }
+            if (timer.next != NIL) {
+                timers[timer.next].prev = timer.prev;
+            }
+            timer.prev = NIL;
+            timer.next = NIL;
+            timer.list = LIST_NONE;
+        }
+};
+
+}  // namespace dectnrp::common::adt
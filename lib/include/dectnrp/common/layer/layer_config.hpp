@@ -52,6 +52,11 @@ class layer_config_t {
             return layer_unit_config_vec[id];
         };
 
+        /// only used before layers are initialized, e.g. to resolve automatic thread placement
+        [[nodiscard]] T& get_layer_unit_config(const std::size_t id) {
+            return layer_unit_config_vec[id];
+        };
+
     protected:
         std::string filepath;
         nlohmann::ordered_json json_parsed;
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dectnrp::metrics {
+
+/**
+ * \brief Counter which is written by one thread at a time, for instance the thread owning it or
+ * any thread holding the same lock, but can be read by any thread at any time. Incrementing is a
+ * relaxed load followed by a relaxed store, so for the writer it is as cheap as a plain integer.
+ * Every instance is one shard of a metric. Shards of the same metric are told apart by their
+ * labels and summed by the consumer.
+ */
+class counter_t {
+    public:
+        counter_t() = default;
+        counter_t(const counter_t& other)
+            : value(other.get()) {}
+        counter_t& operator=(const counter_t& other) {
+            value.store(other.get(), std::memory_order_relaxed);
+            return *this;
+        }
+
+        counter_t& operator++() {
+            value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return *this;
+        }
+
+        counter_t& operator+=(const int64_t n) {
+            value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+            return *this;
+        }
+
+        [[nodiscard]] int64_t get() const { return value.load(std::memory_order_relaxed); };
+
+        operator int64_t() const { return get(); };
+
+    private:
+        std::atomic<int64_t> value{0};
+};
+
+/**
+ * \brief Histogram with power-of-two bucket boundaries, same writer rules as counter_t. Bucket i
+ * counts values in (2^(i-1), 2^i], the last bucket counts everything larger.
+ */
+class histogram_t {
+    public:
+        histogram_t() = default;
+
+        histogram_t(const histogram_t&) = delete;
+        histogram_t& operator=(const histogram_t&) = delete;
+        histogram_t(histogram_t&&) = delete;
+        histogram_t& operator=(histogram_t&&) = delete;
+
+        static constexpr uint32_t N_bucket{24};
+
+        void observe(const int64_t value) {
+            const uint32_t idx =
+                value <= 1 ? 0 : static_cast<uint32_t>(std::bit_width(uint64_t(value - 1)));
+            increment(buckets[std::min(idx, N_bucket)], 1);
+            increment(sum, value);
+        }
+
+        [[nodiscard]] int64_t get_bucket(const uint32_t idx) const {
+            return buckets[idx].load(std::memory_order_relaxed);
+        };
+
+        [[nodiscard]] int64_t get_sum() const { return sum.load(std::memory_order_relaxed); };
+
+    private:
+        std::array<std::atomic<int64_t>, N_bucket + 1> buckets{};
+        std::atomic<int64_t> sum{0};
+
+        static void increment(std::atomic<int64_t>& a, const int64_t n) {
+            a.store(a.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+};
+
+/// pairs of label name and label value, e.g. {{"worker", "0"}}
+using labels_t = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * \brief Registration is done once during initialization, typically in the constructor of the
+ * owning object, and takes a lock. Registered objects must outlive the server. Names are prefixed
+ * with "dectnrp_", the same name can be registered multiple times with different labels.
+ *
+ * \param name
+ * \param help
+ * \param labels
+ * \param counter
+ */
+void register_counter(const std::string& name,
+                      const std::string& help,
+                      const labels_t& labels,
+                      const counter_t& counter);
+
+/// gauges are sampled by calling the getter on the server thread, so it must be thread-safe
+void register_gauge(const std::string& name,
+                    const std::string& help,
+                    const labels_t& labels,
+                    std::function<int64_t()> getter);
+
+void register_histogram(const std::string& name,
+                        const std::string& help,
+                        const labels_t& labels,
+                        const histogram_t& histogram);
+
+/// all registered metrics in Prometheus text exposition format
+[[nodiscard]] std::string get_text();
+
+/**
+ * \brief Start a thread with normal priority and no fixed core which answers every HTTP request
+ * on localhost:port with the output of get_text(). Real-time threads are never blocked by it.
+ *
+ * \param port
+ */
+void server_start(const uint32_t port);
+
+void server_stop();
+
+/// default port, e.g. curl localhost:8400/metrics
+inline constexpr uint32_t server_port{8400};
+
+}  // namespace dectnrp::metrics
+
+// clang-format off
+ #ifdef ENABLE_METRICS
+ #define dectnrp_metrics_start(port) dectnrp::metrics::server_start(port)
+ #define dectnrp_metrics_stop() dectnrp::metrics::server_stop()
+ #else
+ #define dectnrp_metrics_start(port)
+ #define dectnrp_metrics_stop()
+ #endif
+// clang-format on
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+namespace dectnrp::trace {
+
+/**
+ * \brief Stages of a packet on its way from the RX buffer through PHY and MAC to the TX buffer.
+ * Instants (chunk_ready, job_enqueue, job_dequeue) have no duration. All other stages are spans.
+ */
+enum class stage_t : uint32_t {
+    chunk_ready = 0,
+    detection,
+    job_enqueue,
+    job_dequeue,
+    token_wait,
+    demoddecod_rx_pcc,
+    work_pcc,
+    demoddecod_rx_pdc,
+    work_pdc,
+    tx_generation,
+    CARDINALITY
+};
+
+/// low overhead timestamp, unit is CPU dependent and converted to nanoseconds when saving
+[[nodiscard]] inline uint64_t get_tsc() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t cntvct;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(cntvct));
+    return cntvct;
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/**
+ * \brief Must be called before any thread records events. Allocates one ring buffer per thread
+ * up front, so that real-time threads never allocate memory when recording.
+ *
+ * \param nof_threads number of threads which will record events
+ */
+void init(const uint32_t nof_threads);
+
+/**
+ * \brief Write one event into the ring buffer of the calling thread. Upon the first call of each
+ * thread, a ring buffer preallocated by init() is assigned to it. The ring buffer overwrites the
+ * oldest events once full. No locks are taken after the first call.
+ *
+ * \param stage
+ * \param id identifies the packet by the sample time of its fine peak, for RX and TX stages alike
+ * \param tsc_begin
+ * \param tsc_end
+ */
+void record(const stage_t stage,
+            const int64_t id,
+            const uint64_t tsc_begin,
+            const uint64_t tsc_end);
+
+/// span from tsc_begin until now
+inline void record_end(const stage_t stage, const int64_t id, const uint64_t tsc_begin) {
+    record(stage, id, tsc_begin, get_tsc());
+}
+
+/// instant without duration
+inline void record_instant(const stage_t stage, const int64_t id) {
+    const uint64_t tsc = get_tsc();
+    record(stage, id, tsc, tsc);
+}
+
+/**
+ * \brief Must only be called once all threads which record events have stopped. Writes all events
+ * as a Chrome/Perfetto trace file, and logs percentiles of the duration of every stage.
+ *
+ * \param filename
+ */
+void save(const std::string& filename);
+
+}  // namespace dectnrp::trace
+
+// clang-format off
+ #ifdef ENABLE_TRACE
+ #define dectnrp_trace_init(nof_threads) dectnrp::trace::init(nof_threads)
+ #define dectnrp_trace_begin(tsc_begin) const uint64_t tsc_begin = dectnrp::trace::get_tsc()
+ #define dectnrp_trace_end(tsc_begin, stage, id) \
+     dectnrp::trace::record_end(dectnrp::trace::stage_t::stage, id, tsc_begin)
+ #define dectnrp_trace_instant(stage, id) \
+     dectnrp::trace::record_instant(dectnrp::trace::stage_t::stage, id)
+ #define dectnrp_trace_save(filename) dectnrp::trace::save(filename)
+ #else
+ #define dectnrp_trace_init(nof_threads)
+ #define dectnrp_trace_begin(tsc_begin)
+ #define dectnrp_trace_end(tsc_begin, stage, id)
+ #define dectnrp_trace_instant(stage, id)
+ #define dectnrp_trace_save(filename)
+ #endif
+// clang-format on
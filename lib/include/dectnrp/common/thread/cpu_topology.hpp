@@ -0,0 +1,97 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <string>
+#include <vector>
+
+namespace dectnrp::common {
+
+/// group of CPU cores sharing one NUMA node and one L3 cache
+struct cpu_domain_t {
+        /// -1 if the system does not report NUMA nodes
+        int numa_node{-1};
+
+        /// lowest CPU core sharing the same L3 cache, -1 if the system does not report caches
+        int l3_id{-1};
+
+        /// online CPU cores in ascending order
+        std::vector<int> cpu_cores;
+
+        [[nodiscard]] bool is_valid() const { return !cpu_cores.empty(); };
+
+        [[nodiscard]] std::string get_string() const;
+};
+
+class cpu_topology_t {
+    public:
+        /**
+         * \brief Reads the CPU topology from sysfs and groups all CPU cores the process is allowed
+         * to run on into domains with the same NUMA node and the same L3 cache. If sysfs is
+         * incomplete, all cores are put into a single domain.
+         *
+         * \param sysfs_cpu_path path to the CPU directory in sysfs, only changed for tests
+         */
+        explicit cpu_topology_t(const std::string sysfs_cpu_path = "/sys/devices/system/cpu");
+
+        /// domains sorted by NUMA node and L3 cache
+        [[nodiscard]] const std::vector<cpu_domain_t>& get_domains() const { return domains; };
+
+        /**
+         * \brief Converts the kernel's CPU list format, for instance "0-3,8,10-11".
+         *
+         * \param cpu_list comma-separated list of single cores and ranges
+         * \return cores in ascending order, empty if the list is malformed
+         */
+        static std::vector<int> get_cpu_cores(const std::string& cpu_list);
+
+    private:
+        std::vector<cpu_domain_t> domains;
+};
+
+/**
+ * \brief While an instance exists, the calling thread runs only on the cores of a CPU domain and
+ * prefers memory on the domain's NUMA node. Memory first touched within the scope, for instance
+ * buffers that are zeroed during construction, is therefore placed close to the threads processing
+ * it. The previous affinity and the default memory policy are restored on destruction. An invalid
+ * domain leaves the thread unchanged.
+ */
+class cpu_domain_scope_t {
+    public:
+        explicit cpu_domain_scope_t(const cpu_domain_t& cpu_domain);
+        ~cpu_domain_scope_t();
+
+        cpu_domain_scope_t() = delete;
+        cpu_domain_scope_t(const cpu_domain_scope_t&) = delete;
+        cpu_domain_scope_t& operator=(const cpu_domain_scope_t&) = delete;
+        cpu_domain_scope_t(cpu_domain_scope_t&&) = delete;
+        cpu_domain_scope_t& operator=(cpu_domain_scope_t&&) = delete;
+
+    private:
+        bool affinity_changed{false};
+        bool mempolicy_changed{false};
+        cpu_set_t cpuset_previous;
+};
+
+}  // namespace dectnrp::common
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "dectnrp/constants.hpp"
+
+namespace dectnrp::common {
+
+/**
+ * \brief Lock-free LIFO of indices in the range [0, capacity). Used by pools to hand out
+ * preallocated objects without scanning all of them. An index is pushed by the thread releasing an
+ * object and popped by any thread acquiring one. The head contains a tag in its upper 32 bits which
+ * is incremented on every change to avoid the ABA problem.
+ */
+class free_list_t {
+    public:
+        /**
+         * \brief Initially, all indices are free.
+         *
+         * \param capacity_ number of indices managed
+         */
+        explicit free_list_t(const uint32_t capacity_);
+        ~free_list_t() = default;
+
+        free_list_t() = delete;
+        free_list_t(const free_list_t&) = delete;
+        free_list_t& operator=(const free_list_t&) = delete;
+        free_list_t(free_list_t&&) = delete;
+        free_list_t& operator=(free_list_t&&) = delete;
+
+        /// index of a free object, or none if all objects are in use
+        [[nodiscard]] std::optional<uint32_t> pop();
+
+        /// must only be called with an index previously returned by pop()
+        void push(const uint32_t idx);
+
+        [[nodiscard]] uint32_t get_capacity() const { return capacity; };
+
+    private:
+        static constexpr uint32_t idx_none{UINT32_MAX};
+        static constexpr uint64_t idx_mask{0xffffffff};
+
+        const uint32_t capacity;
+
+        /// next free index for every index, only valid while the index is part of the list
+        std::vector<std::atomic<uint32_t>> next;
+
+        alignas(constants::cache_line_size_byte) std::atomic<uint64_t> head;
+};
+
+}  // namespace dectnrp::common
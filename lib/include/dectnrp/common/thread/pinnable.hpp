@@ -0,0 +1,109 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace dectnrp::common {
+
+/**
+ * \brief Upper limit for the number of pins held by others on a group of pinnable objects, for
+ * instance on all RX processes of a HARQ process pool. Without a limit, a slow consumer could pin
+ * every object of the group, and the group's owner would run out of objects.
+ */
+class pin_budget_t {
+    public:
+        explicit pin_budget_t(const uint32_t nof_pins_max_)
+            : nof_pins_max(nof_pins_max_) {};
+        ~pin_budget_t() = default;
+
+        pin_budget_t() = delete;
+        pin_budget_t(const pin_budget_t&) = delete;
+        pin_budget_t& operator=(const pin_budget_t&) = delete;
+        pin_budget_t(pin_budget_t&&) = delete;
+        pin_budget_t& operator=(pin_budget_t&&) = delete;
+
+        /// false if nof_pins_max pins are held already
+        [[nodiscard]] bool try_acquire();
+
+        void release();
+
+        /// number of pins held, can be called by any thread but may be outdated
+        [[nodiscard]] uint32_t get_nof_pins() const;
+
+        const uint32_t nof_pins_max;
+
+    private:
+        std::atomic<uint32_t> nof_pins{0};
+};
+
+/**
+ * \brief Object whose memory may still be referenced by other threads after its owner is done with
+ * it, for instance a transport block in a HARQ buffer which is handed to an application without
+ * copying. The owner holds an initial pin. Every additional reference pins the object, and the last
+ * pin removed, either by the owner or by any other thread, calls unpinned_func().
+ *
+ * If the object is part of a group with a pin budget, every pin held by others counts against that
+ * budget. try_pin() fails once the budget is exhausted, and the caller then has to copy instead.
+ */
+class pinnable_t {
+    public:
+        pinnable_t() = default;
+        virtual ~pinnable_t() = default;
+
+        pinnable_t(const pinnable_t&) = delete;
+        pinnable_t& operator=(const pinnable_t&) = delete;
+        pinnable_t(pinnable_t&&) = delete;
+        pinnable_t& operator=(pinnable_t&&) = delete;
+
+        /**
+         * \brief Must only be called while the caller, or the owner on behalf of the caller, holds
+         * a pin. A successful call must be followed by exactly one call of unpin().
+         *
+         * \return false if the pin budget is exhausted, the object is then not pinned
+         */
+        [[nodiscard]] bool try_pin();
+
+        /// removes a pin acquired with try_pin()
+        void unpin();
+
+        /// removes the initial pin of the owner
+        void unpin_owner();
+
+        /// true if anybody but the owner holds a pin
+        [[nodiscard]] bool is_pinned_by_others() const;
+
+    protected:
+        /// called exactly once when the last pin is removed
+        virtual void unpinned_func() = 0;
+
+        /// optional, shared with the other objects of the same group
+        pin_budget_t* pin_budget{nullptr};
+
+    private:
+        std::atomic<uint32_t> pin_cnt{1};
+
+        /// the last pin removed restores the initial pin of the owner and calls unpinned_func()
+        void remove_pin();
+};
+
+}  // namespace dectnrp::common
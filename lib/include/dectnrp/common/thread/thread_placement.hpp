@@ -0,0 +1,79 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "dectnrp/common/thread/cpu_topology.hpp"
+#include "dectnrp/common/thread/threads.hpp"
+
+namespace dectnrp::common {
+
+/**
+ * \brief Automatic thread placement. Threads that belong together, for instance all threads
+ * processing the samples of one radio device, are added as one group. Every group is assigned one
+ * CPU domain, and every thread of the group with cpu_core set to
+ * threads_core_prio_config_t::cpu_core_auto is assigned a core of that domain. Groups are spread
+ * across domains by the number of threads per core already placed. Threads with a fixed core or no
+ * core are left unchanged, but fixed cores count as occupied for all threads placed afterwards.
+ */
+class thread_placement_t {
+    public:
+        explicit thread_placement_t(const cpu_topology_t& cpu_topology_);
+
+        thread_placement_t() = delete;
+        thread_placement_t(const thread_placement_t&) = delete;
+        thread_placement_t& operator=(const thread_placement_t&) = delete;
+        thread_placement_t(thread_placement_t&&) = delete;
+        thread_placement_t& operator=(thread_placement_t&&) = delete;
+
+        struct thread_t {
+                /// name used in the placement plan
+                std::string name;
+
+                /// cpu_core is overwritten if set to cpu_core_auto
+                threads_core_prio_config_t* threads_core_prio_config;
+        };
+
+        /**
+         * \brief Assigns one CPU domain to a group of threads and resolves all automatic cores.
+         *
+         * \param name name of the group used in the placement plan
+         * \param thread_vec threads of the group
+         * \return CPU domain of the group, invalid if no thread is placed automatically
+         */
+        cpu_domain_t add_group(const std::string& name, const std::vector<thread_t>& thread_vec);
+
+        /// one line per group and thread, can be written into the log file
+        [[nodiscard]] const std::vector<std::string>& get_plan() const { return plan; };
+
+    private:
+        const cpu_topology_t& cpu_topology;
+
+        /// number of threads placed on each core of each domain
+        std::vector<std::vector<uint32_t>> nof_threads_per_core;
+
+        std::vector<std::string> plan;
+};
+
+}  // namespace dectnrp::common
@@ -31,9 +31,12 @@ namespace dectnrp::common {
  * smaller 0, scheduler picks priority.
  *
  * cpu_core: If set to value between 0 and n_cores-1, thread will start on respective core. If
- * smaller 0, scheduler picks core.
+ * smaller 0, scheduler picks core. If set to cpu_core_auto (-2), the core is picked by
+ * thread_placement_t before the thread is started. If no placement is made, scheduler picks core.
  */
 struct threads_core_prio_config_t {
+        static constexpr int cpu_core_auto{-2};
+
         int prio_offset{-1};
         int cpu_core{-1};
 };
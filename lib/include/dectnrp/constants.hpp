@@ -83,4 +83,7 @@ static constexpr uint32_t pcc_cells{98};  // cells{complex subcarriers
 static constexpr uint32_t rv_max{3};
 static constexpr uint32_t rv_unwrapped_max{7};
 
+/// used to separate atomics written by different threads into different cache lines
+static constexpr uint32_t cache_line_size_byte{64};
+
 }  // namespace dectnrp::constants
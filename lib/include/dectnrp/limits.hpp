@@ -81,4 +81,7 @@ static constexpr uint32_t application_max_queue_datagram_byte{1600};
 /// maximum number of datagrams reportable at once
 static constexpr uint32_t application_max_queue_level_reported{8};
 
+/// maximum number of datagrams a client forwards with a single system call
+static constexpr uint32_t application_max_client_batch{32};
+
 }  // namespace dectnrp::limits
@@ -24,6 +24,7 @@
 
 #include "dectnrp/common/adt/miscellaneous.hpp"
 #include "dectnrp/mac/allocation/allocation_pt.hpp"
+#include "dectnrp/phy/rx/rx_synced/dispersion/dispersion_csi.hpp"
 #include "dectnrp/phy/rx/rx_synced/mimo/mimo_csi.hpp"
 #include "dectnrp/phy/rx/sync/sync_report.hpp"
 #include "dectnrp/sections_part4/mac_architecture/identity.hpp"
@@ -36,6 +37,7 @@ class contact_t {
         // Radio Layer + PHY
 
         phy::sync_report_t sync_report;
+        phy::dispersion_csi_t dispersion_csi;
 
         // ##################################################
         // MAC Layer
@@ -21,80 +21,131 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
+#include <optional>
 #include <vector>
 
-#include "dectnrp/common/adt/bimap.hpp"
+#include "dectnrp/common/adt/flat_map.hpp"
 #include "dectnrp/mac/contact.hpp"
 
 namespace dectnrp::mac {
 
+/**
+ * \brief Contacts are stored in a vector and identified by a local index. Every identifier is
+ * resolved to this index without any node-based container: ShortRadioDeviceIDs have 16 bits and
+ * index a dense table directly, while LongRadioDeviceIDs and connection indices use open
+ * addressing. The identifiers of all contacts are kept in a compact directory separate from the
+ * much larger contacts, so resolving one identifier to another doesn't touch any contact.
+ */
 template <std::derived_from<contact_t> T>
 class contact_list_t {
     public:
+        contact_list_t()
+            : srdid_idx_vec(N_srdid, srdid_idx_none) {};
+
         void reserve(const std::size_t N_entries) {
-            srdid_bimap.reserve(N_entries);
-            conn_idx_server_bimap.reserve(N_entries);
-            conn_idx_client_bimap.reserve(N_entries);
+            lrdid_idx_map.reserve(N_entries);
+            conn_idx_server_idx_map.reserve(N_entries);
+            conn_idx_client_idx_map.reserve(N_entries);
 
-            contact_idx_um.reserve(N_entries);
+            directory_vec.reserve(N_entries);
             contacts_vec.reserve(N_entries);
         }
 
         void add_new_contact_and_setup_indexing(const sp4::mac_architecture::identity_t& identity,
                                                 const uint32_t conn_idx_server,
                                                 const uint32_t conn_idx_client) noexcept {
-            srdid_bimap.insert(identity.LongRadioDeviceID, identity.ShortRadioDeviceID);
-            conn_idx_server_bimap.insert(identity.LongRadioDeviceID, conn_idx_server);
-            conn_idx_client_bimap.insert(identity.LongRadioDeviceID, conn_idx_client);
+            dectnrp_assert(identity.ShortRadioDeviceID < N_srdid, "SRDID out of range");
+            dectnrp_assert(!is_srdid_known(identity.ShortRadioDeviceID), "SRDID already known");
+            dectnrp_assert(contacts_vec.size() < srdid_idx_none, "too many contacts");
+
+            const uint32_t idx = contacts_vec.size();
 
-            contact_idx_um.insert(std::make_pair(identity.LongRadioDeviceID, contacts_vec.size()));
+            srdid_idx_vec[identity.ShortRadioDeviceID] = idx;
+            lrdid_idx_map.insert(identity.LongRadioDeviceID, idx);
+            conn_idx_server_idx_map.insert(conn_idx_server, idx);
+            conn_idx_client_idx_map.insert(conn_idx_client, idx);
+
+            directory_vec.push_back(directory_entry_t{identity.LongRadioDeviceID,
+                                                      identity.ShortRadioDeviceID,
+                                                      conn_idx_server,
+                                                      conn_idx_client});
             contacts_vec.push_back(T{});
         }
 
         std::vector<T>& get_contacts_vec() { return contacts_vec; }
 
         bool is_lrdid_known(const uint32_t lrdid) const noexcept {
-            return srdid_bimap.is_k_known(lrdid);
+            return lrdid_idx_map.is_k_known(lrdid);
         }
 
         bool is_srdid_known(const uint32_t srdid) const noexcept {
-            return srdid_bimap.is_v_known(srdid);
+            return srdid < N_srdid && srdid_idx_vec[srdid] != srdid_idx_none;
+        }
+
+        /// local index of a contact, used on the per-packet path instead of consecutive lookups
+        std::optional<uint32_t> get_idx_from_srdid(const uint32_t srdid) const noexcept {
+            return is_srdid_known(srdid) ? std::optional<uint32_t>(srdid_idx_vec[srdid])
+                                         : std::nullopt;
         }
 
         uint32_t get_lrdid_from_srdid(const uint32_t srdid) const noexcept {
-            return srdid_bimap.get_k(srdid);
+            dectnrp_assert(is_srdid_known(srdid), "SRDID unknown");
+            return directory_vec.at(srdid_idx_vec.at(srdid)).lrdid;
         };
 
         uint32_t get_srdid_from_lrdid(const uint32_t lrdid) const noexcept {
-            return srdid_bimap.get_v(lrdid);
+            return directory_vec[lrdid_idx_map.get_v(lrdid)].srdid;
         };
 
         uint32_t get_lrdid_from_conn_idx_server(const uint32_t conn_idx_server) const noexcept {
-            return conn_idx_server_bimap.get_k(conn_idx_server);
+            return directory_vec[conn_idx_server_idx_map.get_v(conn_idx_server)].lrdid;
         };
 
         uint32_t get_conn_idx_client_from_lrdid(const uint32_t lrdid) const noexcept {
-            return conn_idx_client_bimap.get_v(lrdid);
+            return directory_vec[lrdid_idx_map.get_v(lrdid)].conn_idx_client;
         };
 
         constexpr const T& get_contact(const uint32_t lrdid) const& noexcept {
-            return contacts_vec.at(contact_idx_um.at(lrdid));
+            return contacts_vec[lrdid_idx_map.get_v(lrdid)];
         };
 
         constexpr T& get_contact(const uint32_t lrdid) & noexcept {
-            return contacts_vec.at(contact_idx_um.at(lrdid));
+            return contacts_vec[lrdid_idx_map.get_v(lrdid)];
+        };
+
+        constexpr const T& get_contact_from_idx(const uint32_t idx) const& noexcept {
+            return contacts_vec.at(idx);
+        };
+
+        constexpr T& get_contact_from_idx(const uint32_t idx) & noexcept {
+            return contacts_vec.at(idx);
         };
 
         const std::vector<T>& get_contacts_vec() const noexcept { return contacts_vec; };
 
     private:
-        /// map various identifiers to long radio device ID
-        common::adt::bimap_t<uint32_t, uint32_t, true> srdid_bimap;
-        common::adt::bimap_t<uint32_t, uint32_t, true> conn_idx_server_bimap;
-        common::adt::bimap_t<uint32_t, uint32_t, true> conn_idx_client_bimap;
+        /// ShortRadioDeviceID has 16 bits
+        static constexpr uint32_t N_srdid{1 << 16};
+        static constexpr uint16_t srdid_idx_none{std::numeric_limits<uint16_t>::max()};
+
+        /// map short radio device ID to local contact index
+        std::vector<uint16_t> srdid_idx_vec;
+
+        /// map long radio device ID and connection indices to local contact index
+        common::adt::flat_map_t<uint32_t> lrdid_idx_map;
+        common::adt::flat_map_t<uint32_t> conn_idx_server_idx_map;
+        common::adt::flat_map_t<uint32_t> conn_idx_client_idx_map;
+
+        /// identifiers of every contact accessible via the local index
+        struct directory_entry_t {
+                uint32_t lrdid;
+                uint32_t srdid;
+                uint32_t conn_idx_server;
+                uint32_t conn_idx_client;
+        };
 
-        /// map long radio device ID to local contact index
-        std::unordered_map<uint32_t, uint32_t> contact_idx_um;
+        std::vector<directory_entry_t> directory_vec;
 
         /// list of all contacts_vec accessible via the local index
         std::vector<T> contacts_vec;
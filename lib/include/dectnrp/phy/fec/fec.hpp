@@ -175,6 +175,15 @@ class fec_t {
          */
         uint32_t get_wp() const { return wp; };
 
+        /**
+         * \brief Scrambling sequence of the current packet, valid after calling
+         * segmentate_and_pick_scrambling_sequence(). Allows the demapper to descramble d bits while
+         * writing them, decoding must then be configured with fec_cfg_t::d_descrambled.
+         *
+         * \return scrambling sequence
+         */
+        const srsran_sequence_t* get_srsran_sequence() const { return srsran_sequence; };
+
     private:
         pcc_enc_t pcc_enc;
         pdc_enc_t pdc_enc;
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 
+#include "dectnrp/common/thread/free_list.hpp"
 #include "dectnrp/common/thread/lockable_outer_inner.hpp"
 #include "dectnrp/sections_part3/derivative/packet_sizes.hpp"
 
@@ -50,6 +51,9 @@ class process_t : public common::lockable_outer_inner_t {
     protected:
         void reset();
 
+        /// once fully unlocked, the process returns its ID to the free list of its pool
+        void release();
+
         const uint32_t id;
         uint32_t PLCF_type{0};
         /**
@@ -63,6 +67,9 @@ class process_t : public common::lockable_outer_inner_t {
         sp3::packet_sizes_t packet_sizes{};
         uint32_t rv{0};
 
+        /// set by the process pool, may be nullptr for processes not owned by a pool
+        common::free_list_t* free_list{nullptr};
+
         /**
          * \brief First reset all variables of the deriving class, then those of the base class.
          * That terminates the process such that it can be reacquired by the process pool.
@@ -24,9 +24,12 @@
 #include <memory>
 #include <vector>
 
+#include "dectnrp/common/thread/free_list.hpp"
+#include "dectnrp/common/thread/pinnable.hpp"
 #include "dectnrp/phy/harq/process_rx.hpp"
 #include "dectnrp/phy/harq/process_tx.hpp"
 #include "dectnrp/sections_part3/derivative/packet_sizes.hpp"
+#include "dectnrp/sections_part3/derivative/packet_sizes_lut.hpp"
 
 namespace dectnrp::phy::harq {
 
@@ -60,9 +63,39 @@ class process_pool_t {
                                              uint32_t rv,
                                              const finalize_rx_t frx) const;
 
+        /// number of outer locked processes, can be called by any thread but may be outdated
+        [[nodiscard]] uint32_t get_nof_process_tx_in_use() const;
+        [[nodiscard]] uint32_t get_nof_process_rx_in_use() const;
+
+        /// all packet sizes of the radio device class, also used by firmware for link adaptation
+        [[nodiscard]] const sp3::packet_sizes_lut_t& get_packet_sizes_lut() const {
+            return packet_sizes_lut;
+        };
+
     private:
+        /// computed once, every process allocation is then a table lookup
+        const sp3::packet_sizes_lut_t packet_sizes_lut;
+
+        /// table lookup, falls back to get_packet_sizes() for packets outside the table
+        sp3::packet_sizes_t get_packet_sizes_verified(const sp3::packet_sizes_def_t& psdef) const;
+
         std::vector<std::unique_ptr<process_tx_t>> hp_tx_vec;
         std::vector<std::unique_ptr<process_rx_t>> hp_rx_vec;
+
+        /**
+         * \brief Indices of all processes which are currently not outer locked. A process pushes
+         * its own index once it is terminated, so acquiring a process is a single pop instead of
+         * trying to lock every process in turn.
+         */
+        std::unique_ptr<common::free_list_t> free_list_tx;
+        std::unique_ptr<common::free_list_t> free_list_rx;
+
+        /**
+         * \brief RX processes can be pinned by application queues after they were finalized, see
+         * process_rx_t. At most half of the RX processes can be pinned at any time, the other half
+         * remains available to the PHY. Queues copy the data once the budget is exhausted.
+         */
+        std::unique_ptr<common::pin_budget_t> pin_budget_rx;
 };
 
 }  // namespace dectnrp::phy::harq
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 
+#include "dectnrp/common/thread/pinnable.hpp"
 #include "dectnrp/phy/harq/buffer_rx.hpp"
 #include "dectnrp/phy/harq/finalize.hpp"
 #include "dectnrp/phy/harq/process.hpp"
@@ -30,7 +31,14 @@
 
 namespace dectnrp::phy::harq {
 
-class process_rx_t final : public process_t {
+/**
+ * \brief The transport block in the HARQ buffer can be pinned by the MAC layer, for instance when
+ * handing user plane data to an application without copying it. If a process is pinned when it
+ * would be reset and terminated, the reset is deferred until the last pin is removed. Pinning is
+ * only allowed for processes which terminate after the current reception. All RX processes of a
+ * pool share one pin budget, so pinned processes never exhaust the pool.
+ */
+class process_rx_t final : public process_t, public common::pinnable_t {
     public:
         explicit process_rx_t(const uint32_t id_, const sp3::packet_sizes_t maximum_packet_sizes);
         ~process_rx_t() = default;
@@ -53,6 +61,8 @@ class process_rx_t final : public process_t {
         finalize_rx_t finalize_rx{finalize_rx_t::reset_and_terminate};
 
         void reset_and_terminate_func() override final;
+
+        void unpinned_func() override final;
 };
 
 }  // namespace dectnrp::phy::harq
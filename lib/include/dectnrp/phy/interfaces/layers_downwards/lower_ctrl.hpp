@@ -22,8 +22,10 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 
 #include "dectnrp/common/adt/miscellaneous.hpp"
+#include "dectnrp/common/prog/metrics.hpp"
 #include "dectnrp/phy/agc/agc_rx.hpp"
 #include "dectnrp/phy/agc/agc_tx.hpp"
 #include "dectnrp/phy/harq/process_pool.hpp"
@@ -64,7 +66,19 @@ class lower_ctrl_t {
                   phy::agc::agc_config_t{buffer_rx.nof_antennas, 1.0f, 8.0f, 2.0f},
                   phy::agc::agc_rx_mode_t::tune_individually,
                   phy::agc::agc_t::OFDM_AMPLITUDE_FACTOR_MINUS_20dB,
-                  15.0f)) {}
+                  15.0f)) {
+            // gauges share ownership of the HARQ process pool
+            const metrics::labels_t labels{{"pool", std::to_string(worker_pool_config.id)}};
+
+            metrics::register_gauge("phy_harq_process_tx_in_use",
+                                    "HARQ TX processes in use",
+                                    labels,
+                                    [hpp_ = hpp]() { return hpp_->get_nof_process_tx_in_use(); });
+            metrics::register_gauge("phy_harq_process_rx_in_use",
+                                    "HARQ RX processes in use",
+                                    labels,
+                                    [hpp_ = hpp]() { return hpp_->get_nof_process_rx_in_use(); });
+        }
 
         radio::hw_t& hw;
         const radio::buffer_rx_t& buffer_rx;
@@ -23,6 +23,7 @@
 #include "dectnrp/common/ant.hpp"
 #include "dectnrp/phy/harq/process_rx.hpp"
 #include "dectnrp/phy/interfaces/maclow_phy_handle.hpp"
+#include "dectnrp/phy/rx/rx_synced/dispersion/dispersion_report.hpp"
 
 namespace dectnrp::phy {
 
@@ -71,6 +72,13 @@ class maclow_phy_t {
             return maclow_phy_handle.lrdid;
         };
 
+        /**
+         * \brief Delay and Doppler spread the MAC has cached for the sender of the packet. Used by
+         * the PHY to pick the cheapest adequate channel estimation for the PDC. If unknown, the PHY
+         * falls back to its defaults.
+         */
+        dispersion_report_t dispersion_hint{};
+
         // ##################################################
         /* In addition to the above variables, we also include some variables related to the
          * hardware status. This is easiest done from the lower/higher MAC to the PHY as the MAC
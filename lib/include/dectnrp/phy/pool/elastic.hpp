@@ -0,0 +1,135 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "dectnrp/common/reporting.hpp"
+
+/**
+ * If defined, a worker pool only keeps as many instances of worker_tx_rx_t active as the offered
+ * load requires. Surplus workers are parked without timeout and leave their CPU cores to other
+ * processes. If undefined, all workers are always active.
+ */
+#define PHY_POOL_ELASTIC
+
+namespace dectnrp::phy {
+
+/**
+ * \brief Decides how many of the consumers of one job queue are active. Consumers with an ID equal
+ * to or larger than the number of active consumers are parked.
+ *
+ * Scaling up is immediate. Producers report the queue depth after every job they enqueue, and if
+ * more jobs are waiting than there are idle active consumers, the missing consumers are woken up.
+ * Consumers report the latency of every job they process, and if it exceeds the upper threshold,
+ * one more consumer is woken up.
+ *
+ * Scaling down uses hysteresis. Only if the queue stays empty and all reported latencies stay below
+ * the lower threshold for the hold time, one consumer is parked. The hold time then starts again.
+ */
+class elastic_t final : public common::reporting_t {
+    public:
+        /**
+         * \param id_ identifier of the associated job queue
+         * \param nof_workers_ total number of consumers
+         * \param latency_up_us_ latency above which a consumer is added
+         * \param latency_down_us_ latency below which consumers may be parked
+         * \param hold_ms_ time without load before parking a consumer
+         */
+        explicit elastic_t(const uint32_t id_,
+                           const uint32_t nof_workers_,
+                           const int64_t latency_up_us_,
+                           const int64_t latency_down_us_,
+                           const int64_t hold_ms_);
+        ~elastic_t() = default;
+
+        elastic_t() = delete;
+        elastic_t(const elastic_t&) = delete;
+        elastic_t& operator=(const elastic_t&) = delete;
+        elastic_t(elastic_t&&) = delete;
+        elastic_t& operator=(elastic_t&&) = delete;
+
+        /// called by producers after a job has been enqueued
+        void update_enqueued(const std::size_t nof_jobs);
+
+        /// called by consumers after a job, latency_us is negative for jobs without latency
+        void update_processed(const std::size_t nof_jobs, const int64_t latency_us);
+
+        /// called by consumers when they wait for a new job without success
+        void update_idle(const std::size_t nof_jobs);
+
+        /**
+         * \brief Called by consumers between jobs. Returns once worker_id is active, once
+         * unpark_all() was called or once keep_running is false.
+         *
+         * \param worker_id
+         * \param keep_running run flag of the consumer, must be cleared before calling unpark_all()
+         */
+        void park_while_surplus(const uint32_t worker_id, const std::atomic<bool>& keep_running);
+
+        /// consumers mark themselves as busy while processing a job
+        void set_busy() { nof_workers_busy.fetch_add(1, std::memory_order_acq_rel); };
+        void set_not_busy() { nof_workers_busy.fetch_sub(1, std::memory_order_acq_rel); };
+
+        /// activates all consumers permanently, must be called before stopping consumers
+        void unpark_all();
+
+        [[nodiscard]] uint32_t get_nof_workers_active() const {
+            return nof_workers_active.load(std::memory_order_acquire);
+        };
+
+        const uint32_t id;
+        const uint32_t nof_workers;
+
+        friend class worker_pool_t;
+
+    private:
+        std::vector<std::string> report_start() const override final;
+        std::vector<std::string> report_stop() const override final;
+
+        const int64_t latency_up_us;
+        const int64_t latency_down_us;
+        const int64_t hold_ns;
+
+        std::atomic<uint32_t> nof_workers_active;
+        std::atomic<uint32_t> nof_workers_busy{0};
+        std::atomic<bool> is_unparked_all{false};
+
+        /// start of the current period without load, 0 if there is load
+        std::atomic<int64_t> no_load_since_ns{0};
+
+        /// increase the number of active consumers to at least nof_workers_active_target
+        void scale_up(const uint32_t nof_workers_active_target);
+
+        void scale_down_after_hold(const std::size_t nof_jobs);
+
+        struct stats_t {
+                std::atomic<int64_t> scale_up{0};
+                std::atomic<int64_t> scale_down{0};
+                std::atomic<uint32_t> nof_workers_active_max{0};
+        } stats;
+};
+
+}  // namespace dectnrp::phy
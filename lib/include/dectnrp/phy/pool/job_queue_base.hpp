@@ -21,10 +21,12 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
 #include "dectnrp/common/reporting.hpp"
+#include "dectnrp/phy/pool/elastic.hpp"
 #include "dectnrp/phy/pool/job.hpp"
 
 /**
@@ -68,6 +70,12 @@ class job_queue_base_t : public common::reporting_t {
         void set_permeable() { permeable.store(true, std::memory_order_release); }
         void set_impermeable() { permeable.store(false, std::memory_order_release); }
 
+        /// consumers are activated based on the number of jobs after every enqueued job
+        void set_elastic(elastic_t* elastic_) { elastic = elastic_; }
+
+        /// number of jobs currently waiting, may be outdated once returned
+        [[nodiscard]] virtual std::size_t get_nof_jobs() const = 0;
+
         const uint32_t id;
         const uint32_t capacity;
 
@@ -79,6 +87,9 @@ class job_queue_base_t : public common::reporting_t {
 
         int64_t fifo_cnt{0};
 
+        /// optional, nullptr if all consumers are always active
+        elastic_t* elastic{nullptr};
+
         static constexpr uint32_t JOB_QUEUE_WAIT_TIMEOUT_MS{100};
 
         /**
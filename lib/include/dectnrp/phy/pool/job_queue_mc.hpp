@@ -67,6 +67,10 @@ class job_queue_mc_t final : public job_queue_base_t {
 
         bool enqueue_nto(job_t&& job) override final;
 
+        [[nodiscard]] std::size_t get_nof_jobs() const override final {
+            return job_vec.size_approx();
+        };
+
         friend class worker_pool_t;
         friend class worker_tx_rx_t;
 
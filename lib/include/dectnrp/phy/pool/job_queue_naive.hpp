@@ -50,6 +50,10 @@ class job_queue_naive_t final : public job_queue_base_t {
 
         bool enqueue_nto(job_t&& job) override final;
 
+        [[nodiscard]] std::size_t get_nof_jobs() const override final {
+            return static_cast<std::size_t>(job_slot_vec_cnt.load(std::memory_order_acquire));
+        };
+
         friend class worker_pool_t;
         friend class worker_tx_rx_t;
 
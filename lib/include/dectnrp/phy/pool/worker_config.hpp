@@ -23,6 +23,7 @@
 #include <atomic>
 #include <cstdint>
 
+#include "dectnrp/phy/pool/elastic.hpp"
 #include "dectnrp/phy/pool/irregular_queue.hpp"
 #include "dectnrp/phy/pool/job_queue.hpp"
 #include "dectnrp/phy/worker_pool_config.hpp"
@@ -36,13 +37,15 @@ struct worker_config_t {
                         radio::hw_t& hw_,
                         job_queue_t& job_queue_,
                         irregular_queue_t& irregular_queue_,
-                        const worker_pool_config_t& worker_pool_config_)
+                        const worker_pool_config_t& worker_pool_config_,
+                        elastic_t* elastic_)
             : id(id_),
               keep_running(keep_running_),
               hw(hw_),
               job_queue(job_queue_),
               irregular_queue(irregular_queue_),
-              worker_pool_config(worker_pool_config_) {}
+              worker_pool_config(worker_pool_config_),
+              elastic(elastic_) {}
 
         uint32_t id;
         const std::atomic<bool>& keep_running;
@@ -50,6 +53,9 @@ struct worker_config_t {
         job_queue_t& job_queue;
         irregular_queue_t& irregular_queue;
         const worker_pool_config_t& worker_pool_config;
+
+        /// nullptr if all instances of worker_tx_rx_t are always active
+        elastic_t* elastic;
 };
 
 }  // namespace dectnrp::phy
@@ -22,6 +22,7 @@
 
 #include <memory>
 
+#include "dectnrp/common/prog/metrics.hpp"
 #include "dectnrp/phy/pool/baton.hpp"
 #include "dectnrp/phy/pool/worker.hpp"
 #include "dectnrp/phy/rx/sync/sync_chunk.hpp"
@@ -67,10 +68,10 @@ class worker_sync_t final : public worker_t {
         void enqueue_job_nto(const sync_report_t& sync_report);
 
         struct stats_t {
-                int64_t job_regular{0};
-                int64_t job_packet{0};
-                int64_t job_packet_not_unique{0};
-                int64_t job_packet_no_slot{0};
+                metrics::counter_t job_regular;
+                metrics::counter_t job_packet;
+                metrics::counter_t job_packet_not_unique;
+                metrics::counter_t job_packet_no_slot;
         } stats;
 };
 
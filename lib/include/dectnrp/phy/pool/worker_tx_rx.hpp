@@ -24,6 +24,7 @@
 
 #include "dectnrp/common/json/json_export.hpp"
 #include "dectnrp/common/json/json_switch.hpp"
+#include "dectnrp/common/prog/metrics.hpp"
 #include "dectnrp/phy/interfaces/layers_downwards/phy_radio.hpp"
 #include "dectnrp/phy/interfaces/machigh_phy.hpp"
 #include "dectnrp/phy/pool/token.hpp"
@@ -68,9 +69,18 @@ class worker_tx_rx_t final : public worker_t {
         using tx_descriptor_vec_t = machigh_phy_tx_t::tx_descriptor_vec_t;
         using chscan_opt_t = machigh_phy_t::chscan_opt_t;
 
+        /**
+         * \brief Generates all packets, pushes the irregular report and runs a channel scan.
+         *
+         * \param tx_descriptor_vec
+         * \param irregular_report
+         * \param chscan_opt
+         * \param trace_id fine peak time of the RX packet the TX packets respond to, -1 if none
+         */
         void run_tx_chscan(const tx_descriptor_vec_t& tx_descriptor_vec,
                            const irregular_report_t& irregular_report,
-                           chscan_opt_t& chscan_opt);
+                           chscan_opt_t& chscan_opt,
+                           const int64_t trace_id = -1);
 
         phy_radio_t& phy_radio;
 
@@ -84,24 +94,52 @@ class worker_tx_rx_t final : public worker_t {
 #endif
 
         struct stats_t {
-                int64_t tx_desc{};
-                int64_t tx_desc_other_hw{};
+                metrics::counter_t tx_desc;
+                metrics::counter_t tx_desc_other_hw;
 
-                int64_t tx_fail_no_buffer{};
-                int64_t tx_fail_no_buffer_other_hw{};
+                metrics::counter_t tx_fail_no_buffer;
+                metrics::counter_t tx_fail_no_buffer_other_hw;
 
-                int64_t tx_sent{};
+                metrics::counter_t tx_sent;
 
-                int64_t rx_pcc_success{};
-                int64_t rx_pcc_fail{};
+                metrics::counter_t rx_pcc_success;
+                metrics::counter_t rx_pcc_fail;
 
-                int64_t rx_pdc_success{};
-                int64_t rx_pdc_fail{};
+                metrics::counter_t rx_pdc_success;
+                metrics::counter_t rx_pdc_fail;
 
-                int64_t tpoint_work_regular{};
-                int64_t tpoint_work_irregular{};
-                int64_t tpoint_work_upper{};
+                metrics::counter_t tpoint_work_regular;
+                metrics::counter_t tpoint_work_irregular;
+                metrics::counter_t tpoint_work_upper;
         } stats;
+
+        /// time from the beginning of a packet until its PDC has been processed by the MAC
+        metrics::histogram_t rx_pdc_latency_us;
+
+        /// nullptr if this worker is always active
+        elastic_t* elastic;
+
+        /**
+         * \brief Marks the worker as busy while it processes one job. Once the job is finished,
+         * the time since the beginning of the job's packet is reported as latency.
+         */
+        class elastic_job_t {
+            public:
+                explicit elastic_job_t(worker_tx_rx_t& worker_tx_rx_, const job_t& job);
+                ~elastic_job_t();
+
+                elastic_job_t() = delete;
+                elastic_job_t(const elastic_job_t&) = delete;
+                elastic_job_t& operator=(const elastic_job_t&) = delete;
+                elastic_job_t(elastic_job_t&&) = delete;
+                elastic_job_t& operator=(elastic_job_t&&) = delete;
+
+            private:
+                worker_tx_rx_t& worker_tx_rx;
+
+                /// -1 for jobs without a packet
+                int64_t fine_peak_time_64;
+        };
 };
 
 }  // namespace dectnrp::phy
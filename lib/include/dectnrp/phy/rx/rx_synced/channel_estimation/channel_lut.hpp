@@ -20,25 +20,34 @@
 
 #pragma once
 
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "dectnrp/common/multidim.hpp"
 #include "dectnrp/phy/rx/rx_synced/channel_estimation/channel_statistics.hpp"
 #include "dectnrp/phy/rx/rx_synced/channel_estimation/wiener.hpp"
-#include "dectnrp/phy/rx/rx_synced/processing_stage.hpp"
 #include "dectnrp/phy/rx/rx_synced/rx_synced_param.hpp"
 
 namespace dectnrp::phy {
 
 class channel_lut_t {
     public:
+        /// caches tables on disk if RX_SYNCED_PARAM_CHANNEL_LUT_CACHE_FILE_PREFIX is defined
         explicit channel_lut_t(const uint32_t b_max_,
                                const uint32_t N_eff_TX_max_,
                                const channel_statistics_t channel_statistics_);
-        ~channel_lut_t();
+
+        /// caches tables in files with the given prefix, an empty prefix disables the cache
+        explicit channel_lut_t(const uint32_t b_max_,
+                               const uint32_t N_eff_TX_max_,
+                               const channel_statistics_t channel_statistics_,
+                               const std::string& cache_file_prefix);
+        ~channel_lut_t() = default;
 
         channel_lut_t() = delete;
         channel_lut_t(const channel_lut_t&) = delete;
@@ -60,7 +69,7 @@ class channel_lut_t {
          * \param ofdm_symb_ps_idx OFDM symbol index relative to processing stage
          * \return
          */
-        const std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE*>& get_idx_pilot_symb(
+        const std::vector<const RX_SYNCED_PARAM_LUT_IDX_TYPE*>& get_idx_pilot_symb(
             const uint32_t ofdm_symb_ps_idx);
 
         /**
@@ -70,7 +79,7 @@ class channel_lut_t {
          * \param ofdm_symb_ps_idx OFDM symbol index relative to processing stage
          * \return
          */
-        const std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE*>& get_idx_weights_symb(
+        const std::vector<const RX_SYNCED_PARAM_LUT_IDX_TYPE*>& get_idx_weights_symb(
             const uint32_t ofdm_symb_ps_idx);
 
         /// one large vector with all weight vectors required, across all beta and processing stage
@@ -80,34 +89,16 @@ class channel_lut_t {
         /// number of DRS channel estimates to use for interpolation/extrapolation/smoothing
         uint32_t get_nof_drs_subc_interp() const { return nof_drs_subc_interp; }
 
+        /// true if the tables were mapped from a cache file instead of being generated
+        bool is_mapped() const { return tables->is_mapped(); }
+
         const uint32_t b_max;
         const uint32_t N_eff_TX_max;
         const channel_statistics_t channel_statistics;
 
     private:
         // ##################################################
-        // variables depending of packet and processing stage
-
-        /// configuration of current packet set in set_configuration_packet()
-        uint32_t b_idx;
-        uint32_t N_eff_TX;
-
-        /// configuration of current processing stage set in set_configuration_ps()
-        uint32_t ps_idx;
-        processing_stage_t<RX_SYNCED_PARAM_LUT_IDX_TYPE>* idx_pilot_effective;
-        processing_stage_t<RX_SYNCED_PARAM_LUT_IDX_TYPE>* idx_weights_effective;
-        RX_SYNCED_PARAM_WEIGHTS_TYPE* lut_x_weight_vecs_effective;
-        uint32_t nof_drs_subc_interp;
-
-        /// preallocated vectors returned as reference, avoids allocating many small vectors
-        std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE*> idx_pilot_symb;
-        std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE*> idx_weights_symb;
-
-        /// small helper for ts_idx switching
-        static void swap_upper_lower_half(std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE*>& in);
-
-        // ##################################################
-        // variables instantiated once in the constructor
+        // variables instantiated once and shared between all instances
 
         class lut_t {
             public:
@@ -115,59 +106,159 @@ class channel_lut_t {
                  * \brief A single lut_t is defined by one value of
                  * 1. N_b_OCC_plus_DC = 56*b+1
                  * 2. ps_t_length = N_step_virtual + 1
-                 * 3. N_eff_TX_max.
+                 * 3. N_EFF_TX_MAX_PRECALC.
                  *
                  * Possible values of N_b_OCC_plus_DC = 57,113,225,449,673,897.
                  * Possible values of ps_t_length     = 1,6,11.
                  * Possible values of N_eff_TX_max    = 4.
                  *
                  * A single lut_t contains the optimal pilot indices, and the corresponding weight
-                 * vector indices.
+                 * vector indices. Both are arranged like a processing stage with one stage per
+                 * transmit stream, but the memory is owned by tables_t.
                  *
-                 * \param N_b_OCC_plus_DC
-                 * \param ps_t_length
-                 * \param N_eff_TX_max
+                 * \param N_b_OCC_plus_DC_
+                 * \param ps_t_length_
+                 * \param idx_pilot_
+                 * \param idx_weights_
                  */
-                explicit lut_t(const uint32_t N_b_OCC_plus_DC,
-                               const uint32_t ps_t_length,
-                               const uint32_t N_eff_TX_max) {
-                    idx_pilot = std::make_unique<processing_stage_t<RX_SYNCED_PARAM_LUT_IDX_TYPE>>(
-                        N_b_OCC_plus_DC, ps_t_length, N_eff_TX_max);
-
-                    idx_weights =
-                        std::make_unique<processing_stage_t<RX_SYNCED_PARAM_LUT_IDX_TYPE>>(
-                            N_b_OCC_plus_DC, ps_t_length, N_eff_TX_max);
-                };
-
-                std::unique_ptr<processing_stage_t<RX_SYNCED_PARAM_LUT_IDX_TYPE>> idx_pilot;
-                std::unique_ptr<processing_stage_t<RX_SYNCED_PARAM_LUT_IDX_TYPE>> idx_weights;
+                explicit lut_t(const uint32_t N_b_OCC_plus_DC_,
+                               const uint32_t ps_t_length_,
+                               const RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_pilot_,
+                               const RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_weights_)
+                    : N_b_OCC_plus_DC(N_b_OCC_plus_DC_),
+                      ps_t_length(ps_t_length_),
+                      idx_pilot(idx_pilot_),
+                      idx_weights(idx_weights_) {};
+
+                /// number of elements of idx_pilot and idx_weights each
+                static std::size_t get_len(const uint32_t N_b_OCC_plus_DC,
+                                           const uint32_t ps_t_length);
+
+                /// get pointers to specific symbol in all transmit streams
+                void get_stage_prealloc(
+                    const RX_SYNCED_PARAM_LUT_IDX_TYPE* base,
+                    const uint32_t t_idx,
+                    std::vector<const RX_SYNCED_PARAM_LUT_IDX_TYPE*>& vec) const;
+
+                uint32_t N_b_OCC_plus_DC;
+                uint32_t ps_t_length;
+                const RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_pilot;
+                const RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_weights;
         };
 
         /**
-         * \brief We differentiate three vectors of lut_t:
-         *
-         * 1. lut_0_vec: Estimate channel only at the first DRS symbol in a processing stage and use
-         *               that channel estimate for the rest of the processing stage.
-         * 2. lut_5_vec: Estimate channel between two OFDM symbols with DRS cells, N_step=5.
-         * 3. lut_10_vec: Estimate channel between two OFDM symbols with DRS cells, N_step=10.
-         *
-         * Each vector lut_x_vec contains one lut_t per value of b, i.e. the maximum vector length
-         * is six since b={1,2,4,8,12,16}.
+         * \brief The tables only depend on b_max, N_eff_TX_max and the channel statistics, but
+         * generating them requires solving a Wiener-Hopf equation for almost every subcarrier. They
+         * are thus generated once and shared read-only by all instances of channel_lut_t with the
+         * same parameters, i.e. typically by the rx_synced_t of all workers in a pool.
          *
-         * Each vector lut_x_vec also has a corresponding pointer lut_x_weight_vecs which contains
-         * weight vectors for interpolation, extrapolation and smoothing. Weight vectors are always
-         * calculated only for the maximum value of b of a radio device class. The weight vectors
-         * for smaller values of b are a subset.
-         *
-         * Each lut_t, i.e. one of the vector elements, is always instantiated for 4 transmit
-         * streams with index 0,1,2,3.
+         * With a cache file prefix, the tables are also written to a versioned binary file, which
+         * is memory-mapped instead of regenerated on later starts.
          */
-        std::vector<lut_t> lut_0_vec;
-        std::vector<lut_t> lut_5_vec;
-        std::vector<lut_t> lut_10_vec;
-        RX_SYNCED_PARAM_WEIGHTS_TYPE* lut_0_weight_vecs = nullptr;
-        RX_SYNCED_PARAM_WEIGHTS_TYPE* lut_5_weight_vecs = nullptr;
-        RX_SYNCED_PARAM_WEIGHTS_TYPE* lut_10_weight_vecs = nullptr;
+        class tables_t {
+            public:
+                /// generates the tables
+                explicit tables_t(const uint32_t b_max,
+                                  const uint32_t N_eff_TX_max,
+                                  const channel_statistics_t& channel_statistics);
+
+                /// maps the tables from a cache file, check is_valid() afterwards
+                explicit tables_t(const std::string& filename, const std::string& key);
+
+                ~tables_t();
+
+                tables_t() = delete;
+                tables_t(const tables_t&) = delete;
+                tables_t& operator=(const tables_t&) = delete;
+                tables_t(tables_t&&) = delete;
+                tables_t& operator=(tables_t&&) = delete;
+
+                /// either returns existing tables with the same parameters, or creates new ones
+                static std::shared_ptr<const tables_t> get_shared(
+                    const uint32_t b_max,
+                    const uint32_t N_eff_TX_max,
+                    const channel_statistics_t& channel_statistics,
+                    const std::string& cache_file_prefix);
+
+                /// false if a cache file was missing, outdated or ill-formed
+                bool is_valid() const { return !lut_x_vec[0].empty(); };
+
+                bool is_mapped() const { return mmap_addr != nullptr; };
+
+                /// write tables to cache file, returns false on failure
+                bool save(const std::string& filename, const std::string& key) const;
+
+                /**
+                 * \brief We differentiate three vectors of lut_t:
+                 *
+                 * 1. lut_x_vec[0]: Estimate channel only at the first DRS symbol in a processing
+                 *                  stage and use that channel estimate for the rest of the
+                 *                  processing stage.
+                 * 2. lut_x_vec[1]: Estimate channel between two OFDM symbols with DRS cells,
+                 *                  N_step=5.
+                 * 3. lut_x_vec[2]: Estimate channel between two OFDM symbols with DRS cells,
+                 *                  N_step=10. Only initialized if N_eff_TX_max >= 4.
+                 *
+                 * Each vector lut_x_vec contains one lut_t per value of b, i.e. the maximum vector
+                 * length is six since b={1,2,4,8,12,16}.
+                 *
+                 * Each vector lut_x_vec also has a corresponding pointer lut_x_weight_vecs which
+                 * contains weight vectors for interpolation, extrapolation and smoothing. Weight
+                 * vectors are always calculated only for the maximum value of b of a radio device
+                 * class. The weight vectors for smaller values of b are a subset.
+                 *
+                 * Each lut_t, i.e. one of the vector elements, is always instantiated for 4
+                 * transmit streams with index 0,1,2,3.
+                 */
+                static constexpr std::array<uint32_t, 3> N_step_virtual_vec{0, 5, 10};
+                std::array<std::vector<lut_t>, 3> lut_x_vec;
+                std::array<const RX_SYNCED_PARAM_WEIGHTS_TYPE*, 3> lut_x_weight_vecs{};
+
+            private:
+                /// memory of tables is either allocated on the heap ...
+                std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE> idx_storage;
+                std::array<std::vector<RX_SYNCED_PARAM_WEIGHTS_TYPE>, 3> weight_vecs_storage;
+
+                /// ... or mapped from a cache file
+                void* mmap_addr{nullptr};
+                std::size_t mmap_len{0};
+
+                /// create lut_t for every b, either pointing into idx_storage or the cache file
+                void init_lut_x_vec_pointers(const uint32_t b_max,
+                                             const std::size_t nof_lut_x,
+                                             const RX_SYNCED_PARAM_LUT_IDX_TYPE* base);
+
+                /// number of elements in idx_storage
+                static std::size_t get_idx_len_lut_x(const uint32_t b_max, const std::size_t x);
+                static std::size_t get_idx_len(const uint32_t b_max, const std::size_t nof_lut_x);
+
+                /// unique key for the parameters, also used for the cache file name
+                static std::string get_key(const uint32_t b_max,
+                                           const uint32_t N_eff_TX_max,
+                                           const channel_statistics_t& channel_statistics);
+        };
+
+        std::shared_ptr<const tables_t> tables;
+
+        // ##################################################
+        // variables depending of packet and processing stage
+
+        /// configuration of current packet set in set_configuration_packet()
+        uint32_t b_idx;
+        uint32_t N_eff_TX;
+
+        /// configuration of current processing stage set in set_configuration_ps()
+        uint32_t ps_idx;
+        const lut_t* lut_effective;
+        const RX_SYNCED_PARAM_WEIGHTS_TYPE* lut_x_weight_vecs_effective;
+        uint32_t nof_drs_subc_interp;
+
+        /// preallocated vectors returned as reference, avoids allocating many small vectors
+        std::vector<const RX_SYNCED_PARAM_LUT_IDX_TYPE*> idx_pilot_symb;
+        std::vector<const RX_SYNCED_PARAM_LUT_IDX_TYPE*> idx_weights_symb;
+
+        /// small helper for ts_idx switching
+        static void swap_upper_lower_half(std::vector<const RX_SYNCED_PARAM_LUT_IDX_TYPE*>& in);
 
         // ##################################################
         // helper functions and variables for instantiation of lut_x_vec and lut_x_weight_vecs
@@ -176,15 +267,15 @@ class channel_lut_t {
         static void init_lut_x_vec(const uint32_t N_step_virtual,
                                    const uint32_t b_max,
                                    const channel_statistics_t& channel_statistics,
-                                   std::vector<lut_t>& lut_x_vec,
-                                   RX_SYNCED_PARAM_WEIGHTS_TYPE*& lut_x_weight_vecs);
+                                   RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_base,
+                                   std::vector<RX_SYNCED_PARAM_WEIGHTS_TYPE>& lut_x_weight_vecs);
 
         /// helper to initialize one lut_t entry of lut_x_vec
         static void init_lut(const uint32_t N_step_virtual,
                              const uint32_t b,
                              const channel_statistics_t& channel_statistics,
-                             processing_stage_t<RX_SYNCED_PARAM_LUT_IDX_TYPE>& idx_pilot,
-                             processing_stage_t<RX_SYNCED_PARAM_LUT_IDX_TYPE>& idx_weights,
+                             RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_pilot,
+                             RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_weights,
                              common::vec2d<RX_SYNCED_PARAM_WEIGHTS_TYPE>& weight_vecs_tmp);
 
         // ##################################################
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "dectnrp/common/complex.hpp"
+
+/**
+ * \brief Fused soft demapper for the PDC. For every equalized cell, max-log LLRs are computed with
+ * the piecewise linear approximation also used by srsran, scaled, descrambled and written with
+ * saturation into the d bits of a HARQ buffer. Compared to srsran_demod_soft_demodulate_s()
+ * followed by a copy into the HARQ buffer and srsran_scrambling_s_offset() before rate dematching,
+ * the LLRs are touched only once.
+ *
+ * Inner loops are instantiated for each number of bits per symbol, so they are fully unrolled and
+ * the compiler can vectorize across cells.
+ */
+
+namespace dectnrp::phy::demapper {
+
+/**
+ * \brief LLR scale for a modulation order. The base scale matches the fixed-point scale of srsran's
+ * demapper and is reduced for packets with an estimated SNR below
+ * RX_SYNCED_PARAM_DEMAPPER_SNR_DB_FULL_SCALE, so that soft bits of HARQ retransmissions received at
+ * different SNRs are combined with weights proportional to their reliability.
+ *
+ * \param N_bps bits per symbol, 1, 2, 4, 6, 8 or 10
+ * \param snr_dB SNR estimated for the packet
+ * \return scale passed to demap_and_descramble()
+ */
+[[nodiscard]] float get_llr_scale(const uint32_t N_bps, const float snr_dB);
+
+/**
+ * \brief Demap, descramble and convert to fixed-point in a single pass.
+ *
+ * \param N_bps bits per symbol, 1, 2, 4, 6, 8 or 10
+ * \param symbols equalized cells
+ * \param scale LLR scale, see get_llr_scale()
+ * \param c scrambling sequence with one bit per byte, starting at the first bit of symbols[0]
+ * \param llr output, N_bps LLRs per cell, does not have to be aligned
+ * \param nof_symbols number of cells
+ */
+template <typename T>
+void demap_and_descramble(const uint32_t N_bps,
+                          const cf_t* symbols,
+                          const float scale,
+                          const uint8_t* c,
+                          T* llr,
+                          const uint32_t nof_symbols);
+
+}  // namespace dectnrp::phy::demapper
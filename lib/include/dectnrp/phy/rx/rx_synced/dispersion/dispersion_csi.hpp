@@ -0,0 +1,50 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include "dectnrp/phy/rx/rx_synced/dispersion/dispersion_report.hpp"
+
+namespace dectnrp::phy {
+
+class dispersion_csi_t {
+    public:
+        dispersion_csi_t() = default;
+
+        /**
+         * \brief The delay and Doppler spread of a link change slowly compared to the packet rate,
+         * so every new report is merged into an exponentially weighted average. Values missing in
+         * the report leave the respective average unchanged.
+         *
+         * \param dispersion_report as measured by the PHY for the latest PDC
+         */
+        void update_from_phy(const dispersion_report_t& dispersion_report);
+
+        /// hint passed on to the PHY for the next packet of the same contact
+        const dispersion_report_t& get_hint() const { return dispersion; };
+
+    private:
+        /// weight of the latest report
+        static constexpr float alpha{0.25f};
+
+        dispersion_report_t dispersion;
+};
+
+}  // namespace dectnrp::phy
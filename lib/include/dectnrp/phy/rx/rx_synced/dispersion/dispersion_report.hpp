@@ -0,0 +1,45 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+namespace dectnrp::phy {
+
+class dispersion_report_t {
+    public:
+        dispersion_report_t() = default;
+        explicit dispersion_report_t(const float tau_rms_sec_, const float nu_max_hz_)
+            : tau_rms_sec(tau_rms_sec_),
+              nu_max_hz(nu_max_hz_) {};
+
+        bool has_tau_rms() const { return 0.0f <= tau_rms_sec; };
+        bool has_nu_max() const { return 0.0f <= nu_max_hz; };
+
+        /// RMS of delay spread in sec, negative if unknown
+        float tau_rms_sec{-1.0f};
+
+        /**
+         * \brief Maximum Doppler spread in Hz, negative if unknown. Requires at least two OFDM
+         * symbols with DRS cells of transmit stream 0, so short packets only report tau_rms_sec.
+         */
+        float nu_max_hz{-1.0f};
+};
+
+}  // namespace dectnrp::phy
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "dectnrp/common/complex.hpp"
+#include "dectnrp/phy/rx/rx_synced/dispersion/dispersion_report.hpp"
+#include "dectnrp/phy/rx/rx_synced/estimator/estimator.hpp"
+
+namespace dectnrp::phy {
+
+/**
+ * \brief Estimates the RMS delay spread and the maximum Doppler spread of the current packet from
+ * the zero-forced channel estimates at the DRS cells of transmit stream 0.
+ *
+ * Delay spread: DRS cells within one OFDM symbol are four subcarriers apart. Their correlation is
+ * fitted to the exponential power delay profile also used for the Wiener filters.
+ *
+ * Doppler spread: consecutive OFDM symbols with DRS cells of transmit stream 0 are N_step symbols
+ * apart and shifted by two subcarriers. Their correlation is divided by the frequency correlation
+ * at two subcarriers and fitted to the Jakes spectrum.
+ *
+ * Both correlations are normalized by the signal power, i.e. they are corrected for noise based on
+ * the SNR estimation.
+ */
+class estimator_dispersion_t final : public estimator_t {
+    public:
+        explicit estimator_dispersion_t(const uint32_t b_max, const uint32_t N_RX_);
+        ~estimator_dispersion_t();
+
+        estimator_dispersion_t() = delete;
+        estimator_dispersion_t(const estimator_dispersion_t&) = delete;
+        estimator_dispersion_t& operator=(const estimator_dispersion_t&) = delete;
+        estimator_dispersion_t(estimator_dispersion_t&&) = delete;
+        estimator_dispersion_t& operator=(estimator_dispersion_t&&) = delete;
+
+        /// must be called for every new packet after reset()
+        void set_numerology(const uint32_t u, const uint32_t b);
+
+        virtual void process_stf(const channel_antennas_t& channel_antennas,
+                                 const process_stf_meta_t& process_stf_meta) override final;
+
+        virtual void process_drs(const channel_antennas_t& channel_antennas,
+                                 const process_drs_meta_t& process_drs_meta) override final;
+
+        /// valid only if process_drs() was called before
+        dispersion_report_t get_dispersion_report(const float snr_dB) const;
+
+    private:
+        virtual void reset_internal() override final;
+
+        const uint32_t N_RX;
+
+        /**
+         * \brief Subcarrier spacing in Hz and OFDM symbol length in seconds. Following Table
+         * 4.3-1 in part 3, T_u_symb = (64 + 8) / 64 / delta_u_f is the length of the useful symbol
+         * 1 / delta_u_f plus a CP of 8/64 of that length.
+         */
+        double delta_u_f{};
+        double T_u_symb{};
+
+        struct corr_acc_t {
+                /// sum of magnitudes of correlations and number of pilot pairs
+                float R_sum{};
+                uint32_t R_cnt{};
+
+                /// sum of received power including noise and number of pilots
+                float P_sum{};
+                uint32_t P_cnt{};
+        } acc_f, acc_t;
+
+        /// copy of the latest DRS channel estimates of transmit stream 0, one per RX antenna
+        std::vector<cf_t*> chestim_drs_zf_previous;
+        std::vector<float> P_previous;
+        bool has_previous{false};
+};
+
+}  // namespace dectnrp::phy
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "dectnrp/phy/rx/rx_synced/estimator/estimator.hpp"
@@ -60,6 +61,9 @@ class estimator_mimo_t final : public estimator_t {
 
         [[nodiscard]] const mimo_report_t& get_mimo_report() const;
 
+        /// SNR of the current packet, must be set before calling process_drs()
+        void set_snr_dB(const float snr_dB_) { snr_dB = snr_dB_; };
+
     private:
         virtual void reset_internal() override final;
 
@@ -76,20 +80,55 @@ class estimator_mimo_t final : public estimator_t {
         uint32_t step_width;
         uint32_t step_offset;
 
+        /// used for rank selection
+        float snr_dB{};
+
         /// for SIMD
         std::vector<cf_t*> stage_rx_ts_vec;
         std::vector<cf_t*> stage_rx_ts_transpose_vec;
-        cf_t* stage_multiplication;
+
+        /**
+         * \brief Gram matrices H^H*H accumulated across all wideband cells, one matrix per virtual
+         * RX antenna. Once computed, every beamforming matrix can be scored with a quadratic form
+         * whose cost is independent of the number of wideband cells.
+         */
+        std::vector<cf_t> gram_rx_ts;
+        std::vector<cf_t> gram_rx_ts_transpose;
 
         void set_stages(const channel_antennas_t& channel_antennas,
                         const process_drs_meta_t& process_drs_meta);
 
+        /**
+         * \brief Compute one Gram matrix of size N_TX_virt x N_TX_virt per virtual RX antenna.
+         *
+         * \param N_TX_virt
+         * \param N_RX_virt
+         * \param stage channel of every virtual RX antenna, one row per virtual TX antenna
+         * \param gram destination, N_RX_virt matrices stored consecutively in row-major order
+         */
+        static void set_gram(const uint32_t N_TX_virt,
+                             const uint32_t N_RX_virt,
+                             const std::vector<cf_t*>& stage,
+                             std::vector<cf_t>& gram);
+
         [[nodiscard]] static uint32_t mode_single_spatial_stream_3_7(
             const sp3::W_t& W,
             const uint32_t N_TX_virt,
             const uint32_t N_RX_virt,
-            const std::vector<cf_t*>& stage,
-            cf_t* stage_multiplication);
+            const std::vector<cf_t>& gram);
+
+        /**
+         * \brief Exhaustive search across all ranks and beamforming matrices maximizing the
+         * capacity log2(det(I + SNR * W^H * H^H * H * W)).
+         *
+         * \return rank indicator and codebook index
+         */
+        [[nodiscard]] static std::pair<uint32_t, uint32_t> mode_multi_spatial_stream(
+            const sp3::W_t& W,
+            const uint32_t N_TX_virt,
+            const uint32_t N_RX_virt,
+            const std::vector<cf_t>& gram,
+            const float snr_dB);
 };
 
 }  // namespace dectnrp::phy
@@ -50,7 +50,8 @@ class mimo_report_t {
 
         /**
          * \brief These are the recommended beamforming matrix indices for MIMO modes with more than
-         * a single spatial stream.
+         * a single spatial stream. RI and PMI are chosen jointly to maximize the capacity for the
+         * opposite site with N_TS_other antennas. CQI is not set by the PHY.
          */
 
         uint32_t RI{};   // rank indicator
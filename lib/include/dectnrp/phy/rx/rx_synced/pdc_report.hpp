@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "dectnrp/phy/rx/rx_synced/dispersion/dispersion_report.hpp"
 #include "dectnrp/phy/rx/rx_synced/mimo/mimo_report.hpp"
 #include "dectnrp/sections_part4/mac_pdu/mac_pdu_decoder.hpp"
 
@@ -31,15 +32,18 @@ class pdc_report_t {
             : crc_status(false),
               mac_pdu_decoder(mac_pdu_decoder_),
               snr_dB(0.0f),
-              mimo_report(mimo_report_t()) {};
+              mimo_report(mimo_report_t()),
+              dispersion_report(dispersion_report_t()) {};
 
         explicit pdc_report_t(const sp4::mac_pdu_decoder_t& mac_pdu_decoder_,
                               const float snr_dB_,
-                              const mimo_report_t mimo_report_)
+                              const mimo_report_t mimo_report_,
+                              const dispersion_report_t dispersion_report_)
             : crc_status(true),
               mac_pdu_decoder(mac_pdu_decoder_),
               snr_dB(snr_dB_),
-              mimo_report(mimo_report_) {};
+              mimo_report(mimo_report_),
+              dispersion_report(dispersion_report_) {};
 
         /// 24 bit CRC attached to transport block
         const bool crc_status;
@@ -59,6 +63,12 @@ class pdc_report_t {
          * which the transmitter should have used for optimal receive conditions.
          */
         const mimo_report_t mimo_report;
+
+        /**
+         * \brief RMS delay spread and maximum Doppler spread of the packet. Cached by the MAC per
+         * contact and passed back to the PHY for the next packet.
+         */
+        const dispersion_report_t dispersion_report;
 };
 
 }  // namespace dectnrp::phy
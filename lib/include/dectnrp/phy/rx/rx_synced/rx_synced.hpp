@@ -34,12 +34,14 @@
 #include "dectnrp/phy/rx/rx_synced/aoa/estimator_aoa.hpp"
 #include "dectnrp/phy/rx/rx_synced/channel_estimation/channel_antennas.hpp"
 #include "dectnrp/phy/rx/rx_synced/channel_estimation/channel_luts.hpp"
+#include "dectnrp/phy/rx/rx_synced/dispersion/estimator_dispersion.hpp"
 #include "dectnrp/phy/rx/rx_synced/mimo/estimator_mimo.hpp"
 #include "dectnrp/phy/rx/rx_synced/offsets/estimator_cfo.hpp"
 #include "dectnrp/phy/rx/rx_synced/offsets/estimator_sto.hpp"
 #include "dectnrp/phy/rx/rx_synced/pcc_report.hpp"
 #include "dectnrp/phy/rx/rx_synced/pdc_report.hpp"
 #include "dectnrp/phy/rx/rx_synced/processing_stage.hpp"
+#include "dectnrp/phy/rx/rx_synced/rx_synced_kernels.hpp"
 #include "dectnrp/phy/rx/rx_synced/snr/estimator_snr.hpp"
 #include "dectnrp/phy/rx/sync/sync_report.hpp"
 #include "dectnrp/phy/tx_rx.hpp"
@@ -156,6 +158,7 @@ class rx_synced_t final : public tx_rx_t, public rx_pacer_t {
         std::unique_ptr<estimator_snr_t> estimator_snr;
         std::unique_ptr<estimator_mimo_t> estimator_mimo;
         std::unique_ptr<estimator_aoa_t> estimator_aoa;
+        std::unique_ptr<estimator_dispersion_t> estimator_dispersion;
 
         /**
          * \brief Every channel estimation is conducted within one processing stage in one of two
@@ -187,6 +190,17 @@ class rx_synced_t final : public tx_rx_t, public rx_pacer_t {
          */
         const uint32_t chestim_mode_lr_t_stride;
 
+        /**
+         * \brief Mode and stride used for the PDC of the current packet. Without a dispersion hint
+         * from the MAC, both are equal to the defaults above. With a hint, mode lr and a small
+         * stride are only used if the Doppler spread or the SNR require it.
+         */
+        bool chestim_mode_lr_packet;
+        uint32_t chestim_mode_lr_t_stride_packet;
+
+        /// delay and Doppler spread of the sender as cached by the MAC, unknown during the PCC
+        dispersion_report_t dispersion_hint;
+
         /**
          * \brief The process of channel estimation for any RX antenna is always the same, i.e. it
          * does not depend on the RX antenna index. Thus, when estimating the channel at any RX
@@ -225,6 +239,17 @@ class rx_synced_t final : public tx_rx_t, public rx_pacer_t {
          */
         channel_antennas_t channel_antennas;
 
+        /**
+         * \brief Kernels specialized at compile time for N_RX and for the number of pilots used
+         * for interpolation, see rx_synced_kernels.hpp. A nullptr selects the generic VOLK path.
+         * interp_kernels is indexed by the number of pilots used for interpolation.
+         */
+        kernels::mrc_func_t mrc_kernel{nullptr};
+        std::vector<kernels::interp_func_t> interp_kernels;
+
+        /// channel estimation of transmit stream 0, one pointer per RX antenna
+        std::vector<const cf_t*> chestim_ts0;
+
         /**
          * \brief After collecting and demapping all PCC cells, we decode both PLCF type 1 and type
          * 2 and check the CRC for both versions. For this, we use the variable hb_rx_plcf which
@@ -284,8 +309,11 @@ class rx_synced_t final : public tx_rx_t, public rx_pacer_t {
         const sp3::packet_sizes_t* packet_sizes;
         harq::buffer_rx_t* hb_tb;
 
-        /// demapper type
-        srsran_mod_t srsran_mod;
+        /// scrambling sequence of the current packet with one bit per byte, used by the demapper
+        const uint8_t* scrambling_c;
+
+        /// LLR scale of the current packet, depends on the modulation order and the SNR
+        float llr_scale;
 
         // ##################################################
         // RX synced specific functions
@@ -323,6 +351,11 @@ class rx_synced_t final : public tx_rx_t, public rx_pacer_t {
          * a valid SNR estimation is available
          */
         void run_drs_channel_lut_pick();
+        /**
+         * \brief Called once the MAC has requested the PDC. Based on the dispersion hint, picks the
+         * Wiener filter, the mode lr and the stride for the remainder of the packet.
+         */
+        void run_pdc_chestim_config_pick();
         /**
          * \brief Called when channel estimation can be started. If chestim_mode_lr=true, the entire
          * processing stage with DRS symbols to the left and right has to be collected first. If
@@ -366,6 +399,19 @@ class rx_synced_t final : public tx_rx_t, public rx_pacer_t {
         void run_pdc_mode_transmit_diversity();
         void run_pdc_mode_AxA_MIMO();
 
+        /// demap N_cells cells in mixer_stage[0] into the d bits of the HARQ buffer
+        void run_pdc_demapping(const uint32_t N_cells);
+
+        /**
+         * \brief MRC of transmit stream 0 for all cells in runs. Only cells within runs are
+         * combined, and the output is compacted into mixer_stage[0] so that it can be demapped with
+         * a single call. Same function is used for PCC and PDC.
+         *
+         * \param runs runs of subcarrier indices of the current OFDM symbol
+         * \return number of cells written to mixer_stage[0]
+         */
+        uint32_t run_pxx_mrc_compacted(const std::vector<sp3::df_pxc_t::run_t>& runs);
+
         /// same function can be reused for PCC and PDC
         void run_pxx_mode_transmit_diversity(const std::vector<uint32_t>& k_i_one_symbol,
                                              const uint32_t PXX_idx);
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "dectnrp/common/complex.hpp"
+#include "dectnrp/phy/rx/rx_synced/rx_synced_param.hpp"
+
+/**
+ * \brief Kernels of rx_synced_t with dimensions fixed at compile time. With the CMake option
+ * ENABLE_SPECIALIZED, kernels are instantiated for the number of RX antennas listed in
+ * PHY_KERNELS_N_RX and for the interpolation lengths listed in PHY_KERNELS_NOF_DRS_INTERP. Inner
+ * loops over antennas and pilots are then fully unrolled, and the compiler can vectorize across
+ * subcarriers.
+ *
+ * Dispatch happens once when rx_synced_t is constructed by the worker pool. If there is no
+ * instance for a dimension, the getters return nullptr and rx_synced_t keeps using its generic
+ * VOLK path. The bandwidth index b and the oversampling only change vector lengths, not the loop
+ * structure, so they are not template parameters.
+ */
+
+namespace dectnrp::phy::kernels {
+
+/**
+ * \brief Maximum ratio combining of one transmit stream across all RX antennas.
+ *
+ * \param out output of length len
+ * \param y received OFDM symbol, one pointer per RX antenna
+ * \param h channel estimation of transmit stream 0, one pointer per RX antenna
+ * \param offset first subcarrier read from y and h
+ * \param len number of subcarriers
+ */
+using mrc_func_t = void (*)(cf_t* out,
+                            const cf_t* const* y,
+                            const cf_t* const* h,
+                            const uint32_t offset,
+                            const uint32_t len);
+
+/**
+ * \brief Channel interpolation of one transmit stream of one RX antenna with the weights of a
+ * channel_lut_t.
+ *
+ * \param chestim output of length len
+ * \param drs_zf zero-forced channel estimation at DRS cells
+ * \param idx_pilot index of the first pilot used for each subcarrier
+ * \param idx_weights index of the weight vector used for each subcarrier
+ * \param weight_vecs all weight vectors of the LUT
+ * \param len number of subcarriers
+ */
+using interp_func_t = void (*)(cf_t* chestim,
+                               const cf_t* drs_zf,
+                               const RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_pilot,
+                               const RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_weights,
+                               const RX_SYNCED_PARAM_WEIGHTS_TYPE* weight_vecs,
+                               const uint32_t len);
+
+/// specialized MRC for N_RX antennas, nullptr if not instantiated
+[[nodiscard]] mrc_func_t get_mrc(const uint32_t N_RX);
+
+/// specialized channel interpolation for nof_drs_subc_interp pilots, nullptr if not instantiated
+[[nodiscard]] interp_func_t get_interp(const uint32_t nof_drs_subc_interp);
+
+}  // namespace dectnrp::phy::kernels
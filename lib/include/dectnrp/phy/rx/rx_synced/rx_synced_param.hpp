@@ -212,9 +212,12 @@ namespace dectnrp::phy {
 #endif
 
 // clang-format off
-/// default values for Wiener filter statistics
-#define RX_SYNCED_PARAM_NU_MAX_HZ_VEC {100.0, 100.0, 500.0f}
-#define RX_SYNCED_PARAM_TAU_RMS_SEC_VEC {0.1e-6, 0.1e-6, 1.0e-6}
+/**
+ * \brief Default values for Wiener filter statistics. The last two entries are used for links
+ * with a measured delay or Doppler spread too large for the first two entries at the same SNR.
+ */
+#define RX_SYNCED_PARAM_NU_MAX_HZ_VEC {100.0, 100.0, 500.0, 500.0, 500.0}
+#define RX_SYNCED_PARAM_TAU_RMS_SEC_VEC {0.1e-6, 0.1e-6, 1.0e-6, 1.0e-6, 1.0e-6}
 
 /**
  * \brief For channel estimation based on a Wiener filter, the SNR determines the amount of smoothing
@@ -222,20 +225,28 @@ namespace dectnrp::phy {
  * performance, it is best to precalculate multiple Wiener filters for different SNRs, estimate the
  * instantaneous SNR during decoding and the pick the best fitting Wiener filter.
  */
-#define RX_SYNCED_PARAM_SNR_DB_VEC {-5.0, 15.0, 35.0}
+#define RX_SYNCED_PARAM_SNR_DB_VEC {-5.0, 15.0, 35.0, -5.0, 15.0}
 
 /**
  * \brief Number of consecutive DRS pilots used for interpolation, with pilots being interlaced for mode
  * lr. Determines the computational complexity of interpolation.
  */
-#define RX_SYNCED_PARAM_NOF_DRS_INTERP_LR_VEC {14, 8, 3}
-#define RX_SYNCED_PARAM_NOF_DRS_INTERP_L_VEC {7, 4, 2}
+#define RX_SYNCED_PARAM_NOF_DRS_INTERP_LR_VEC {14, 8, 3, 10, 6}
+#define RX_SYNCED_PARAM_NOF_DRS_INTERP_L_VEC {7, 4, 2, 5, 3}
 // clang-format on
 
 /// optimization flags to speed up LUT generation
 #define RX_SYNCED_PARAM_CHANNEL_LUT_OPT_INDEX_PREVIOUS
 #define RX_SYNCED_PARAM_CHANNEL_LUT_SEARCH_ABORT_THRESHOLD 1.1
 
+/**
+ * \brief LUTs are generated once per set of statistics and shared read-only by all workers. If
+ * defined, generated LUTs are additionally written to a binary file with this prefix and mapped
+ * into memory on later starts instead of being regenerated. The file name contains all generation
+ * parameters, changing any of them automatically leads to a new file.
+ */
+// #define RX_SYNCED_PARAM_CHANNEL_LUT_CACHE_FILE_PREFIX "bin/channel_lut_"
+
 /**
  * \brief Wiener filter coefficients are chosen based on the SNR estimation. The SNR estimation is
  * improved after every new OFDM symbol with DRS cells. We can make the coefficients lookup either
@@ -251,6 +262,41 @@ namespace dectnrp::phy {
 #define RX_SYNCED_PARAM_SNR_BASED_ON_DRS
 #define RX_SYNCED_PARAM_SNR_BASED_ON_DRS_N_TS_MAX 8U
 
+// ####################################################
+// Soft demapper
+// ####################################################
+
+/**
+ * \brief PDC LLRs are scaled with the SNR estimated for the packet. At and above this SNR, LLRs
+ * have the same fixed-point scale as srsran's demapper. Below, the scale decreases proportionally
+ * to the SNR.
+ */
+#define RX_SYNCED_PARAM_DEMAPPER_SNR_DB_FULL_SCALE 10.0f
+
+/// lower bound of the SNR-dependent scale, prevents small LLRs from being quantized to zero
+#define RX_SYNCED_PARAM_DEMAPPER_SCALE_MIN 0.125f
+
+// ####################################################
+// Delay and Doppler spread
+// ####################################################
+
+/**
+ * \brief RMS delay spread and maximum Doppler spread are estimated for every packet and reported to
+ * the MAC. The MAC caches the values per contact and passes them back to the PHY as a hint when
+ * requesting the PDC of the next packet of the same contact. With a hint, the PHY picks the Wiener
+ * filter, the channel estimation mode lr and the stride for each packet individually.
+ */
+#define RX_SYNCED_PARAM_DISPERSION_BASED_ON_DRS
+
+/**
+ * \brief A channel estimate is considered adequate for a number of OFDM symbols if the error caused
+ * by the Doppler spread is this much smaller than the noise power.
+ */
+#define RX_SYNCED_PARAM_DISPERSION_ERROR_MARGIN_DB 10.0f
+
+/// below this SNR, the mode lr is always used as it averages twice as many DRS cells
+#define RX_SYNCED_PARAM_DISPERSION_LR_SNR_DB_MAX 0.0f
+
 // ####################################################
 // Multiple Input Multiple Output (MIMO)
 // ####################################################
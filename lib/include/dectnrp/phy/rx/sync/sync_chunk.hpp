@@ -25,6 +25,7 @@
 #include <memory>
 #include <optional>
 
+#include "dectnrp/common/prog/metrics.hpp"
 #include "dectnrp/phy/rx/rx_pacer.hpp"
 #include "dectnrp/phy/rx/sync/autocorrelator_detection.hpp"
 #include "dectnrp/phy/rx/sync/autocorrelator_peak.hpp"
@@ -85,13 +86,13 @@ class sync_chunk_t final : public rx_pacer_t {
         const uint32_t chunk_offset_samples;
 
         struct stats_t {
-                int64_t waitings_for_chunk{0};
-                int64_t detections{0};
-                int64_t coarse_peaks{0};
-                int64_t chunk_processed_without_detection_at_the_end{0};
+                metrics::counter_t waitings_for_chunk;
+                metrics::counter_t detections;
+                metrics::counter_t coarse_peaks;
+                metrics::counter_t chunk_processed_without_detection_at_the_end;
         };
 
-        stats_t get_stats() const { return stats; };
+        const stats_t& get_stats() const { return stats; };
 
     private:
         /// all these values refer to the maximum value of the radio device class
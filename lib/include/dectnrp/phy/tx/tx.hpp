@@ -20,10 +20,15 @@
 
 #pragma once
 
+#include <pthread.h>
+
+#include <atomic>
+
 extern "C" {
 #include "srsran/phy/modem/modem_table.h"
 }
 
+#include "dectnrp/common/thread/threads.hpp"
 #include "dectnrp/phy/mix/mixer.hpp"
 #include "dectnrp/phy/resample/resampler.hpp"
 #include "dectnrp/phy/tx/tx_descriptor.hpp"
@@ -35,6 +40,22 @@ extern "C" {
 #define PHY_TX_BACKPRESSURED_OR_PACKET_IS_ALWAYS_COMPLETE
 #define PHY_TX_PCC_FLIPPING_WITH_SIMD
 
+/* For radio devices with at least PHY_TX_ANTENNA_LANES_MIN_N_TX antennas, the per-antenna back end
+ * of every OFDM symbol (scaling, IFFT, CP, resampling and frequency shift) is split into lanes of
+ * PHY_TX_ANTENNA_LANE_N_TX antennas. Lane 0 runs on the thread calling generate_tx_packet(), every
+ * other lane on a helper thread owned by tx_t. If undefined, a single lane processes all antennas.
+ */
+#define PHY_TX_ANTENNA_LANES_MIN_N_TX 4
+#ifdef PHY_TX_ANTENNA_LANES_MIN_N_TX
+#define PHY_TX_ANTENNA_LANE_N_TX 2
+#endif
+
+/// number of packets each instance of tx_t can cache, see tx_meta_t::cacheable
+#define PHY_TX_WAVEFORM_CACHE 4
+#ifdef PHY_TX_WAVEFORM_CACHE
+#include "dectnrp/phy/tx/tx_cache.hpp"
+#endif
+
 // #define PHY_TX_OFDM_WINDOWING 0.25f
 #ifdef PHY_TX_OFDM_WINDOWING
 #include "dectnrp/phy/dft/windowing.hpp"
@@ -47,6 +68,7 @@ extern "C" {
 // #define PHY_TX_JSON_EXPORT
 #ifdef PHY_TX_JSON_EXPORT
 #undef PHY_TX_BACKPRESSURED_OR_PACKET_IS_ALWAYS_COMPLETE
+#undef PHY_TX_WAVEFORM_CACHE
 #endif
 
 namespace dectnrp::phy {
@@ -59,10 +81,16 @@ class tx_t final : public tx_rx_t {
          * \param maximum_packet_sizes_ maximum sizes defined by radio device class
          * \param os_min_ minimum oversampling for largest bandwidth
          * \param resampler_param_ resampler configuration
+         * \param lane_helper_config_vec_ priority and core of helper threads, one per lane except
+         * lane 0, if empty scheduler picks both
+         * \param N_TX_per_lane_ antennas per lane, if 0 given by get_N_TX_per_lane()
          */
         explicit tx_t(const sp3::packet_sizes_t maximum_packet_sizes_,
                       const uint32_t os_min_,
-                      const resampler_param_t resampler_param_);
+                      const resampler_param_t resampler_param_,
+                      const std::vector<common::threads_core_prio_config_t>&
+                          lane_helper_config_vec_ = {},
+                      const uint32_t N_TX_per_lane_ = 0);
         ~tx_t();
 
         tx_t() = delete;
@@ -80,6 +108,33 @@ class tx_t final : public tx_rx_t {
         void generate_tx_packet(const tx_descriptor_t& tx_descriptor_,
                                 radio::buffer_tx_t& buffer_tx_);
 
+        /**
+         * \brief Number of samples generate_tx_packet() writes at most into buffer_tx_t for a
+         * packet with the given sizes, including the full GI and the final samples flushed out of
+         * the resampler. Used to request a buffer_tx_t of exactly this length.
+         *
+         * \param packet_sizes_ sizes of the packet to be generated
+         * \return number of samples per antenna
+         */
+        [[nodiscard]] uint32_t get_N_samples_buffer_tx(
+            const sp3::packet_sizes_t& packet_sizes_) const;
+
+        /**
+         * \brief Default number of antennas per lane, see PHY_TX_ANTENNA_LANES_MIN_N_TX.
+         *
+         * \param N_TX_max maximum number of antennas of the radio device class
+         * \return number of antennas per lane
+         */
+        [[nodiscard]] static uint32_t get_N_TX_per_lane(const uint32_t N_TX_max);
+
+        /**
+         * \brief Default number of lanes. Every lane but lane 0 requires one helper thread.
+         *
+         * \param N_TX_max maximum number of antennas of the radio device class
+         * \return number of lanes
+         */
+        [[nodiscard]] static uint32_t get_nof_lanes(const uint32_t N_TX_max);
+
     private:
         // ##################################################
         // TX specific variables initialized once in the constructor
@@ -94,11 +149,50 @@ class tx_t final : public tx_rx_t {
         /// beamforming
         sp3::W_t W;
 
-        /// resampler and resampling ratio do not change
-        std::unique_ptr<resampler_t> resampler;
+        /**
+         * \brief A lane is the back end of a contiguous group of antennas. resampler_t and
+         * mixer_t keep a single state for all antennas they process, so each lane has its own
+         * instances. Lanes are initialized identically for every packet and thus evolve
+         * identically.
+         */
+        struct lane_t {
+                tx_t* tx;
+                uint32_t ant_first;
+                uint32_t N_TX_max;
+
+                /// number of antennas of current packet in this lane, can be zero
+                uint32_t N_TX;
+
+                /// resampler and resampling ratio do not change
+                std::unique_ptr<resampler_t> resampler;
+
+                /// used to frequency shift the signal of this lane
+                mixer_t mixer;
+
+                /// pointers to the stages and antenna ports of this lane
+                std::vector<const cf_t*> ifft_cp_stage;
+                std::vector<cf_t*> antenna_ports_now;
+
+                /// number of samples the last job has written per antenna port
+                uint32_t N_new_output_samples;
+
+                pthread_t thread;
+        };
+
+        std::vector<std::unique_ptr<lane_t>> lane_vec;
 
-        /// used to frequency shift entire signal
-        mixer_t mixer;
+        /// what every lane does next, written before and read after lane_generation changes
+        struct lane_job_t {
+                uint32_t N_samples_in_CP_os{0};
+                float scale{0.0f};
+                bool stf{false};
+                bool residual{false};
+        } lane_job;
+
+        /// synchronization between the thread calling generate_tx_packet() and helper threads
+        std::atomic<bool> lane_keep_running{false};
+        std::atomic<uint32_t> lane_generation{0};
+        std::atomic<uint32_t> lane_pending{0};
 
         /**
          * \brief What is a stage?
@@ -125,9 +219,20 @@ class tx_t final : public tx_rx_t {
         cf_t* beamforming_stage;
         std::vector<cf_t*> antenna_mapper_stage;
 
+        /**
+         * \brief While the lanes process the back end of OFDM symbol N on this second set of
+         * stages, symbol N+1 is already mapped and beamformed onto antenna_mapper_stage. Both are
+         * swapped after the lanes have finished.
+         */
+        std::vector<cf_t*> antenna_mapper_stage_lanes;
+
         /// stage in time domain, resampler writes directly into buffer_tx_
         std::vector<cf_t*> ifft_cp_stage;
 
+#ifdef PHY_TX_WAVEFORM_CACHE
+        std::unique_ptr<tx_cache_t> tx_cache;
+#endif
+
         // ##################################################
         // TX specific variables updated for every new packet
 
@@ -143,7 +248,9 @@ class tx_t final : public tx_rx_t {
 
         /// pointer to antennas ports/streams
         std::vector<cf_t*> antenna_ports;
-        std::vector<cf_t*> antenna_ports_now;
+
+        /// number of lanes with at least one antenna in use
+        uint32_t N_lanes_active;
 
 #ifdef PHY_TX_JSON_EXPORT
         double oversampling;
@@ -183,11 +290,28 @@ class tx_t final : public tx_rx_t {
         void run_residual_resampling();
         void run_GI();
 
+#ifdef PHY_TX_WAVEFORM_CACHE
+        /// copies samples of identical packet from cache into buffer_tx, false if not cached
+        bool run_waveform_cache_lookup();
+#endif
+
         /// called for each OFDM symbol (arguments are necessary to distinguish STF and DF symbols)
         void run_zero_stages();
         void run_beamforming(const uint32_t N_TS_non_zero);
-        void run_ifft_cp_scale(const uint32_t N_samples_in_CP_os, float scale);
-        void run_resampling_and_freq_shift(const uint32_t N_samples_in_CP_os);
+        void run_frequency_domain();
+        void run_lanes_dispatch(const lane_job_t lane_job_);
+        void run_lanes_join();
+        void run_back_end_advance();
+
+        /// called by every lane for its antennas
+        void run_lane(lane_t& lane);
+        void run_ifft_cp_scale(lane_t& lane);
+        void run_resampling_and_freq_shift(lane_t& lane);
+        void run_residual_resampling(lane_t& lane);
+
+        /// entry point and loop of helper threads
+        static void* lane_spawn(void* lane);
+        void lane_work(lane_t& lane);
 
         /// called for each OFDM symbol which contains the respective type of subcarriers
         void run_stf();
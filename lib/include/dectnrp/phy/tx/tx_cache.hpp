@@ -0,0 +1,96 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "dectnrp/phy/tx/tx_descriptor.hpp"
+#include "dectnrp/radio/complex.hpp"
+
+namespace dectnrp::phy {
+
+/**
+ * \brief Cache of final IQ samples of recently generated packets. A packet can be served from the
+ * cache if every input which determines its samples is identical, i.e. PLCF bits, TB bits, packet
+ * sizes, PLCF type, network ID, redundancy version, codebook index and the PHY meta data. The
+ * samples are stored after resampling and frequency shift, so a hit is a plain copy into the TX
+ * buffer.
+ *
+ * Only packets flagged by the MAC layer as cacheable (see tx_meta_t) are looked up and inserted.
+ * Each instance of tx_t has its own cache, so no locking is required.
+ */
+class tx_cache_t {
+    public:
+        /**
+         * \brief Memory of an entry is allocated upon first insertion and reused afterwards.
+         *
+         * \param nof_entries_ number of packets which can be cached
+         */
+        explicit tx_cache_t(const uint32_t nof_entries_);
+        ~tx_cache_t() = default;
+
+        tx_cache_t() = delete;
+        tx_cache_t(const tx_cache_t&) = delete;
+        tx_cache_t& operator=(const tx_cache_t&) = delete;
+        tx_cache_t(tx_cache_t&&) = delete;
+        tx_cache_t& operator=(tx_cache_t&&) = delete;
+
+        struct entry_t {
+                std::vector<uint8_t> key;
+                uint64_t key_hash{0};
+                uint32_t N_samples{0};
+                std::vector<std::vector<radio::cf32_t>> ant_streams;
+                int64_t last_use{-1};
+        };
+
+        /// must be called for every new packet before find() or insert()
+        void set_key(const tx_descriptor_t& tx_descriptor);
+
+        /// entry matching the last key set, nullptr if there is none
+        [[nodiscard]] const entry_t* find();
+
+        /**
+         * \brief Overwrites the least recently used entry with the samples of the last key set.
+         *
+         * \param ant_streams first sample of each antenna stream
+         * \param N_TX number of antenna streams written
+         * \param N_samples number of samples per antenna stream
+         */
+        void insert(const std::vector<radio::cf32_t*>& ant_streams,
+                    const uint32_t N_TX,
+                    const uint32_t N_samples);
+
+    private:
+        std::vector<entry_t> entries;
+
+        std::vector<uint8_t> key;
+        uint64_t key_hash{0};
+
+        /// incremented for every lookup, used to find least recently used entry
+        int64_t use_cnt{0};
+
+        void append_to_key(const uint8_t* src, const uint32_t N_byte);
+        void append_to_key(const uint32_t value);
+        void append_to_key(const float value);
+};
+
+}  // namespace dectnrp::phy
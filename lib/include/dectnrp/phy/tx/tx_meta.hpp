@@ -55,6 +55,16 @@ struct tx_meta_t {
          *      32 * 4/100 = 1.28 > 1
          */
         uint32_t GI_percentage;
+
+        /**
+         * \brief Packets which are transmitted repeatedly with identical content (same PLCF, TB,
+         * packet sizes, network ID, rv, codebook and meta data) can be flagged as cacheable. TX
+         * then stores the final IQ samples and copies them into the TX buffer for any later
+         * identical packet instead of generating it again. Every cacheable packet is hashed, and
+         * every miss is copied into the cache. Packets with changing fields, for instance beacons
+         * carrying the SFN or a time announcement, must therefore not be flagged.
+         */
+        bool cacheable{false};
 };
 
 }  // namespace dectnrp::phy
@@ -30,6 +30,7 @@
 #include "dectnrp/common/layer/layer_unit.hpp"
 #include "dectnrp/phy/interfaces/layers_downwards/phy_radio.hpp"
 #include "dectnrp/phy/pool/baton.hpp"
+#include "dectnrp/phy/pool/elastic.hpp"
 #include "dectnrp/phy/pool/irregular_queue.hpp"
 #include "dectnrp/phy/pool/job_queue.hpp"
 #include "dectnrp/phy/pool/token.hpp"
@@ -106,6 +107,14 @@ class worker_pool_t final : public common::layer_unit_t {
 
         irregular_queue_t irregular_queue;
 
+#ifdef PHY_POOL_ELASTIC
+        /// time without load before parking another worker_tx_rx_t
+        static constexpr int64_t ELASTIC_HOLD_MS{500};
+#endif
+
+        /// number of active worker_tx_rx_t, nullptr if all are always active
+        std::unique_ptr<elastic_t> elastic;
+
         /// export data in real-time
         std::unique_ptr<common::json_export_t> json_export;
 
@@ -24,6 +24,7 @@
 #include <string>
 #include <vector>
 
+#include "dectnrp/common/thread/cpu_topology.hpp"
 #include "dectnrp/common/thread/threads.hpp"
 #include "dectnrp/constants.hpp"
 #include "dectnrp/phy/resample/resampler_param.hpp"
@@ -114,6 +115,21 @@ struct worker_pool_config_t {
         std::vector<common::threads_core_prio_config_t> threads_core_prio_config_sync_vec;
         std::vector<common::threads_core_prio_config_t> threads_core_prio_config_tx_rx_vec;
 
+        /**
+         * \brief Helper threads of the TX antenna lanes of every TX/RX thread, see
+         * tx_t::get_nof_lanes(). Helpers have the priority of their TX/RX thread and are placed
+         * automatically if their TX/RX thread is.
+         */
+        std::vector<std::vector<common::threads_core_prio_config_t>>
+            threads_core_prio_config_tx_lane_vec;
+
+        /**
+         * \brief CPU domain picked by automatic thread placement for this worker pool and its
+         * hardware. Buffers of both are allocated on the domain's NUMA node. Invalid if all threads
+         * are placed manually.
+         */
+        common::cpu_domain_t cpu_domain{};
+
         /// rx_synced_t default configuration for channel estimation
         bool chestim_mode_lr_default;
         uint32_t chestim_mode_lr_t_stride_default;
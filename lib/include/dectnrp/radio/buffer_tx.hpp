@@ -33,24 +33,18 @@
 #define RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
 #ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
 #include <condition_variable>
-#include <mutex>
 #endif
 
 namespace dectnrp::radio {
 
+class buffer_tx_pool_t;
+
 class buffer_tx_t final : public common::lockable_outer_inner_t, public common::reporting_t {
     public:
         explicit buffer_tx_t(const uint32_t id_,
                              const uint32_t nof_antennas_,
-                             const uint32_t ant_streams_length_samples_
-#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
-                             ,
-                             std::mutex& tx_new_packet_mutex_,
-                             std::condition_variable& tx_new_packet_cv_,
-                             uint32_t& tx_new_packet_cnt_
-#endif
-        );
-        ~buffer_tx_t();
+                             buffer_tx_pool_t& buffer_tx_pool_);
+        ~buffer_tx_t() = default;
 
         buffer_tx_t() = delete;
         buffer_tx_t(const buffer_tx_t&) = delete;
@@ -58,6 +52,13 @@ class buffer_tx_t final : public common::lockable_outer_inner_t, public common::
         buffer_tx_t(buffer_tx_t&&) = delete;
         buffer_tx_t& operator=(buffer_tx_t&&) = delete;
 
+        /**
+         * \brief Samples are written into a region of the pool's arena which was allocated with
+         * the length requested in buffer_tx_pool_t::get_buffer_tx_to_fill().
+         *
+         * \param ant_streams_ one pointer per antenna to the first sample of the region
+         * \param tx_length_samples_ number of samples to transmit, at most the region's length
+         */
         void get_ant_streams(std::vector<cf32_t*>& ant_streams_, const uint32_t tx_length_samples_);
 
         void set_transmittable(const struct buffer_tx_meta_t buffer_tx_meta_);
@@ -70,9 +71,13 @@ class buffer_tx_t final : public common::lockable_outer_inner_t, public common::
          */
         void set_tx_length_samples_cnt(const uint32_t tx_length_samples_cnt_);
 
+        /// length of the region allocated in the arena, only valid while outer locked
+        [[nodiscard]] uint32_t get_ant_streams_length_samples() const {
+            return ant_streams_length_samples;
+        };
+
         const uint32_t id;
         const uint32_t nof_antennas;
-        const uint32_t ant_streams_length_samples;
 
         friend class buffer_tx_pool_t;
 
@@ -98,26 +103,27 @@ class buffer_tx_t final : public common::lockable_outer_inner_t, public common::
         void set_zero(const uint32_t offset, const uint32_t length);
         void set_zero();
 
-        /// called when radio thread has finished reading all samples
+        /// called when radio thread has finished reading all samples, releases the region
         void set_transmitted_or_abort();
 
         /// put internals into re-lockable state
         void reset();
 
-        /// one buffer/pointer per antenna stream
+        /// one pointer per antenna stream into the arena, set when the region is allocated
         std::vector<cf32_t*> ant_streams;
 
+        /// region in the arena, same offset for all antenna streams
+        uint32_t arena_offset{0};
+        uint32_t ant_streams_length_samples{0};
+
         /// enables back pressure
         std::atomic<uint32_t> tx_length_samples{0};
         std::atomic<uint32_t> tx_length_samples_cnt{0};
 
         buffer_tx_meta_t buffer_tx_meta{};
 
-#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
-        std::mutex& tx_new_packet_mutex;
-        std::condition_variable& tx_new_packet_cv;
-        uint32_t& tx_new_packet_cnt;
-#endif
+        /// owning pool, notified when this buffer becomes transmittable
+        buffer_tx_pool_t& buffer_tx_pool;
 };
 
 }  // namespace dectnrp::radio
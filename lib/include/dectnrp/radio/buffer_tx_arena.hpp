@@ -0,0 +1,134 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "dectnrp/constants.hpp"
+#include "dectnrp/radio/complex.hpp"
+
+namespace dectnrp::radio {
+
+/**
+ * \brief Backing memory of all TX buffers of one buffer_tx_pool_t. Every antenna has one
+ * contiguous stream, and a region is always placed at the same offset in every antenna stream.
+ * Regions are handed out first-fit with exactly the requested length rounded up to full cache
+ * lines, and neighbouring free regions are merged when released.
+ *
+ * The arena is divided into slots, each as long as the longest packet. A region never crosses the
+ * boundary between two slots, so every allocated region occupies exactly one slot, and a region of
+ * maximum length is available as long as fewer regions than slots are allocated. This is the same
+ * guarantee as with one fixed buffer of maximum length per slot, while short packets share slots.
+ */
+class buffer_tx_arena_t {
+    public:
+        /**
+         * \brief Smallest unit of allocation in samples. Every region starts at a cache line
+         * boundary.
+         */
+        static constexpr uint32_t unit_samples{constants::cache_line_size_byte / sizeof(cf32_t)};
+
+        /**
+         * \param nof_antennas_ number of antenna streams
+         * \param slot_length_samples_ length of the longest region, rounded up to full units
+         * \param nof_slots_ number of regions of maximum length the arena can hold
+         * \param nof_regions_max_ maximum number of regions allocated at the same time
+         */
+        explicit buffer_tx_arena_t(const uint32_t nof_antennas_,
+                                   const uint32_t slot_length_samples_,
+                                   const uint32_t nof_slots_,
+                                   const uint32_t nof_regions_max_);
+        ~buffer_tx_arena_t();
+
+        buffer_tx_arena_t() = delete;
+        buffer_tx_arena_t(const buffer_tx_arena_t&) = delete;
+        buffer_tx_arena_t& operator=(const buffer_tx_arena_t&) = delete;
+        buffer_tx_arena_t(buffer_tx_arena_t&&) = delete;
+        buffer_tx_arena_t& operator=(buffer_tx_arena_t&&) = delete;
+
+        /**
+         * \brief Thread-safe.
+         *
+         * \param length_samples_ requested length in samples
+         * \return offset of the region in every antenna stream, or none if no free region is large
+         * enough
+         */
+        [[nodiscard]] std::optional<uint32_t> allocate(const uint32_t length_samples_);
+
+        /**
+         * \brief Thread-safe. Must only be called with an offset previously returned by
+         * allocate() and the same length.
+         */
+        void release(const uint32_t offset, const uint32_t length_samples_);
+
+        [[nodiscard]] cf32_t* get_ant_stream(const uint32_t ant_idx, const uint32_t offset) const {
+            return ant_streams[ant_idx] + offset;
+        };
+
+        /// samples allocated per antenna stream, including rounding to full units
+        [[nodiscard]] uint32_t get_used_samples() const;
+
+        const uint32_t nof_antennas;
+        const uint32_t slot_length_samples;
+        const uint32_t nof_slots;
+
+        /// length of each antenna stream
+        const uint32_t length_samples;
+
+    private:
+        static uint32_t round_to_unit(const uint32_t length_samples_) {
+            return ((length_samples_ + unit_samples - 1) / unit_samples) * unit_samples;
+        };
+
+        /// asserts that the arena fits into uint32_t before any memory is allocated
+        static uint32_t get_length_samples(const uint32_t slot_length_samples_,
+                                           const uint32_t nof_slots_);
+
+        /// free regions are not merged across this boundary
+        [[nodiscard]] bool is_slot_boundary(const uint32_t offset) const {
+            return offset % slot_length_samples == 0;
+        };
+
+        /// one contiguous stream per antenna
+        std::vector<cf32_t*> ant_streams;
+
+        struct region_t {
+                uint32_t offset;
+                uint32_t length;
+        };
+
+        /**
+         * \brief Free regions sorted by offset and never adjacent to each other within a slot.
+         * Each slot has at most one more free region than allocated regions, so memory is reserved
+         * once and the vector never reallocates.
+         */
+        std::vector<region_t> free_regions;
+
+        uint32_t used_samples{0};
+
+        /// protects free_regions and used_samples
+        mutable std::mutex arena_mutex;
+};
+
+}  // namespace dectnrp::radio
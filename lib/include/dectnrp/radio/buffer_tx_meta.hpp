@@ -28,13 +28,10 @@
 namespace dectnrp::radio {
 
 struct buffer_tx_meta_t {
-        /// first tx packet has order 0
+        /// first tx packet has order 0, only breaks ties between packets with the same tx_time_64
         int64_t tx_order_id{-1};
 
-        /// when set to a value >= 0, the next expected tx_order_id is overwritten in tx thread
-        int64_t tx_order_id_expect_next{-1};
-
-        /// transmission time of first sample
+        /// transmission time of first sample, packets are dispatched in this order
         int64_t tx_time_64{-1};
 
         /// adjustments applied after packet transmission
@@ -22,18 +22,42 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <vector>
 
+#include "dectnrp/common/prog/metrics.hpp"
 #include "dectnrp/radio/buffer_tx.hpp"
+#include "dectnrp/radio/buffer_tx_arena.hpp"
 #include "dectnrp/radio/hw_friends.hpp"
 
+/**
+ * \brief Buffers are dispatched by the radio thread when their start time tx_time_64 is within
+ * this horizon of the current time. Until then, packets which become transmittable later but start
+ * earlier can still overtake. Once dispatched, a burst is committed to the hardware.
+ */
+#define RADIO_BUFFER_TX_POOL_DISPATCH_HORIZON_US 1000
+
+/**
+ * \brief The sample memory of the pool is sized for a given number of packets of maximum length,
+ * configured as nof_buffer_tx_max_length in radio.json. As most packets are much shorter, each of
+ * these maximum-length packets is backed by multiple buffer_tx, all sharing the same arena.
+ */
+#define RADIO_BUFFER_TX_POOL_NOF_BUFFER_TX_PER_MAX_LENGTH 8
+
 namespace dectnrp::radio {
 
 class buffer_tx_pool_t {
     public:
+        /**
+         * \param id_
+         * \param nof_antennas_
+         * \param nof_buffer_tx_max_length_ number of packets of maximum length the arena can hold
+         * \param ant_streams_length_samples_max_ maximum length of a packet
+         */
         explicit buffer_tx_pool_t(const uint32_t id_,
                                   const uint32_t nof_antennas_,
-                                  const uint32_t nof_buffer_tx_,
-                                  const uint32_t ant_streams_length_samples_);
+                                  const uint32_t nof_buffer_tx_max_length_,
+                                  const uint32_t ant_streams_length_samples_max_);
         ~buffer_tx_pool_t() = default;
 
         buffer_tx_pool_t() = delete;
@@ -46,65 +70,155 @@ class buffer_tx_pool_t {
          * \brief Multiple Producers (Threads on PHY)
          *
          * Called by PHY to get a fillable buffer_tx. Actual filling and transmitting is then done
-         * with the help of member functions of buffer_tx. If no buffer is available, pointer will
-         * be nullptr. System should be designed is such a way that an unavailability of buffer_tx
-         * never occurs, in any case, the caller decides on how to react to that.
+         * with the help of member functions of buffer_tx. The buffer_tx receives a region of the
+         * arena with exactly the requested length. If no buffer_tx or no region is available,
+         * pointer will be nullptr. System should be designed is such a way that an unavailability
+         * of buffer_tx never occurs, in any case, the caller decides on how to react to that.
          *
+         * \param ant_streams_length_samples_ maximum number of samples the PHY will write
          * \return pointer to buffer_tx_t, or nullptr
          */
-        buffer_tx_t* get_buffer_tx_to_fill();
+        buffer_tx_t* get_buffer_tx_to_fill(const uint32_t ant_streams_length_samples_);
 
         const uint32_t id;
         const uint32_t nof_antennas;
         const uint32_t nof_buffer_tx;
-        const uint32_t ant_streams_length_samples;
+        const uint32_t ant_streams_length_samples_max;
+
+        friend class buffer_tx_t;
 
         HW_FRIENDS
 
     private:
+        /// asserts before any buffer_tx or sample memory is created
+        static uint32_t get_nof_buffer_tx(const uint32_t nof_buffer_tx_max_length_);
+
+        /// sample memory shared by all buffer_tx
+        buffer_tx_arena_t buffer_tx_arena;
+
         std::vector<std::unique_ptr<buffer_tx_t>> buffer_tx_vec;
 
+        /// called by buffer_tx_t::set_transmitted_or_abort()
+        void release_region(buffer_tx_t& buffer_tx);
+
+        struct fill_stats_t {
+                /// all buffer_tx were in use
+                metrics::counter_t no_buffer_tx;
+                /// a buffer_tx was available, but the arena had no region large enough
+                metrics::counter_t no_region;
+        } fill_stats;
+
+        /// one entry per transmittable buffer, ordered by transmission time
+        struct dispatch_entry_t {
+                int64_t tx_time_64;
+                int64_t tx_order_id;
+                uint32_t idx;
+
+                /// std::push_heap() builds a max-heap, so the comparison is inverted
+                bool operator<(const dispatch_entry_t& rhs) const {
+                    return tx_time_64 != rhs.tx_time_64 ? tx_time_64 > rhs.tx_time_64
+                                                        : tx_order_id > rhs.tx_order_id;
+                }
+        };
+
         /**
-         * \brief Buffers can be written by independent producers and therefore are unordered in
-         * terms of tx_order_id and transmission time. This function can be called to check if a
-         * packet with the specified tx_order_id exists and, if so, what its local index is. Return
-         * value can be -1 if the buffer does not exist yet.
-         *
-         * \param tx_order_id_target
-         * \return
+         * \brief Buffers can be written by independent producers and therefore become
+         * transmittable in any order. Every buffer is pushed into a min-heap keyed on tx_time_64
+         * once it is transmittable, so the radio thread always sees the packet which goes on air
+         * first, no matter which PHY thread finished first. tx_order_id only breaks ties.
          */
-        int32_t get_specific_tx_order_id_if_available(const int64_t tx_order_id_target) const;
+        std::vector<dispatch_entry_t> dispatch_heap;
+
+        /// called by buffer_tx_t::set_transmittable()
+        void push_transmittable(const uint32_t idx);
 
         /**
-         * \brief Waits for packet with specific tx order. Once it is available, return the index of
-         * the buffer_tx in buffer_tx_vec. This function has a timeout (to).
+         * \brief Waits until at least one buffer is transmittable. This function has a timeout
+         * (to).
          *
-         * \param tx_order_id_target
          * \param timeout_ms
-         * \return
+         * \return true if a buffer is transmittable, false on timeout
          */
-        int32_t wait_for_specific_tx_order_id_to(const int64_t tx_order_id_target,
-                                                 const uint32_t timeout_ms) const;
+        bool wait_for_transmittable_to(const uint32_t timeout_ms) const;
 
         /**
-         * \brief Same as above, but keeps spinning until required packet was found. Function is
-         * used on layer radio for time-critical consecutive transmissions. This function has a
-         * timeout (to).
+         * \brief Removes the transmittable buffer with the earliest transmission time from the
+         * heap if it starts before tx_time_limit_64.
          *
-         * \param tx_order_id_target
+         * \param tx_time_limit_64 exclusive upper limit of tx_time_64
+         * \return index of buffer_tx in buffer_tx_vec, or -1
+         */
+        int32_t pop_earliest_before(const int64_t tx_time_limit_64);
+
+        /**
+         * \brief Same as above, but keeps spinning until a packet was found. Function is used on
+         * layer radio for time-critical consecutive transmissions. This function has a timeout
+         * (to).
+         *
+         * \param tx_time_limit_64
          * \param timeout_us
          * \return
          */
-        int32_t wait_for_specific_tx_order_id_busy_to(const int64_t tx_order_id_target,
-                                                      const uint32_t timeout_us) const;
+        int32_t pop_earliest_before_busy_to(const int64_t tx_time_limit_64,
+                                            const uint32_t timeout_us);
+
+        /**
+         * \brief Buffers starting before tx_time_end_64 overlap with the packet on air and cannot
+         * be sent. Starting with the already popped idx, such buffers are appended to overlapping
+         * and the next buffer is popped. The caller aborts all overlapping buffers.
+         *
+         * \param idx index returned by one of the pop functions above, or -1
+         * \param tx_time_limit_64 exclusive upper limit of tx_time_64
+         * \param tx_time_end_64 end of the packet on air
+         * \param overlapping indices of overlapping buffers
+         * \return index of the earliest buffer without overlap, or -1
+         */
+        int32_t skip_overlapping(int32_t idx,
+                                 const int64_t tx_time_limit_64,
+                                 const int64_t tx_time_end_64,
+                                 std::vector<uint32_t>& overlapping);
+
+        /**
+         * \brief Called by the radio thread for a dispatched buffer which cannot go on air, either
+         * because its transmission time has passed or because it overlaps with the packet on air.
+         * The PHY may still be writing, so the buffer is released once all samples were written.
+         *
+         * \param idx
+         * \param late true if transmission time has passed, false if overlapping
+         */
+        void abort_dispatched(const uint32_t idx, const bool late);
+
+        /// time at which each buffer became transmittable, written under tx_new_packet_mutex
+        std::vector<int64_t> transmittable_ns;
+
+        /**
+         * \brief Records the slack between a buffer becoming transmittable and its transmission
+         * time. Called by the radio thread when dispatching.
+         *
+         * \param idx
+         * \param slack_samples time between now and transmission time in samples
+         * \param samp_rate
+         */
+        void observe_slack(const uint32_t idx,
+                           const int64_t slack_samples,
+                           const uint32_t samp_rate);
+
+        struct dispatch_stats_t {
+                /// transmission time had passed when the buffer was dispatched
+                metrics::counter_t late;
+                /// buffer overlapped with the previous packet of the same burst
+                metrics::counter_t dropped;
+                /// slack between becoming transmittable and transmission time in microseconds
+                metrics::histogram_t slack_us;
+        } dispatch_stats;
 
         /// vector of pointers to allocated buffer_tx, ownership is not shared
         std::vector<buffer_tx_t*> get_buffer_tx_vec() const;
 
-#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
+        /// protects dispatch_heap
         mutable std::mutex tx_new_packet_mutex;
+#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
         mutable std::condition_variable tx_new_packet_cv;
-        uint32_t tx_new_packet_cnt;
 #endif
 };
 
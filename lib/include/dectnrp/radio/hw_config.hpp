@@ -38,8 +38,13 @@ struct hw_config_t {
         /// simulator, USRP
         std::string hw_name{};
 
-        /// TX buffers that can be assigned to PHY threads, typical value is 16
-        uint32_t nof_buffer_tx{};
+        /**
+         * \brief TX sample memory given as the number of packets of maximum length it can hold,
+         * typical value is 16. Shorter packets occupy only as much memory as they need, so up to
+         * RADIO_BUFFER_TX_POOL_NOF_BUFFER_TX_PER_MAX_LENGTH times as many TX buffers can be
+         * assigned to PHY threads at the same time.
+         */
+        uint32_t nof_buffer_tx_max_length{};
 
         /// hardware + driver properties, B210 2ms, N- and X-series as low as 100us
         uint32_t turnaround_time_us{};
@@ -20,6 +20,8 @@
 
 #pragma once
 
-#define HW_FRIENDS               \
-    friend class hw_simulator_t; \
-    friend class hw_usrp_t;
+#define HW_FRIENDS                      \
+    friend class hw_simulator_t;        \
+    friend class hw_usrp_t;             \
+    friend class buffer_tx_pool_test_t; \
+    friend class buffer_tx_reader_test_t;
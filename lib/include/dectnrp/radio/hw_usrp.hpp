@@ -38,6 +38,7 @@ class hw_usrp_t final : public hw_t {
         hw_usrp_t& operator=(hw_usrp_t&&) = delete;
 
         static constexpr uint32_t BUFFER_TX_WAIT_NON_CRITICAL_TIMEOUT_MS{100};
+        static constexpr uint32_t BUFFER_TX_DISPATCH_POLL_US{50};
 
         /// what is the name of this hardware?
         static const std::string name;
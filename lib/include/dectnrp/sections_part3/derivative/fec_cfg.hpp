@@ -30,15 +30,16 @@ namespace dectnrp::sp3 {
  * they can be reused across multiple packets.
  */
 struct fec_cfg_t {
-        uint32_t PLCF_type = 0;    // PLCF, 1 for Type 1 and 2 for Type 2
-        bool closed_loop = false;  // PLCF
-        bool beamforming = false;  // PLCF
-        uint32_t N_TB_bits = 0;    // TB
-        uint32_t N_bps = 0;        // TB
-        uint32_t rv = 0;           // TB
-        uint32_t G = 0;            // TB, G = N_SS * N_PDC_subc * N_bps, see 7.6.6
-        uint32_t network_id = 0;   // TB
-        uint32_t Z = 0;            // TB
+        uint32_t PLCF_type = 0;      // PLCF, 1 for Type 1 and 2 for Type 2
+        bool closed_loop = false;    // PLCF
+        bool beamforming = false;    // PLCF
+        uint32_t N_TB_bits = 0;      // TB
+        uint32_t N_bps = 0;          // TB
+        uint32_t rv = 0;             // TB
+        uint32_t G = 0;              // TB, G = N_SS * N_PDC_subc * N_bps, see 7.6.6
+        uint32_t network_id = 0;     // TB
+        uint32_t Z = 0;              // TB
+        bool d_descrambled = false;  // TB, d bits at the receiver already descrambled
 };
 
 }  // namespace dectnrp::sp3
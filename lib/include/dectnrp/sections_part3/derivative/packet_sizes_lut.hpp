@@ -0,0 +1,137 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "dectnrp/sections_part3/derivative/packet_sizes.hpp"
+#include "dectnrp/sections_part3/derivative/packet_sizes_def.hpp"
+
+namespace dectnrp::sp3 {
+
+/**
+ * \brief All packet sizes which fit into the maximum packet sizes of a radio device class,
+ * computed once with get_packet_sizes() and stored in a dense table. Every combination of u, b,
+ * PacketLengthType, PacketLength, tm_mode_index and mcs_index has a fixed position, so looking up
+ * a packet size definition is a single index computation.
+ *
+ * For link adaptation, the table also contains a reverse index. For every u, b, PacketLengthType,
+ * tm_mode_index and upper limit of mcs_index, it lists the transport block sizes achievable with
+ * increasing PacketLength. Finding the shortest packet for a number of bytes is then a binary
+ * search over at most 16 entries.
+ */
+class packet_sizes_lut_t {
+    public:
+        /**
+         * \param maximum_packet_sizes_ maximum packet sizes of the radio device class, see
+         * get_maximum_packet_sizes()
+         */
+        explicit packet_sizes_lut_t(const packet_sizes_t& maximum_packet_sizes_);
+        ~packet_sizes_lut_t() = default;
+
+        packet_sizes_lut_t() = delete;
+        packet_sizes_lut_t(const packet_sizes_lut_t&) = delete;
+        packet_sizes_lut_t& operator=(const packet_sizes_lut_t&) = delete;
+        packet_sizes_lut_t(packet_sizes_lut_t&&) = delete;
+        packet_sizes_lut_t& operator=(packet_sizes_lut_t&&) = delete;
+
+        /**
+         * \brief Same result as get_packet_sizes(), but without any computation.
+         *
+         * \param psdef packet size definition
+         * \return pointer to packet sizes, or nullptr if psdef is ill-defined or exceeds the
+         * maximum packet sizes
+         */
+        [[nodiscard]] const packet_sizes_t* get_packet_sizes(const packet_sizes_def_t& psdef) const;
+
+        /**
+         * \brief Finds the shortest packet which carries at least N_TB_byte. If multiple MCS fit
+         * into this PacketLength, the most robust one is picked.
+         *
+         * \param N_TB_byte minimum number of bytes in the transport block
+         * \param u
+         * \param b
+         * \param PacketLengthType 0 for subslots, 1 for slots
+         * \param tm_mode_index
+         * \param mcs_index_max largest MCS allowed by the link quality
+         * \return pointer to packet sizes, or nullptr if no packet is large enough
+         */
+        [[nodiscard]] const packet_sizes_t* get_packet_sizes_min(
+            const uint32_t N_TB_byte,
+            const uint32_t u,
+            const uint32_t b,
+            const uint32_t PacketLengthType,
+            const uint32_t tm_mode_index,
+            const uint32_t mcs_index_max) const;
+
+        /// number of well-defined packet sizes in the table
+        [[nodiscard]] uint32_t get_nof_packet_sizes() const {
+            return static_cast<uint32_t>(packet_sizes_vec.size());
+        };
+
+        const packet_sizes_t maximum_packet_sizes;
+
+    private:
+        static constexpr uint32_t nof_u{4};
+        static constexpr uint32_t nof_b{6};
+        static constexpr uint32_t nof_PacketLengthType{2};
+        static constexpr uint32_t nof_PacketLength{16};
+        static constexpr uint32_t nof_tm_mode{12};
+        static constexpr uint32_t idx_none{UINT32_MAX};
+
+        /// maps u = 1, 2, 4, 8 and b = 1, 2, 4, 8, 12, 16 to consecutive indices, or idx_none
+        static uint32_t get_u_idx(const uint32_t u);
+        static uint32_t get_b_idx(const uint32_t b);
+
+        const uint32_t nof_mcs;
+
+        /// position in index_vec, or idx_none if out of range
+        uint32_t get_index(const packet_sizes_def_t& psdef) const;
+
+        /// position in reverse_vec, mcs_index_max must be valid
+        uint32_t get_index_reverse(const uint32_t u_idx,
+                                   const uint32_t b_idx,
+                                   const uint32_t PacketLengthType,
+                                   const uint32_t tm_mode_index,
+                                   const uint32_t mcs_index_max) const;
+
+        /// dense, one entry per combination, index into packet_sizes_vec or idx_none
+        std::vector<uint32_t> index_vec;
+
+        /// only well-defined packet sizes
+        std::vector<packet_sizes_t> packet_sizes_vec;
+
+        struct reverse_entry_t {
+                /// largest transport block over all MCS up to mcs_index_max
+                uint32_t N_TB_byte;
+                uint32_t PacketLength;
+        };
+
+        /**
+         * \brief One vector per combination of u, b, PacketLengthType, tm_mode_index and
+         * mcs_index_max. Entries are sorted by both N_TB_byte and PacketLength, and a longer packet
+         * is only listed if it carries more bytes than all shorter ones.
+         */
+        std::vector<std::vector<reverse_entry_t>> reverse_vec;
+};
+
+}  // namespace dectnrp::sp3
@@ -58,9 +58,26 @@ class df_pxc_t : public df_t {
         df_pxc_t() = default;
         virtual ~df_pxc_t() = default;
 
+        /// contiguous range of subcarrier indices k_i
+        struct run_t {
+                uint32_t start;
+                uint32_t length;
+        };
+
         /// get indices of subcarrier for OFDM symbol index l
         virtual const std::vector<uint32_t>& get_k_i_one_symbol() const = 0;
 
+        /**
+         * \brief Same subcarriers as get_k_i_one_symbol(), but grouped into runs of consecutive
+         * indices. Within an OFDM symbol, PCC and PDC cells are only interrupted by DRS cells and
+         * the DC subcarrier, so a symbol typically consists of few long runs which can be processed
+         * with contiguous vector operations instead of one gather per cell.
+         */
+        virtual const std::vector<run_t>& get_k_i_runs_one_symbol() const = 0;
+
+        /// convert ascending subcarrier indices to runs of consecutive indices
+        static std::vector<run_t> get_runs(const std::vector<uint32_t>& k_i);
+
     protected:
         /**
          * \brief Will have up to 6 rows, each containing one matrix, total size is [6][4][nof l].
@@ -74,6 +91,12 @@ class df_pxc_t : public df_t {
          * symbols starting with 0 in the range of the occupied subcarriers.
          */
         common::vec4d<uint32_t> k_i_all_symbols;
+
+        /// same dimensions as k_i_all_symbols, but each vector of k_i is converted to runs
+        common::vec4d<run_t> k_i_runs_all_symbols;
+
+        /// convert every vector of k_i_all_symbols to runs
+        void init_k_i_runs_all_symbols();
 };
 
 }  // namespace dectnrp::sp3
@@ -34,4 +34,7 @@ int srsran_mod_modulate_bytes_FIX(const srsran_modem_table_t* q,
                                   cf_t* symbols,
                                   uint32_t nbits);
 
+/// srsRAN modulation with N_bps bits per symbol, i.e. 1, 2, 4, 6 or 8
+srsran_mod_t get_srsran_mod(const uint32_t N_bps);
+
 }  // namespace dectnrp::sp3::fix
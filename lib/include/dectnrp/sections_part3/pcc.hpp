@@ -35,6 +35,7 @@ class pcc_t final : public df_pxc_t {
         void set_configuration(const uint32_t b, const uint32_t N_TS) override final;
         bool is_symbol_index(const uint32_t l) override final;
         const std::vector<uint32_t>& get_k_i_one_symbol() const override final;
+        const std::vector<run_t>& get_k_i_runs_one_symbol() const override final;
 
         /// convenience function to determine linear indices of PCC
         static std::vector<uint32_t> get_k_i_linear(const uint32_t b, const uint32_t N_TS);
@@ -46,6 +47,7 @@ class pcc_t final : public df_pxc_t {
         uint32_t config_local_cnt;
         std::vector<uint32_t>* ptr_l_all_symbols;
         common::vec2d<uint32_t>* ptr_k_i_all_symbols;
+        common::vec2d<run_t>* ptr_k_i_runs_all_symbols;
 
         static std::vector<uint32_t> idx2sub_col(const std::vector<uint32_t> linear_idx,
                                                  uint32_t dim_column);
@@ -35,6 +35,7 @@ class pdc_t final : public df_pxc_t {
         void set_configuration(const uint32_t b, const uint32_t N_TS) override final;
         bool is_symbol_index(const uint32_t l) override final;
         const std::vector<uint32_t>& get_k_i_one_symbol() const override final;
+        const std::vector<run_t>& get_k_i_runs_one_symbol() const override final;
 
         static uint32_t get_N_DF_symb(const uint32_t N_PACKET_symb, const uint32_t u);
 
@@ -57,6 +58,7 @@ class pdc_t final : public df_pxc_t {
         uint32_t config_N_TS_idx;
 
         common::vec2d<uint32_t>* k_i_all_symbols_effective;
+        common::vec2d<run_t>* k_i_runs_all_symbols_effective;
 
         uint32_t l_limit;
         uint32_t l_repeat;
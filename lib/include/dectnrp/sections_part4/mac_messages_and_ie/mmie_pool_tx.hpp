@@ -20,18 +20,102 @@
 
 #pragma once
 
-#include <algorithm>
-#include <iterator>
+#include <array>
+#include <cstddef>
 #include <memory>
-#include <typeindex>
-#include <unordered_map>
-#include <vector>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "dectnrp/common/prog/assert.hpp"
 #include "dectnrp/sections_part4/mac_messages_and_ie/mmie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/association_release_message.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/association_request_message.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/association_response_message.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/broadcast_indication_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/cluster_beacon_message.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/configuration_request_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/group_assignment_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/higher_layer_signalling.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/load_info_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/mac_security_info_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/measurement_report_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/neighbouring_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/network_beacon_message.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/radio_device_status_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/random_access_resource_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/rd_capability_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/reconfiguration_request_message.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/reconfiguration_response_message.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/resource_allocation_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/route_info_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/user_plane_data.hpp"
+
+// separated as not standard-compliant
+#include "dectnrp/sections_part4/mac_messages_and_ie/extensions/power_target_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/extensions/time_announce_ie.hpp"
 
 namespace dectnrp::sp4 {
 
+/**
+ * \brief Every MMIE that is already implemented must be contained in this list exactly once. Same
+ * order as in Table 6.3.4-2, Table 6.3.4-3 and Table 6.3.4-4. The position of an MMIE in this list
+ * is its index in the pool, which is known at compile time.
+ */
+using mmie_types_t = std::tuple<higher_layer_signalling_t,
+                                user_plane_data_t,
+                                // reserved
+                                network_beacon_message_t,
+                                cluster_beacon_message_t,
+                                association_request_message_t,
+                                association_response_message_t,
+                                association_release_message_t,
+                                reconfiguration_request_message_t,
+                                reconfiguration_response_message_t,
+                                // additional MAC messages
+                                mac_security_info_ie_t,
+                                route_info_ie_t,
+                                resource_allocation_ie_t,
+                                random_access_resource_ie_t,
+                                rd_capability_ie_t,
+                                neighbouring_ie_t,
+                                broadcast_indication_ie_t,
+                                group_assignment_ie_t,
+                                load_info_ie_t,
+                                measurement_report_ie_t,
+                                // reserved
+                                // escape
+                                // IE type extension
+                                configuration_request_ie_t,
+                                radio_device_status_ie_t,
+                                // not part of the standard, exist only in this project
+                                extensions::power_target_ie_t,
+                                extensions::time_announce_ie_t>;
+
+static constexpr std::size_t mmie_types_size{std::tuple_size_v<mmie_types_t>};
+
+template <typename T, typename Tuple>
+struct mmie_index_t;
+
+template <typename T, typename... Ts>
+struct mmie_index_t<T, std::tuple<Ts...>> {
+        static constexpr std::size_t value = []() {
+            constexpr std::array<bool, sizeof...(Ts)> is_same{std::is_same_v<T, Ts>...};
+            for (std::size_t i = 0; i < is_same.size(); ++i) {
+                if (is_same[i]) {
+                    return i;
+                }
+            }
+            return is_same.size();
+        }();
+
+        static_assert(value < sizeof...(Ts), "MMIE not contained in mmie_types_t");
+};
+
+/// compile-time index of an MMIE in mmie_types_t
+template <typename T>
+static constexpr std::size_t mmie_index_v = mmie_index_t<T, mmie_types_t>::value;
+
 class mmie_pool_tx_t {
     public:
         mmie_pool_tx_t();
@@ -43,42 +127,34 @@ class mmie_pool_tx_t {
         mmie_pool_tx_t& operator=(mmie_pool_tx_t&&) = delete;
 
         /// number of different types of MMIEs in the pool
-        [[nodiscard]] std::size_t get_nof_mmie() const noexcept { return pool.size(); }
+        [[nodiscard]] std::size_t get_nof_mmie() const noexcept { return mmie_types_size; }
 
         /// number of different types of MMIEs in the pool derived from T
         template <typename T>
         [[nodiscard]] std::size_t get_nof_mmie_derived_from() const noexcept {
-            return std::count_if(pool.begin(), pool.end(), [](const auto& elem) {
-                return dynamic_cast<const T*>(elem.second.at(0).get()) != nullptr;
-            });
+            return []<typename... Ts>(std::type_identity<std::tuple<Ts...>>) {
+                return (std::size_t{std::is_base_of_v<T, Ts>} + ...);
+            }(std::type_identity<mmie_types_t>{});
         }
 
         /// number of elements across all MMIEs
         [[nodiscard]] std::size_t get_nof_mmie_elements() const noexcept {
-            std::size_t cnt = 0;
-            for (const auto& vec : pool) {
-                cnt += vec.second.size();
-            }
-            return cnt;
+            return std::apply([](const auto&... arr) { return (arr.size + ...); }, pool);
         }
 
         /// get number of elements of a specific MMIE
         template <std::derived_from<mmie_t> T>
-        [[nodiscard]] std::size_t get_nof_elements() noexcept {
-            return pool[typeid(T)].size();
+        [[nodiscard]] std::size_t get_nof_elements() const noexcept {
+            return std::get<mmie_index_v<T>>(pool).size;
         }
 
-        /// set number of elements of a specific MMIE
+        /// set number of elements of a specific MMIE, invalidates references to its elements
         template <std::derived_from<mmie_t> T>
         void set_nof_elements(const std::size_t n) noexcept {
             dectnrp_assert(n > 0, "each MMIE must be contained at least once in the pool");
-            auto& vec = pool[typeid(T)];
-            while (vec.size() < n) {
-                vec.push_back(std::make_unique<T>());
-            }
-            while (vec.size() > n) {
-                vec.pop_back();
-            }
+            auto& arr = std::get<mmie_index_v<T>>(pool);
+            arr.elements = std::make_unique<T[]>(n);
+            arr.size = n;
         }
 
         /**
@@ -93,20 +169,20 @@ class mmie_pool_tx_t {
         template <std::derived_from<mmie_t> T>
             requires(std::derived_from<T, mu_depending_t> == false)
         [[nodiscard]] T& get(const std::size_t i) noexcept {
-            auto& vec = pool[typeid(T)];
-            auto* ptr = vec.at(i).get();
-            return *static_cast<T*>(ptr);
+            auto& arr = std::get<mmie_index_v<T>>(pool);
+            dectnrp_assert(i < arr.size, "index out of bound");
+            return arr.elements[i];
         }
 
         /// same as above, but in case the class depends on mu, it must be passed as an argument
         template <std::derived_from<mmie_t> T>
             requires(std::derived_from<T, mu_depending_t> == true)
         [[nodiscard]] T& get(const std::size_t i, const uint32_t mu) noexcept {
-            auto& vec = pool[typeid(T)];
-            auto* ptr = vec.at(i).get();
-            T* ret = static_cast<T*>(ptr);
-            ret->set_mu(mu);
-            return *ret;
+            auto& arr = std::get<mmie_index_v<T>>(pool);
+            dectnrp_assert(i < arr.size, "index out of bound");
+            T& ret = arr.elements[i];
+            ret.set_mu(mu);
+            return ret;
         }
 
         /**
@@ -119,8 +195,9 @@ class mmie_pool_tx_t {
          */
         [[nodiscard]] mmie_t& get_by_index(const std::size_t i,
                                            const std::size_t j = 0) const noexcept {
-            auto vec = std::next(pool.begin(), i);
-            return *(vec->second.at(j).get());
+            mmie_t* ret = get_by_index_or_nullptr(i, j);
+            dectnrp_assert(ret != nullptr, "index out of bound");
+            return *ret;
         }
 
         /**
@@ -134,11 +211,54 @@ class mmie_pool_tx_t {
                                    const uint32_t N_bytes_to_fill) noexcept;
 
     protected:
+        /// contiguous instances of one MMIE type
+        template <typename T>
+        struct mmie_array_t {
+                std::unique_ptr<T[]> elements;
+                std::size_t size{0};
+        };
+
+        template <typename Tuple>
+        struct pool_of_t;
+
+        template <typename... Ts>
+        struct pool_of_t<std::tuple<Ts...>> {
+                using type = std::tuple<mmie_array_t<Ts>...>;
+        };
+
+        using pool_t = pool_of_t<mmie_types_t>::type;
+
         /**
-         * \brief Unordered map that represents the actual pool. The container maps a MMIE type to a
-         * vector of unique base pointers, each pointing to an instance of the indexed MMIE type.
+         * \brief Tuple that represents the actual pool. Element i of the tuple holds all instances
+         * of the MMIE type at index i of mmie_types_t, so every access by type is resolved at
+         * compile time.
          */
-        std::unordered_map<std::type_index, std::vector<std::unique_ptr<mmie_t>>> pool;
+        pool_t pool;
+
+        /// jump table for access with a type index only known at runtime, nullptr if j too large
+        [[nodiscard]] mmie_t* get_by_index_or_nullptr(const std::size_t i,
+                                                      const std::size_t j) const noexcept;
+
+    private:
+        using get_by_index_func_t = mmie_t* (*)(const pool_t&, const std::size_t);
+
+        template <std::size_t... Is>
+        static constexpr std::array<get_by_index_func_t, sizeof...(Is)> get_get_by_index_table(
+            std::index_sequence<Is...>) {
+            return {[](const pool_t& p, const std::size_t j) -> mmie_t* {
+                const auto& arr = std::get<Is>(p);
+                return j < arr.size ? &arr.elements[j] : nullptr;
+            }...};
+        }
 };
 
+inline mmie_t* mmie_pool_tx_t::get_by_index_or_nullptr(const std::size_t i,
+                                                       const std::size_t j) const noexcept {
+    static constexpr std::array<get_by_index_func_t, mmie_types_size> get_by_index_table =
+        get_get_by_index_table(std::make_index_sequence<mmie_types_size>{});
+
+    dectnrp_assert(i < mmie_types_size, "index out of bound");
+    return get_by_index_table[i](pool, j);
+}
+
 }  // namespace dectnrp::sp4
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <limits>
 #include <utility>
 
 #include "dectnrp/common/adt/miscellaneous.hpp"
@@ -135,8 +137,12 @@ class mac_multiplexing_header_t final : public common::serdes::packing_t {
         ie_type_t ie_type;
         uint32_t length;
 
-        /// during RX, we also save the type of the MMIE
-        const std::type_info* tinfo;
+        /// index in mmie_types_t used to mark the padding IE, which is not part of the pool
+        static constexpr std::size_t mmie_idx_padding{std::numeric_limits<std::size_t>::max() - 1};
+        static constexpr std::size_t mmie_idx_undefined{std::numeric_limits<std::size_t>::max()};
+
+        /// during RX, we also save the type of the MMIE as its index in mmie_types_t
+        std::size_t mmie_idx;
 };
 
 }  // namespace dectnrp::sp4
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <utility>
 #include <variant>
@@ -193,9 +194,8 @@ class mac_pdu_decoder_t final : private mmie_pool_tx_t {
         /// current MMIE being decoded
         mmie_t* mmie;
 
-        /// mapping between MMIE type and an index that indicates which MMIE instance of that
-        /// type to use next when decoding
-        std::unordered_map<std::type_index, std::size_t> index_next_ie;
+        /// per MMIE type in mmie_types_t, index of the MMIE instance to use next when decoding
+        std::array<std::size_t, mmie_types_size> index_next_ie;
 
         /// stores raw pointers to already decoded MMIEs
         std::vector<sp4::mmie_t*> mmie_decoded_vec;
@@ -205,10 +205,10 @@ class mac_pdu_decoder_t final : private mmie_pool_tx_t {
          * yet been used for decoding. Returns nullptr in case that a message IE of the requested
          * type is not available.
          *
-         * \param type_idx type index that maps to an instance of the requested MMIE type
+         * \param mmie_idx index in mmie_types_t of the requested MMIE type
          * \return MMIE of requested type or nullptr
          */
-        [[nodiscard]] mmie_t* get_mmie_from_pool(const std::type_index& type_idx) noexcept;
+        [[nodiscard]] mmie_t* get_mmie_from_pool(const std::size_t mmie_idx) const noexcept;
 };
 
 }  // namespace dectnrp::sp4
@@ -20,19 +20,34 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 
-extern "C" {
-#include "srsran/config.h"
-#include "srsran/phy/channel/ch_awgn.h"
-}
+#include "dectnrp/common/complex.hpp"
+#include "dectnrp/limits.hpp"
+
+/* If defined, every vspace_t seeds its noise sources and the small scale fading of its wireless
+ * channels with this value instead of a time dependent seed. As each simulated device and antenna
+ * has its own noise stream and each channel its own fading seed, simulation runs are then
+ * reproducible irrespective of the order in which the devices read from the virtual space.
+ */
+// #define SIMULATION_NOISE_SEED 0
 
 namespace dectnrp::simulation {
 
 class noise_t {
     public:
-        explicit noise_t(const uint32_t seed_);
-        ~noise_t();
+        /**
+         * \brief Additive white Gaussian noise from a counter-based generator (Philox4x32-10) and
+         * the Box-Muller transform. The seed and the stream form the key, every antenna has its
+         * own counter. Two instances with the same seed and different streams are independent,
+         * two instances with identical seed and stream generate identical noise.
+         *
+         * \param seed_ seed shared by all noise sources of a simulation
+         * \param stream_ unique for every noise source, e.g. the ID of the simulated device
+         */
+        explicit noise_t(const uint32_t seed_, const uint32_t stream_);
+        ~noise_t() = default;
 
         noise_t() = delete;
         noise_t(const noise_t&) = delete;
@@ -40,14 +55,44 @@ class noise_t {
         noise_t(noise_t&&) = delete;
         noise_t& operator=(noise_t&&) = delete;
 
-        void awgn(const cf_t* inp,
+        /**
+         * \brief Adds noise to nof_samples samples of antenna ant_idx, inp and out may be the
+         * same.
+         *
+         * \param ant_idx antenna index, selects the counter
+         * \param inp input samples
+         * \param out output samples
+         * \param nof_samples number of samples
+         * \param net_bandwidth_norm occupied bandwidth normalized to sample rate
+         * \param snr_in_net_bandwidth_norm_dB SNR within occupied bandwidth
+         */
+        void awgn(const uint32_t ant_idx,
+                  const cf_t* inp,
                   cf_t* out,
                   const uint32_t nof_samples,
                   const float net_bandwidth_norm,
                   const float snr_in_net_bandwidth_norm_dB);
 
+        /// restart all antennas at counter 0
+        void reset();
+
+        /**
+         * \brief Single evaluation of the generator used by awgn(), allows comparing against the
+         * known-answer vectors of Random123.
+         *
+         * \param x counter
+         * \param key key
+         * \return four random words
+         */
+        static std::array<uint32_t, 4> philox4x32_10(std::array<uint32_t, 4> x,
+                                                     std::array<uint32_t, 2> key);
+
     private:
-        srsran_channel_awgn_t srsran_channel_awgn;
+        const uint32_t seed;
+        const uint32_t stream;
+
+        /// every call of the generator yields four words, i.e. two complex samples
+        std::array<uint64_t, limits::dectnrp_max_nof_antennas> counter;
 };
 
 }  // namespace dectnrp::simulation
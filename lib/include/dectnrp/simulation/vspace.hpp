@@ -34,6 +34,12 @@
 #include "dectnrp/simulation/vspp/vspptx.hpp"
 #include "dectnrp/simulation/wireless/channel.hpp"
 
+/* Inter-simulator channels whose received power on every pair of antennas is at least this many
+ * dB below the noise floor of the receiver are not superimposed. Channels with memory are told to
+ * forget the skipped signal. If undefined, every channel is always superimposed.
+ */
+#define SIMULATION_VSPACE_PRUNE_BELOW_NOISE_DB 30.0f
+
 namespace dectnrp::simulation {
 
 class vspace_t {
@@ -144,7 +150,14 @@ class vspace_t {
         } noise_type;
 
         common::randomgen_t wchannel_randomgen;
-        std::unique_ptr<noise_t> wchannel_noise_source;
+
+        /// seed of all noise sources and, per channel, of small scale fading
+        uint32_t wchannel_seed;
+
+        /// every channel has its own seed, so its fading does not depend on other channels
+        uint32_t wchannel_get_seed(const uint32_t id_0, const uint32_t id_1) const;
+
+        std::vector<std::unique_ptr<noise_t>> wchannel_noise_source_vec;
 
         /// inter-simulator wireless channels
         std::vector<std::unique_ptr<channel_t>> wchannel_inter_vec;
@@ -157,6 +170,18 @@ class vspace_t {
 
         /// execute wireless environment
         void wchannel_execute(vspprx_t& vspprx) const;
+
+        /// noise power in dB relative to 0dBFS added by wchannel_execute() to an RX antenna
+        float wchannel_get_noise_floor_dB(const vspptx_t& vspptx,
+                                          const vspprx_t& vspprx,
+                                          const size_t rx_idx) const;
+
+#ifdef SIMULATION_VSPACE_PRUNE_BELOW_NOISE_DB
+        /// true if vspptx_other is too weak on all antenna pairs to be superimposed onto vspprx
+        bool wchannel_is_prunable(const vspptx_t& vspptx,
+                                  const vspprx_t& vspprx,
+                                  const vspptx_t& vspptx_other) const;
+#endif
 };
 
 }  // namespace dectnrp::simulation
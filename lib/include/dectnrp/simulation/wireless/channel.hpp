@@ -23,6 +23,7 @@
 #include <cstdint>
 
 #include "dectnrp/common/complex.hpp"
+#include "dectnrp/common/randomgen.hpp"
 #include "dectnrp/simulation/vspp/vspprx.hpp"
 #include "dectnrp/simulation/vspp/vspptx.hpp"
 
@@ -30,10 +31,18 @@ namespace dectnrp::simulation {
 
 class channel_t {
     public:
+        /**
+         * \param id_0_ first simulator
+         * \param id_1_ second simulator, same as id_0_ for intra-simulator leakage
+         * \param samp_rate_ sample rate
+         * \param spp_size_ samples per packet
+         * \param seed_ seed of the small scale fading, unique for every channel
+         */
         explicit channel_t(const uint32_t id_0_,
                            const uint32_t id_1_,
                            const uint32_t samp_rate_,
-                           const uint32_t spp_size_);
+                           const uint32_t spp_size_,
+                           const uint32_t seed_);
         virtual ~channel_t();
 
         channel_t() = delete;
@@ -53,6 +62,17 @@ class channel_t {
                                  vspprx_t& vspprx,
                                  const vspptx_t& vspptx_other) const = 0;
 
+        /**
+         * \brief Called instead of superimpose() if the signal of vspptx_other is not
+         * superimposed onto vspprx, e.g. because it is far below the noise floor. Channels with
+         * memory must forget the signal of this direction.
+         *
+         * \param vspprx own reception
+         * \param vspptx_other other simulator's transmission not superimposed onto vspprx
+         */
+        virtual void skip([[maybe_unused]] const vspprx_t& vspprx,
+                          [[maybe_unused]] const vspptx_t& vspptx_other) const {};
+
         /// create new and independent channel impulse response
         virtual void randomize_small_scale() = 0;
 
@@ -72,6 +92,9 @@ class channel_t {
         cf_t* large_scale_stage;
         cf_t* small_scale_stage;
 
+        /// source of small scale fading, seeded once so a channel's fading is reproducible
+        common::randomgen_t randomgen;
+
         bool are_args_valid(const vspptx_t& vspptx, const vspprx_t& vspprx) const;
 };
 
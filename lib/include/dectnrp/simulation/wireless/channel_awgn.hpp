@@ -31,7 +31,8 @@ class channel_awgn_t final : public channel_t {
         explicit channel_awgn_t(const uint32_t id_0_,
                                 const uint32_t id_1_,
                                 const uint32_t samp_rate_,
-                                const uint32_t spp_size_);
+                                const uint32_t spp_size_,
+                                const uint32_t seed_);
         ~channel_awgn_t() = default;
 
         channel_awgn_t() = delete;
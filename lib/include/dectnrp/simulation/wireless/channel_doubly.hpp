@@ -36,7 +36,8 @@ class channel_doubly_t final : public channel_t {
                                   const uint32_t spp_size_,
                                   const uint32_t nof_antennas_0_,
                                   const uint32_t nof_antennas_1_,
-                                  const std::string sim_channel_name_intxx_);
+                                  const std::string sim_channel_name_intxx_,
+                                  const uint32_t seed_);
         ~channel_doubly_t() = default;
 
         channel_doubly_t() = delete;
@@ -58,6 +59,8 @@ class channel_doubly_t final : public channel_t {
                          vspprx_t& vspprx,
                          const vspptx_t& vspptx_other) const override final;
 
+        void skip(const vspprx_t& vspprx, const vspptx_t& vspptx_other) const override final;
+
         void randomize_small_scale() override final;
 
         const uint32_t nof_antennas_0;
@@ -34,7 +34,8 @@ class channel_flat_t final : public channel_t {
                                 const uint32_t samp_rate_,
                                 const uint32_t spp_size_,
                                 const uint32_t nof_antennas_0_,
-                                const uint32_t nof_antennas_1_);
+                                const uint32_t nof_antennas_1_,
+                                const uint32_t seed_);
         ~channel_flat_t() = default;
 
         channel_flat_t() = delete;
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "dectnrp/common/complex.hpp"
+#include "dectnrp/common/randomgen.hpp"
 
 namespace dectnrp::simulation {
 
@@ -45,24 +46,42 @@ class link_t {
         /// print current channel configuration
         void print_pdp(const std::string prefix) const;
 
-        /// randomize sum of sinusoids settings
-        void randomize();
+        /**
+         * \brief Randomize sum of sinusoids settings, must be called before the first call of
+         * pass_through_link().
+         *
+         * \param randomgen source of random numbers, owned by the channel
+         */
+        void randomize(common::randomgen_t& randomgen);
 
         /**
          * \brief We assume the channel is reciprocal between simulators. Thus, if both simulator
          * input the same inp from their respective ends, they will receive the same out if called
          * at the same point in time time_64. Calls must have consecutive time_64, as the class
-         * internally keeps a history of former samples.
+         * internally keeps a history of former samples. The tap coefficients of time_64 are
+         * calculated by the first call and reused by the call for the other direction.
          *
          * \param inp
          * \param out
          * \param primary_direction
          * \param time_64
+         * \param inp_is_zero if true, the caller guarantees that inp contains only zeros
          */
         void pass_through_link(const cf_t* inp,
                                cf_t* out,
                                const bool primary_direction,
-                               const int64_t time_64);
+                               const int64_t time_64,
+                               const bool inp_is_zero = false);
+
+        /// if true and the next input is zero, the next output is zero as well
+        bool is_history_zero(const bool primary_direction) const {
+            return history_is_zero_arr[primary_direction ? 0 : 1];
+        }
+
+        /// next call in this direction starts without any history, used when skipping calls
+        void set_history_zero(const bool primary_direction) {
+            history_is_zero_arr[primary_direction ? 0 : 1] = true;
+        }
 
         const uint32_t samp_rate;
         const uint32_t spp_size;
@@ -73,9 +92,18 @@ class link_t {
     private:
         /// each direction has its own history
         std::array<cf_t*, 2> history_stage_arr;
+        std::array<bool, 2> history_is_zero_arr;
+        cf_t* ones_stage;
         cf_t* sinusoid_stage;
         cf_t* superposition_stage;
 
+        /// time-variant coefficient of each tap, identical for both directions at the same time
+        std::vector<cf_t*> tap_coeff_stage_vec;
+        int64_t tap_coeff_time_64;
+
+        /// sum of sinusoids of every tap at time_64
+        void set_tap_coeff(const int64_t time_64);
+
         // ##################################################
         // Doppler and delay spread
 
@@ -79,7 +79,8 @@ class steady_pt_t final : public steady_rd_t {
         void worksub_mmie_time_announce(const int64_t fine_peak_time_64,
                                         const sp4::extensions::time_announce_ie_t& taie);
 
-        [[nodiscard]] bool worksub_mmie_user_plane_data(const sp4::user_plane_data_t& upd);
+        [[nodiscard]] bool worksub_mmie_user_plane_data(const sp4::user_plane_data_t& upd,
+                                                        phy::harq::process_rx_t* hp_rx);
 
         void worksub_mmie_resource_allocation(const sp4::resource_allocation_ie_t& raie);
 
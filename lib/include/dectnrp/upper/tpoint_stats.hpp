@@ -23,22 +23,27 @@
 #include <cstdint>
 #include <string>
 
+#include "dectnrp/common/prog/metrics.hpp"
+
 namespace dectnrp::upper {
 
 class tpoint_stats_t {
     public:
         std::string get_as_string() const;
 
-        int64_t rx_pcc_success{};
-        int64_t rx_pcc2pdc_success{};
-        int64_t rx_pcc2pdc_running_success{};
+        /// all counters become shards of metrics with the given labels
+        void register_metrics(const metrics::labels_t& labels) const;
+
+        metrics::counter_t rx_pcc_success;
+        metrics::counter_t rx_pcc2pdc_success;
+        metrics::counter_t rx_pcc2pdc_running_success;
 
-        int64_t rx_pdc_success{};
-        int64_t rx_pdc_fail{};
+        metrics::counter_t rx_pdc_success;
+        metrics::counter_t rx_pdc_fail;
 
-        int64_t rx_pdc_has_mmie{};
+        metrics::counter_t rx_pdc_has_mmie;
 
-        int64_t beacon_cnt{};
+        metrics::counter_t beacon_cnt;
 };
 
 }  // namespace dectnrp::upper
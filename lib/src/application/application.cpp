@@ -22,6 +22,7 @@
 
 #include "dectnrp/common/prog/assert.hpp"
 #include "dectnrp/common/prog/log.hpp"
+#include "dectnrp/common/prog/metrics.hpp"
 
 namespace dectnrp::application {
 
@@ -69,6 +70,16 @@ void application_t::stop_sc() {
     pthread_join(work_thread, NULL);
 };
 
+void application_t::register_metrics(const std::string& kind) const {
+    for (uint32_t i = 0; i < queue_vec.size(); ++i) {
+        metrics::register_gauge(
+            "application_queue_datagrams",
+            "datagrams held in application queue",
+            {{"kind", kind}, {"id", std::to_string(id)}, {"conn", std::to_string(i)}},
+            [queue = queue_vec[i].get()]() { return queue->get_nof_datagrams_any(); });
+    }
+}
+
 void application_t::clear() {
     for (auto& elem : queue_vec) {
         elem->clear();
@@ -20,6 +20,8 @@
 
 #include "dectnrp/application/application_client.hpp"
 
+#include <algorithm>
+
 #include "dectnrp/common/prog/assert.hpp"
 
 namespace dectnrp::application {
@@ -30,7 +32,9 @@ application_client_t::application_client_t(const uint32_t id_,
                                            const uint32_t N_queue,
                                            const queue_size_t queue_size)
     : application_t(id_, thread_config_, job_queue_, N_queue, queue_size),
-      indicator_cnt{0} {}
+      indicator_cnt{0} {
+    register_metrics("client");
+}
 
 void application_client_t::trigger_forward_nto(const uint32_t datagram_cnt) {
 #ifdef APPLICATION_APP_CLIENT_CONDITION_VARIABLE_OR_BUSY_WAITING
@@ -98,10 +102,10 @@ void application_client_t::inc_indicator_cnt_under_lock(const uint32_t datagram_
     indicator_cnt += datagram_cnt;
 }
 
-void application_client_t::dec_indicator_cnt_under_lock() {
+void application_client_t::dec_indicator_cnt_under_lock(const uint32_t datagram_cnt) {
     // ToDo: use conn_idx for better efficiency
 
-    indicator_cnt--;
+    indicator_cnt -= datagram_cnt;
 }
 
 uint32_t application_client_t::get_indicator_cnt_under_lock() {
@@ -119,21 +123,31 @@ void application_client_t::forward_under_lock() {
 
         // check for every existing interface
         for (uint32_t i = 0; i < get_n_connections(); ++i) {
-            // check if there is any data
-            const uint32_t n = copy_from_queue_to_localbuffer(i);
+            // never take more datagrams than indicated, remaining ones are indicated later
+            const uint32_t n_max = std::min(static_cast<uint32_t>(datagram_batch.size()),
+                                            get_indicator_cnt_under_lock());
+
+            if (n_max == 0) {
+                break;
+            }
+
+            // check if there is any data, datagrams are not copied
+            const uint32_t n = queue_vec.at(i)->peek_nto(datagram_batch.data(), n_max);
 
             // if so ...
             if (n > 0) {
-                if (!filter_egress_datagram(i)) {
-                    continue;
-                }
+                // ... forward all datagrams with as few system calls as possible
+                if (filter_egress_datagram(i)) {
+                    [[maybe_unused]] const auto n_w =
+                        write_immediate_batch(i, datagram_batch.data(), n);
 
-                // ... forward
-                const auto n_w = write_immediate(i, buffer_local, n);
+                    dectnrp_assert(n == n_w, "nof datagrams not written");
+                }
 
-                dectnrp_assert(n == n_w, "nof bytes not written");
+                // datagrams are consumed even if discarded, which also unpins any referenced memory
+                queue_vec[i]->pop_nto(n);
 
-                dec_indicator_cnt_under_lock();
+                dec_indicator_cnt_under_lock(n);
 
 #ifdef ENABLE_ASSERT
                 all_queues_empty = false;
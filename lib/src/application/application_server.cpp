@@ -29,6 +29,8 @@ application_server_t::application_server_t(const uint32_t id_,
                                            const queue_size_t queue_size)
     : application_t(id_, thread_config_, job_queue_, N_queue, queue_size) {
     pfds.resize(N_queue);
+
+    register_metrics("server");
 }
 
 void application_server_t::work_sc() {
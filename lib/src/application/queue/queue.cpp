@@ -34,155 +34,209 @@ queue_t::queue_t(const queue_size_t queue_size_)
     }
 
     datagram_level_vec.resize(queue_size.N_datagram, 0);
+    datagram_ptr_vec.assign(datagram_vec.begin(), datagram_vec.end());
+    datagram_owner_vec.resize(queue_size.N_datagram, nullptr);
 }
 
 queue_t::~queue_t() {
+    clear();
+
     for (uint32_t i = 0; i < queue_size.N_datagram; ++i) {
-        delete datagram_vec[i];
+        delete[] datagram_vec[i];
     }
 }
 
 queue_level_t queue_t::get_queue_level_nto(const uint32_t n) const {
-    lockv.lock();
+    dectnrp_assert(n <= limits::application_max_queue_level_reported,
+                   "number of levels for reporting is limited");
 
-    const queue_level_t ret = get_queue_level_under_lock(n);
+    const uint32_t r_idx_local = r_idx.load(std::memory_order_relaxed);
 
-    lockv.unlock();
+    // level must be up-to-date, so always refresh
+    w_idx_cached = w_idx.load(std::memory_order_acquire);
 
-    return ret;
-}
+    // make sure returned vector is readable
+    const uint32_t n_ = std::min(n, get_used(w_idx_cached, r_idx_local));
 
-queue_level_t queue_t::get_queue_level_try(const uint32_t n) const {
-    if (!lockv.try_lock()) {
-        return queue_level_t();
-    }
+    uint32_t r_idx_cpy = r_idx_local;
 
-    const queue_level_t ret = get_queue_level_under_lock(n);
+    queue_level_t ret;
+    ret.N_filled = n_;
 
-    lockv.unlock();
+    // fill
+    for (uint32_t i = 0; i < n_; ++i) {
+        ret.levels[i] = datagram_level_vec[r_idx_cpy];
+        r_idx_cpy = get_next_idx(r_idx_cpy);
+    }
 
     return ret;
 }
 
+queue_level_t queue_t::get_queue_level_try(const uint32_t n) const {
+    return get_queue_level_nto(n);
+}
+
 uint32_t queue_t::write_nto(const uint8_t* inp, const uint32_t n) {
-    lockv.lock();
+    const auto w_idx_opt = get_w_idx_if_not_full();
 
-    const uint32_t w_ret = write_under_lock(inp, n);
+    if (!w_idx_opt.has_value()) {
+        return 0;
+    }
+
+    const uint32_t w_idx_local = w_idx_opt.value();
+
+    dectnrp_assert(n <= queue_size.N_datagram_max_byte, "too large");
+
+    std::memcpy(datagram_vec[w_idx_local], inp, n);
 
-    lockv.unlock();
+    datagram_level_vec[w_idx_local] = n;
+    datagram_ptr_vec[w_idx_local] = datagram_vec[w_idx_local];
+    datagram_owner_vec[w_idx_local] = nullptr;
 
-    return w_ret;
+    // publish datagram and level to consumer
+    w_idx.store(get_next_idx(w_idx_local), std::memory_order_release);
+
+    return n;
 }
 
-uint32_t queue_t::write_try(const uint8_t* inp, const uint32_t n) {
-    if (!lockv.try_lock()) {
+uint32_t queue_t::write_try(const uint8_t* inp, const uint32_t n) { return write_nto(inp, n); }
+
+uint32_t queue_t::write_ref_nto(const uint8_t* inp, const uint32_t n, common::pinnable_t* owner) {
+    dectnrp_assert(owner != nullptr, "owner undefined");
+
+    const auto w_idx_opt = get_w_idx_if_not_full();
+
+    if (!w_idx_opt.has_value()) {
         return 0;
     }
 
-    const uint32_t w_ret = write_under_lock(inp, n);
+    const uint32_t w_idx_local = w_idx_opt.value();
+
+    dectnrp_assert(n <= queue_size.N_datagram_max_byte, "too large");
+
+    // pin before publishing, the consumer may unpin right after
+    if (owner->try_pin()) {
+        datagram_ptr_vec[w_idx_local] = inp;
+        datagram_owner_vec[w_idx_local] = owner;
+    } else {
+        // too many owners are pinned already, copying leaves this one to its pool
+        std::memcpy(datagram_vec[w_idx_local], inp, n);
+        datagram_ptr_vec[w_idx_local] = datagram_vec[w_idx_local];
+        datagram_owner_vec[w_idx_local] = nullptr;
+    }
+
+    datagram_level_vec[w_idx_local] = n;
 
-    lockv.unlock();
+    // publish reference and level to consumer
+    w_idx.store(get_next_idx(w_idx_local), std::memory_order_release);
 
-    return w_ret;
+    return n;
 }
 
 uint32_t queue_t::read_nto(uint8_t* dst) {
-    lockv.lock();
+    const uint32_t r_idx_local = r_idx.load(std::memory_order_relaxed);
 
-    const uint32_t r_ret = read_under_lock(dst);
+    // only reload w_idx if the cached value says the queue is empty
+    if (r_idx_local == w_idx_cached) {
+        w_idx_cached = w_idx.load(std::memory_order_acquire);
 
-    lockv.unlock();
+        if (r_idx_local == w_idx_cached) {
+            return 0;
+        }
+    }
 
-    return r_ret;
-}
+    const uint32_t n = datagram_level_vec[r_idx_local];
 
-uint32_t queue_t::read_try(uint8_t* dst) {
-    if (!lockv.try_lock()) {
-        return 0;
+    if (dst != nullptr) {
+        std::memcpy(dst, datagram_ptr_vec[r_idx_local], n);
     }
 
-    const uint32_t r_ret = read_under_lock(dst);
+    release_slot(r_idx_local);
 
-    lockv.unlock();
+    // hand slot back to producer
+    r_idx.store(get_next_idx(r_idx_local), std::memory_order_release);
 
-    return r_ret;
+    return n;
 }
 
-void queue_t::clear() {
-    lockv.lock();
-    w_idx = 0;
-    r_idx = 0;
-    lockv.unlock();
-}
+uint32_t queue_t::read_try(uint8_t* dst) { return read_nto(dst); }
 
-queue_level_t queue_t::get_queue_level_under_lock(const uint32_t n) const {
-    dectnrp_assert(n <= limits::application_max_queue_level_reported,
-                   "number of levels for reporting is limited");
+uint32_t queue_t::peek_nto(datagram_ref_t* dst, const uint32_t n) const {
+    const uint32_t r_idx_local = r_idx.load(std::memory_order_relaxed);
 
-    // make sure returned vector is readable
-    const uint32_t n_ = std::min(n, get_used());
+    // refresh only if the cached value does not contain enough datagrams
+    if (get_used(w_idx_cached, r_idx_local) < n) {
+        w_idx_cached = w_idx.load(std::memory_order_acquire);
+    }
 
-    uint32_t r_idx_cpy = r_idx;
+    const uint32_t n_ = std::min(n, get_used(w_idx_cached, r_idx_local));
 
-    queue_level_t ret;
-    ret.N_filled = n_;
+    uint32_t r_idx_cpy = r_idx_local;
 
-    // fill
     for (uint32_t i = 0; i < n_; ++i) {
-        ret.levels[i] = datagram_level_vec[r_idx_cpy];
-        r_idx_cpy = (r_idx_cpy + 1) % queue_size.N_datagram;
+        dst[i].data = datagram_ptr_vec[r_idx_cpy];
+        dst[i].n = datagram_level_vec[r_idx_cpy];
+        r_idx_cpy = get_next_idx(r_idx_cpy);
     }
 
-    return ret;
+    return n_;
 }
 
-uint32_t queue_t::write_under_lock(const uint8_t* inp, const uint32_t n) {
-    if (get_free() == 0) {
-        return 0;
+void queue_t::pop_nto(const uint32_t n) {
+    uint32_t r_idx_local = r_idx.load(std::memory_order_relaxed);
+
+    dectnrp_assert(n <= get_used(w_idx_cached, r_idx_local), "popping more datagrams than held");
+
+    for (uint32_t i = 0; i < n; ++i) {
+        release_slot(r_idx_local);
+        r_idx_local = get_next_idx(r_idx_local);
     }
 
-    dectnrp_assert(n <= queue_size.N_datagram_max_byte, "too large");
+    // hand slots back to producer
+    r_idx.store(r_idx_local, std::memory_order_release);
+}
 
-    std::memcpy(datagram_vec[w_idx], inp, n);
+void queue_t::clear() {
+    w_idx_cached = w_idx.load(std::memory_order_acquire);
 
-    datagram_level_vec[w_idx] = n;
+    const uint32_t r_idx_local = r_idx.load(std::memory_order_relaxed);
 
-    w_idx = (w_idx + 1) % queue_size.N_datagram;
+    pop_nto(get_used(w_idx_cached, r_idx_local));
+}
 
-    return n;
+uint32_t queue_t::get_nof_datagrams_any() const {
+    return get_used(w_idx.load(std::memory_order_relaxed), r_idx.load(std::memory_order_relaxed));
 }
 
-uint32_t queue_t::read_under_lock(uint8_t* dst) {
-    if (get_used() == 0) {
-        return 0;
+uint32_t queue_t::get_used(const uint32_t w_idx_, const uint32_t r_idx_) const {
+    if (w_idx_ >= r_idx_) {
+        return w_idx_ - r_idx_;
     }
 
-    const uint32_t n = datagram_level_vec[r_idx];
-
-    if (dst != nullptr) {
-        std::memcpy(dst, datagram_vec[r_idx], n);
-    }
+    return w_idx_ + queue_size.N_datagram - r_idx_;
+}
 
-    r_idx = (r_idx + 1) % queue_size.N_datagram;
+std::optional<uint32_t> queue_t::get_w_idx_if_not_full() {
+    const uint32_t w_idx_local = w_idx.load(std::memory_order_relaxed);
+    const uint32_t w_idx_next = get_next_idx(w_idx_local);
 
-    return n;
-}
+    // w_idx should never reach r_idx, only reload r_idx if the cached value says so
+    if (w_idx_next == r_idx_cached) {
+        r_idx_cached = r_idx.load(std::memory_order_acquire);
 
-uint32_t queue_t::get_free() const {
-    if (r_idx > w_idx) {
-        // w_idx should never reach r_idx
-        return r_idx - w_idx - 1;
+        if (w_idx_next == r_idx_cached) {
+            return std::nullopt;
+        }
     }
 
-    return r_idx + queue_size.N_datagram - w_idx - 1;
+    return w_idx_local;
 }
 
-uint32_t queue_t::get_used() const {
-    if (w_idx >= r_idx) {
-        return w_idx - r_idx;
+void queue_t::release_slot(const uint32_t idx) {
+    if (datagram_owner_vec[idx] != nullptr) {
+        datagram_owner_vec[idx]->unpin();
+        datagram_owner_vec[idx] = nullptr;
     }
-
-    return w_idx + queue_size.N_datagram - r_idx;
 }
 
 }  // namespace dectnrp::application
@@ -0,0 +1,199 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "dectnrp/application/queue/queue.hpp"
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/phy/harq/process_pool.hpp"
+#include "dectnrp/sections_part3/derivative/packet_sizes.hpp"
+
+using namespace dectnrp;
+
+static constexpr uint32_t N_process_rx{8};
+static constexpr uint32_t N_datagram{32};
+static constexpr uint32_t N_byte{16};
+
+/// every byte of datagram i is set to i
+static bool is_datagram_corrupted(const application::datagram_ref_t& datagram_ref,
+                                  const uint32_t i) {
+    if (datagram_ref.n != N_byte) {
+        return true;
+    }
+
+    for (uint32_t j = 0; j < N_byte; ++j) {
+        if (datagram_ref.data[j] != static_cast<uint8_t>(i)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// as done by steady_ft_t and steady_pt_t for every PDC with user plane data
+static uint32_t receive_and_write_ref(const phy::harq::process_pool_t& hpp,
+                                      application::queue_t& queue,
+                                      const uint32_t i) {
+    auto* hp_rx = hpp.get_process_rx(1,
+                                     0,
+                                     sp3::get_maximum_packet_sizes("1.1.1.A").psdef,
+                                     0,
+                                     phy::harq::finalize_rx_t::reset_and_terminate);
+
+    if (hp_rx == nullptr) {
+        return 0;
+    }
+
+    uint8_t* a = hp_rx->get_hb_tb()->get_a();
+    std::memset(a, static_cast<int>(i), N_byte);
+
+    const uint32_t n = queue.write_ref_nto(a, N_byte, hp_rx);
+
+    hp_rx->finalize(true);
+
+    return n;
+}
+
+static bool test_stalled_client() {
+    phy::harq::process_pool_t hpp(sp3::get_maximum_packet_sizes("1.1.1.A"), 1, N_process_rx);
+
+    application::queue_t queue(application::queue_size_t{.N_datagram = N_datagram,
+                                                         .N_datagram_max_byte = N_byte});
+
+    bool any_error = false;
+
+    // the client never reads, far more datagrams than processes are queued
+    for (uint32_t i = 0; i < N_datagram - 1; ++i) {
+        if (receive_and_write_ref(hpp, queue, i) != N_byte) {
+            dectnrp_print_wrn("HARQ process RX unavailable or queue full after {} datagrams", i);
+            return true;
+        }
+    }
+
+    // queue is full, the process is released right away
+    any_error |= receive_and_write_ref(hpp, queue, 0) != 0;
+
+    // only the pinned processes are still in use
+    any_error |= hpp.get_nof_process_rx_in_use() != N_process_rx / 2;
+
+    // the PHY can still acquire every process which is not pinned at the same time
+    std::vector<phy::harq::process_rx_t*> hp_rx_vec;
+    for (uint32_t i = 0; i < N_process_rx - N_process_rx / 2; ++i) {
+        hp_rx_vec.push_back(hpp.get_process_rx(1,
+                                               0,
+                                               sp3::get_maximum_packet_sizes("1.1.1.A").psdef,
+                                               0,
+                                               phy::harq::finalize_rx_t::reset_and_terminate));
+        any_error |= hp_rx_vec.back() == nullptr;
+    }
+
+    for (auto* hp_rx : hp_rx_vec) {
+        if (hp_rx != nullptr) {
+            std::memset(hp_rx->get_hb_tb()->get_a(), 0xff, N_byte);
+            hp_rx->finalize(true);
+        }
+    }
+
+    // pinned and copied datagrams are intact although processes were reused and overwritten
+    std::array<application::datagram_ref_t, N_datagram> datagram_refs;
+
+    any_error |= queue.peek_nto(datagram_refs.data(), N_datagram) != N_datagram - 1;
+
+    for (uint32_t i = 0; i < N_datagram - 1; ++i) {
+        any_error |= is_datagram_corrupted(datagram_refs[i], i);
+    }
+
+    // the first datagrams were pinned, popping them releases their processes
+    queue.pop_nto(N_process_rx / 2);
+
+    any_error |= hpp.get_nof_process_rx_in_use() != 0;
+
+    // peeking again starts after the popped datagrams
+    any_error |= queue.peek_nto(datagram_refs.data(), 1) != 1;
+    any_error |= is_datagram_corrupted(datagram_refs[0], N_process_rx / 2);
+
+    // with the budget available again, new datagrams are pinned
+    queue.pop_nto(N_process_rx / 2);
+    for (uint32_t i = 0; i < N_process_rx / 2; ++i) {
+        any_error |= receive_and_write_ref(hpp, queue, i) != N_byte;
+    }
+
+    any_error |= hpp.get_nof_process_rx_in_use() != N_process_rx / 2;
+
+    // discarding all datagrams releases every process
+    queue.clear();
+
+    any_error |= queue.get_nof_datagrams_any() != 0 || hpp.get_nof_process_rx_in_use() != 0;
+
+    return any_error;
+}
+
+static bool test_copy() {
+    application::queue_t queue(application::queue_size_t{.N_datagram = N_datagram,
+                                                         .N_datagram_max_byte = N_byte});
+
+    bool any_error = false;
+
+    std::array<uint8_t, N_byte> inp;
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        inp.fill(static_cast<uint8_t>(i));
+        any_error |= queue.write_nto(inp.data(), N_byte) != N_byte;
+    }
+
+    // copies do not depend on the source
+    inp.fill(0xff);
+
+    std::array<application::datagram_ref_t, 4> datagram_refs;
+
+    any_error |= queue.peek_nto(datagram_refs.data(), datagram_refs.size()) != 3;
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        any_error |= is_datagram_corrupted(datagram_refs[i], i);
+    }
+
+    queue.pop_nto(2);
+
+    std::array<uint8_t, N_byte> dst;
+    any_error |= queue.read_nto(dst.data()) != N_byte || dst[0] != 2;
+    any_error |= queue.read_nto(dst.data()) != 0;
+
+    return any_error;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    bool any_error = false;
+
+    if (test_stalled_client()) {
+        dectnrp_print_wrn("stalled client exhausted the HARQ process pool or corrupted datagrams");
+        any_error = true;
+    }
+
+    if (test_copy()) {
+        dectnrp_print_wrn("peeking or popping copied datagrams failed");
+        any_error = true;
+    }
+
+    return any_error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
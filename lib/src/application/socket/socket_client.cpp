@@ -21,8 +21,10 @@
 #include "dectnrp/application/socket/socket_client.hpp"
 
 #include <arpa/inet.h>   // sockaddr_in
-#include <sys/socket.h>  // socket
+#include <sys/socket.h>  // socket, sendmmsg
+#include <sys/uio.h>     // iovec
 
+#include <array>
 #include <cstring>  // memset
 
 #include "dectnrp/common/prog/assert.hpp"
@@ -81,14 +83,53 @@ uint32_t socket_client_t::write_try(const uint32_t conn_idx, const uint8_t* inp,
     return queue_vec.at(conn_idx)->write_try(inp, n);
 }
 
+uint32_t socket_client_t::write_ref_nto(const uint32_t conn_idx,
+                                        const uint8_t* inp,
+                                        const uint32_t n,
+                                        common::pinnable_t* owner) {
+    return queue_vec.at(conn_idx)->write_ref_nto(inp, n, owner);
+}
+
 bool socket_client_t::filter_egress_datagram([[maybe_unused]] const uint32_t conn_idx) {
     // nothing to do here so far
 
     return true;
 }
 
-uint32_t socket_client_t::copy_from_queue_to_localbuffer(const uint32_t conn_idx) {
-    return queue_vec.at(conn_idx)->read_nto(buffer_local);
+uint32_t socket_client_t::write_immediate_batch(const uint32_t conn_idx,
+                                                const datagram_ref_t* batch,
+                                                const uint32_t n) {
+    dectnrp_assert(n <= limits::application_max_client_batch, "batch too large");
+
+    std::array<iovec, limits::application_max_client_batch> iov_arr;
+    std::array<mmsghdr, limits::application_max_client_batch> msg_arr{};
+
+    // every datagram is sent directly from where it is stored, no copy to buffer_local
+    for (uint32_t i = 0; i < n; ++i) {
+        iov_arr[i].iov_base = const_cast<uint8_t*>(batch[i].data);
+        iov_arr[i].iov_len = batch[i].n;
+
+        msg_arr[i].msg_hdr.msg_name = &udp_vec[conn_idx]->servaddr;
+        msg_arr[i].msg_hdr.msg_namelen = sizeof(udp_vec[conn_idx]->servaddr);
+        msg_arr[i].msg_hdr.msg_iov = &iov_arr[i];
+        msg_arr[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // sendmmsg() may send fewer datagrams than requested, so repeat until done or failed
+    uint32_t n_w = 0;
+    while (n_w < n) {
+        const int ret = sendmmsg(udp_vec[conn_idx]->socketfd, &msg_arr[n_w], n - n_w, MSG_CONFIRM);
+
+        if (ret <= 0) {
+            break;
+        }
+
+        n_w += static_cast<uint32_t>(ret);
+    }
+
+    dectnrp_assert(n == n_w, "nof datagrams not the same");
+
+    return n_w;
 }
 
 }  // namespace dectnrp::application::sockets
@@ -57,15 +57,38 @@ uint32_t vnic_client_t::write_try(const uint32_t conn_idx, const uint8_t* inp, c
     return queue_vec.at(conn_idx)->write_try(inp, n);
 }
 
+uint32_t vnic_client_t::write_ref_nto(const uint32_t conn_idx,
+                                      const uint8_t* inp,
+                                      const uint32_t n,
+                                      common::pinnable_t* owner) {
+    dectnrp_assert(conn_idx == 0, "VNIC has only conn_idx=0");
+    return queue_vec.at(conn_idx)->write_ref_nto(inp, n, owner);
+}
+
 bool vnic_client_t::filter_egress_datagram([[maybe_unused]] const uint32_t conn_idx) {
     // nothing to do here so far
 
     return true;
 }
 
-uint32_t vnic_client_t::copy_from_queue_to_localbuffer(const uint32_t conn_idx) {
+uint32_t vnic_client_t::write_immediate_batch(const uint32_t conn_idx,
+                                              const datagram_ref_t* batch,
+                                              const uint32_t n) {
     dectnrp_assert(conn_idx == 0, "VNIC has only conn_idx=0");
-    return queue_vec.at(conn_idx)->read_nto(buffer_local);
+
+    /* A TUN device interprets every write as exactly one IP packet, and writev() would merge
+     * multiple datagrams into a single packet. Thus, one system call per datagram is required, but
+     * datagrams are still written directly from where they are stored.
+     */
+    uint32_t n_w = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        if (write_immediate(conn_idx, batch[i].data, batch[i].n) == 0) {
+            break;
+        }
+        ++n_w;
+    }
+
+    return n_w;
 }
 
 }  // namespace dectnrp::application::vnic
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/apps/pacer.hpp"
+
+#include <cmath>
+
+#include "dectnrp/common/prog/assert.hpp"
+
+namespace dectnrp::apps {
+
+pacer_t::pacer_t(const mode_t mode_,
+                 const double rate_,
+                 const uint32_t burst_size_,
+                 const uint32_t seed)
+    : mode(mode_),
+      rate(rate_),
+      burst_size(mode_ == mode_t::bursty ? burst_size_ : 1),
+      gen(seed),
+      exp_dist(rate_) {
+    dectnrp_assert(0.0 < rate, "rate must be positive");
+    dectnrp_assert(0 < burst_size, "burst size must be positive");
+}
+
+int64_t pacer_t::set_start_us(const int64_t start_us_64) {
+    next_us = static_cast<double>(start_us_64);
+    burst_cnt = 0;
+    return start_us_64;
+}
+
+int64_t pacer_t::get_next_us() {
+    switch (mode) {
+        using enum mode_t;
+
+        case cbr:
+            next_us += static_cast<double>(mega) / rate;
+            break;
+
+        case poisson:
+            next_us += exp_dist(gen) * static_cast<double>(mega);
+            break;
+
+        case bursty:
+            // datagrams within a burst depart at the same time, bursts keep the average rate
+            if (++burst_cnt == burst_size) {
+                burst_cnt = 0;
+                next_us += static_cast<double>(burst_size) * static_cast<double>(mega) / rate;
+            }
+            break;
+    }
+
+    return static_cast<int64_t>(std::round(next_us));
+}
+
+pacer_t::mode_t pacer_t::get_mode_from_string(const std::string& str) {
+    if (str == "cbr") {
+        return mode_t::cbr;
+    } else if (str == "poisson") {
+        return mode_t::poisson;
+    } else if (str == "bursty") {
+        return mode_t::bursty;
+    }
+
+    dectnrp_assert_failure("unknown pacer mode {}", str);
+
+    return mode_t::cbr;
+}
+
+std::string pacer_t::get_string_from_mode(const mode_t mode) {
+    switch (mode) {
+        using enum mode_t;
+
+        case cbr:
+            return "cbr";
+        case poisson:
+            return "poisson";
+        case bursty:
+            return "bursty";
+    }
+
+    return "unknown";
+}
+
+}  // namespace dectnrp::apps
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/apps/pacer.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+#include "dectnrp/common/prog/print.hpp"
+
+using namespace dectnrp;
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    const double rate = 1000.0;
+    const int64_t N = 100000;
+
+    for (const auto mode : {apps::pacer_t::mode_t::cbr,
+                            apps::pacer_t::mode_t::poisson,
+                            apps::pacer_t::mode_t::bursty}) {
+        apps::pacer_t pacer(mode, rate, 10, 0);
+
+        int64_t prev_us = pacer.set_start_us(0);
+
+        for (int64_t i = 0; i < N; ++i) {
+            const int64_t next_us = pacer.get_next_us();
+
+            if (next_us < prev_us) {
+                dectnrp_print_wrn("{} not monotonic", apps::pacer_t::get_string_from_mode(mode));
+                return EXIT_FAILURE;
+            }
+
+            prev_us = next_us;
+        }
+
+        // average rate must match within 2%
+        const double rate_measured = static_cast<double>(N) * 1.0e6 / static_cast<double>(prev_us);
+
+        dectnrp_print_inf(
+            "{} rate {:.2f}", apps::pacer_t::get_string_from_mode(mode), rate_measured);
+
+        if (std::abs(rate_measured - rate) > 0.02 * rate) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/common/adt/flat_map.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+
+using namespace dectnrp;
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    std::mt19937 gen(0);
+
+    common::adt::flat_map_t<uint32_t> flat_map;
+    std::unordered_map<uint32_t, uint32_t> um;
+
+    // insert random keys, the map grows multiple times
+    for (uint32_t v = 0; v < 5000; ++v) {
+        const uint32_t k = gen();
+
+        if (um.contains(k)) {
+            continue;
+        }
+
+        flat_map.insert(k, v);
+        um.insert(std::make_pair(k, v));
+    }
+
+    if (flat_map.get_cnt() != um.size()) {
+        return EXIT_FAILURE;
+    }
+
+    for (const auto& [k, v] : um) {
+        if (!flat_map.is_k_known(k) || flat_map.get_v(k) != v) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    // unknown keys, including key 0
+    for (uint32_t i = 0; i < 5000; ++i) {
+        const uint32_t k = i == 0 ? 0 : gen();
+
+        if (flat_map.get_v_as_opt(k).has_value() != um.contains(k)) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/common/adt/timer_wheel.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+
+using namespace dectnrp;
+
+static constexpr uint32_t N{64};
+
+static common::adt::timer_wheel_t<N> wheel;
+
+/// reference due times, undefined_late if not armed
+static std::array<int64_t, N> due_ref;
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    std::mt19937_64 gen(0);
+
+    // delays from a few samples up to beyond the top level of the wheel
+    std::uniform_int_distribution<uint32_t> dist_exp(0, 52);
+    std::uniform_int_distribution<uint32_t> dist_exp_advance(0, 30);
+
+    due_ref.fill(common::adt::timer_wheel_t<N>::undefined_late);
+
+    int64_t now_64 = 0;
+
+    for (uint32_t iter = 0; iter < 100000; ++iter) {
+        const uint32_t idx = gen() % N;
+
+        // randomly arm or cancel a timer
+        if (due_ref[idx] == common::adt::timer_wheel_t<N>::undefined_late) {
+            due_ref[idx] = now_64 + static_cast<int64_t>(gen() % (uint64_t{1} << dist_exp(gen)));
+            wheel.insert(idx, due_ref[idx]);
+        } else if (gen() % 4 == 0) {
+            due_ref[idx] = common::adt::timer_wheel_t<N>::undefined_late;
+            wheel.cancel(idx);
+        }
+
+        int64_t next_ref_64 = common::adt::timer_wheel_t<N>::undefined_late;
+        for (const auto due_64 : due_ref) {
+            next_ref_64 = std::min(next_ref_64, due_64);
+        }
+
+        if (wheel.get_next_due() != next_ref_64) {
+            return EXIT_FAILURE;
+        }
+
+        // advance either to the next due time or by a random amount
+        if (gen() % 2 == 0 && next_ref_64 != common::adt::timer_wheel_t<N>::undefined_late) {
+            now_64 = std::max(now_64, next_ref_64);
+        } else {
+            now_64 += static_cast<int64_t>(gen() % (uint64_t{1} << dist_exp_advance(gen)));
+        }
+
+        wheel.advance(now_64);
+
+        // expired timers must be popped in order of their due time
+        int64_t last_64 = 0;
+        while (const auto idx_expired = wheel.pop_expired()) {
+            const int64_t due_64 = due_ref[*idx_expired];
+
+            if (now_64 < due_64 || due_64 < last_64) {
+                return EXIT_FAILURE;
+            }
+
+            last_64 = due_64;
+            due_ref[*idx_expired] = common::adt::timer_wheel_t<N>::undefined_late;
+        }
+
+        // no timer which is due may remain
+        for (uint32_t i = 0; i < N; ++i) {
+            if (due_ref[i] <= now_64) {
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/common/prog/metrics.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <map>
+#include <mutex>
+
+#include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/prog/log.hpp"
+#include "dectnrp/common/thread/threads.hpp"
+
+namespace dectnrp::metrics {
+
+namespace {
+
+struct sample_t {
+        std::string labels;
+        const counter_t* counter{nullptr};
+        std::function<int64_t()> getter;
+        const histogram_t* histogram{nullptr};
+};
+
+struct family_t {
+        std::string type;
+        std::string help;
+        std::vector<sample_t> samples;
+};
+
+std::mutex registry_mutex;
+
+/// ordered by name so the output is stable
+std::map<std::string, family_t> registry;
+
+pthread_t server_thread;
+std::atomic<bool> server_keep_running{false};
+int server_fd{-1};
+
+constexpr int server_poll_timeout_ms{100};
+
+/// bounds how long a client which sends or reads nothing can block the server thread
+constexpr int client_timeout_ms{500};
+
+std::string get_labels_as_string(const labels_t& labels) {
+    std::string str;
+
+    for (const auto& [key, value] : labels) {
+        str += (str.empty() ? "" : ",") + key + "=\"" + value + "\"";
+    }
+
+    return str;
+}
+
+void add_sample(const std::string& name,
+                const std::string& type,
+                const std::string& help,
+                sample_t&& sample) {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+
+    auto& family = registry["dectnrp_" + name];
+
+    dectnrp_assert(family.type.empty() || family.type == type, "metric {} type mismatch", name);
+
+    family.type = type;
+    family.help = help;
+    family.samples.push_back(std::move(sample));
+}
+
+std::string get_sample_line(const std::string& name,
+                            const std::string& labels,
+                            const int64_t value) {
+    return name + (labels.empty() ? "" : "{" + labels + "}") + " " + std::to_string(value) + "\n";
+}
+
+void append_histogram(std::string& str,
+                      const std::string& name,
+                      const std::string& labels,
+                      const histogram_t& histogram) {
+    const std::string labels_sep = labels.empty() ? "" : labels + ",";
+
+    // cumulative, so a concurrent observe() can never make the buckets non-monotonic
+    int64_t cnt = 0;
+    for (uint32_t i = 0; i < histogram_t::N_bucket; ++i) {
+        cnt += histogram.get_bucket(i);
+        str += get_sample_line(
+            name + "_bucket", labels_sep + "le=\"" + std::to_string(int64_t{1} << i) + "\"", cnt);
+    }
+
+    cnt += histogram.get_bucket(histogram_t::N_bucket);
+    str += get_sample_line(name + "_bucket", labels_sep + "le=\"+Inf\"", cnt);
+    str += get_sample_line(name + "_sum", labels, histogram.get_sum());
+    str += get_sample_line(name + "_count", labels, cnt);
+}
+
+void answer_request(const int client_fd) {
+    const struct timeval tv{client_timeout_ms / 1000, (client_timeout_ms % 1000) * 1000};
+    if (setsockopt(client_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) < 0 ||
+        setsockopt(client_fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv)) < 0) {
+        return;
+    }
+
+    // content of the request is irrelevant, every path returns all metrics
+    char request[1024];
+    if (recv(client_fd, request, sizeof(request), 0) <= 0) {
+        return;
+    }
+
+    const std::string body = get_text();
+
+    const std::string header = "HTTP/1.1 200 OK\r\n"
+                               "Content-Type: text/plain; version=0.0.4\r\n"
+                               "Content-Length: " +
+                               std::to_string(body.size()) +
+                               "\r\n"
+                               "Connection: close\r\n\r\n";
+
+    const std::string response = header + body;
+
+    std::size_t sent = 0;
+    while (sent < response.size()) {
+        const ssize_t ret =
+            send(client_fd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+
+        if (ret <= 0) {
+            break;
+        }
+
+        sent += static_cast<std::size_t>(ret);
+    }
+}
+
+void* server_routine([[maybe_unused]] void* ptr) {
+    struct pollfd pfd{server_fd, POLLIN, 0};
+
+    while (server_keep_running.load(std::memory_order_acquire)) {
+        if (poll(&pfd, 1, server_poll_timeout_ms) <= 0) {
+            continue;
+        }
+
+        const int client_fd = accept(server_fd, nullptr, nullptr);
+
+        if (client_fd < 0) {
+            continue;
+        }
+
+        answer_request(client_fd);
+
+        close(client_fd);
+    }
+
+    return nullptr;
+}
+
+}  // namespace
+
+void register_counter(const std::string& name,
+                      const std::string& help,
+                      const labels_t& labels,
+                      const counter_t& counter) {
+    add_sample(
+        name, "counter", help, sample_t{get_labels_as_string(labels), &counter, {}, nullptr});
+}
+
+void register_gauge(const std::string& name,
+                    const std::string& help,
+                    const labels_t& labels,
+                    std::function<int64_t()> getter) {
+    add_sample(
+        name, "gauge", help, sample_t{get_labels_as_string(labels), nullptr, getter, nullptr});
+}
+
+void register_histogram(const std::string& name,
+                        const std::string& help,
+                        const labels_t& labels,
+                        const histogram_t& histogram) {
+    add_sample(
+        name, "histogram", help, sample_t{get_labels_as_string(labels), nullptr, {}, &histogram});
+}
+
+std::string get_text() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+
+    std::string str;
+
+    for (const auto& [name, family] : registry) {
+        str += "# HELP " + name + " " + family.help + "\n";
+        str += "# TYPE " + name + " " + family.type + "\n";
+
+        for (const auto& sample : family.samples) {
+            if (sample.counter != nullptr) {
+                str += get_sample_line(name, sample.labels, sample.counter->get());
+            } else if (sample.getter) {
+                str += get_sample_line(name, sample.labels, sample.getter());
+            } else {
+                append_histogram(str, name, sample.labels, *sample.histogram);
+            }
+        }
+    }
+
+    return str;
+}
+
+void server_start(const uint32_t port) {
+    dectnrp_assert(!server_keep_running.load(std::memory_order_acquire), "server already running");
+
+    if ((server_fd = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+        dectnrp_assert_failure("metrics server socket creation failed");
+    }
+
+    const int reuse = 1;
+    setsockopt(server_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    struct sockaddr_in sa_in{};
+    sa_in.sin_family = AF_INET;
+    sa_in.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa_in.sin_port = htons(port);
+
+    if (bind(server_fd, (const struct sockaddr*)&sa_in, sizeof(sa_in)) < 0 ||
+        listen(server_fd, 4) < 0) {
+        dectnrp_assert_failure("metrics server unable to listen on port {}", port);
+    }
+
+    server_keep_running.store(true, std::memory_order_release);
+
+    // normal priority on any core, must never compete with real-time threads
+    const common::threads_core_prio_config_t threads_core_prio_config;
+
+    if (!common::threads_new_rt_mask_custom(
+            &server_thread, &server_routine, nullptr, threads_core_prio_config)) {
+        dectnrp_assert_failure("metrics server unable to start thread");
+    }
+
+    dectnrp_log_inf("metrics server listening on localhost:{}", port);
+}
+
+void server_stop() {
+    if (!server_keep_running.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    server_keep_running.store(false, std::memory_order_release);
+    pthread_join(server_thread, nullptr);
+
+    close(server_fd);
+    server_fd = -1;
+}
+
+}  // namespace dectnrp::metrics
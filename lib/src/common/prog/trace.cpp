@@ -0,0 +1,262 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/common/prog/trace.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/prog/log.hpp"
+#include "dectnrp/common/prog/print.hpp"
+
+namespace dectnrp::trace {
+
+namespace {
+
+struct event_t {
+        uint64_t tsc_begin;
+        uint64_t tsc_end;
+        int64_t id;
+        stage_t stage;
+};
+
+/// written by exactly one thread, read only after that thread has stopped
+struct ring_t {
+        explicit ring_t(const uint32_t thread_idx_)
+            : thread_idx(thread_idx_),
+              events(capacity) {}
+
+        static constexpr uint64_t capacity{1 << 16};
+        static constexpr uint64_t mask{capacity - 1};
+
+        const uint32_t thread_idx;
+        std::vector<event_t> events;
+        std::atomic<uint64_t> w{0};
+};
+
+constexpr std::array<const char*, std::to_underlying(stage_t::CARDINALITY)> stage_names{
+    "chunk_ready",
+    "detection",
+    "job_enqueue",
+    "job_dequeue",
+    "token_wait",
+    "demoddecod_rx_pcc",
+    "work_pcc",
+    "demoddecod_rx_pdc",
+    "work_pdc",
+    "tx_generation"};
+
+std::mutex registry_mutex;
+std::vector<std::unique_ptr<ring_t>> registry;
+std::size_t registry_nof_assigned{0};
+thread_local ring_t* ring_local{nullptr};
+thread_local bool ring_local_missing{false};
+
+/// reference point to convert timestamps to nanoseconds
+int64_t steady_ns_0{0};
+uint64_t tsc_0{0};
+
+int64_t get_steady_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+ring_t* register_thread() {
+    std::unique_lock<std::mutex> lk(registry_mutex);
+
+    // a thread not accounted for in init() must not allocate, so its events are dropped
+    if (registry_nof_assigned == registry.size()) {
+        return nullptr;
+    }
+
+    return registry[registry_nof_assigned++].get();
+}
+
+void log_percentiles(const char* name, std::vector<double>& durations_us) {
+    if (durations_us.empty()) {
+        return;
+    }
+
+    std::sort(durations_us.begin(), durations_us.end());
+
+    const auto p = [&durations_us](const double q) {
+        const std::size_t idx =
+            static_cast<std::size_t>(q * static_cast<double>(durations_us.size()));
+        return durations_us[std::min(idx, durations_us.size() - 1)];
+    };
+
+    dectnrp_log_inf(
+        "trace {:<18} n {:>8} p50 {:9.2f}us p90 {:9.2f}us p99 {:9.2f}us p99.9 {:9.2f}us max "
+        "{:9.2f}us",
+        name,
+        durations_us.size(),
+        p(0.5),
+        p(0.9),
+        p(0.99),
+        p(0.999),
+        durations_us.back());
+}
+
+}  // namespace
+
+void init(const uint32_t nof_threads) {
+    std::unique_lock<std::mutex> lk(registry_mutex);
+
+    dectnrp_assert(registry.empty(), "trace already initialized");
+
+    for (uint32_t i = 0; i < nof_threads; ++i) {
+        registry.push_back(std::make_unique<ring_t>(i));
+    }
+
+    steady_ns_0 = get_steady_ns();
+    tsc_0 = get_tsc();
+}
+
+void record(const stage_t stage,
+            const int64_t id,
+            const uint64_t tsc_begin,
+            const uint64_t tsc_end) {
+    if (ring_local == nullptr) [[unlikely]] {
+        if (ring_local_missing) {
+            return;
+        }
+        ring_local = register_thread();
+        if (ring_local == nullptr) {
+            ring_local_missing = true;
+            return;
+        }
+    }
+
+    const uint64_t w = ring_local->w.load(std::memory_order_relaxed);
+
+    ring_local->events[w & ring_t::mask] = event_t{tsc_begin, tsc_end, id, stage};
+
+    ring_local->w.store(w + 1, std::memory_order_release);
+}
+
+void save(const std::string& filename) {
+    std::unique_lock<std::mutex> lk(registry_mutex);
+
+    if (registry_nof_assigned == 0) {
+        dectnrp_print_wrn("No trace events recorded.");
+        return;
+    }
+
+    // calibrate timestamps against steady clock over the entire runtime
+    const double ns_per_tick = static_cast<double>(get_steady_ns() - steady_ns_0) /
+                               static_cast<double>(get_tsc() - tsc_0);
+
+    const auto to_us = [ns_per_tick](const uint64_t tsc_a, const uint64_t tsc_b) {
+        return static_cast<double>(static_cast<int64_t>(tsc_b - tsc_a)) * ns_per_tick / 1000.0;
+    };
+
+    // events can begin before the first thread registers, so use earliest event as origin
+    uint64_t tsc_origin = tsc_0;
+    for (const auto& ring : registry) {
+        const uint64_t w = ring->w.load(std::memory_order_acquire);
+        for (uint64_t i = w - std::min(w, ring_t::capacity); i < w; ++i) {
+            tsc_origin = std::min(tsc_origin, ring->events[i & ring_t::mask].tsc_begin);
+        }
+    }
+
+    std::array<std::vector<double>, std::to_underlying(stage_t::CARDINALITY)> durations_us;
+    std::vector<double> job_queue_wait_us;
+    std::unordered_map<int64_t, uint64_t> job_enqueue_tsc;
+
+    std::ofstream file(filename);
+
+    file << "{\"traceEvents\":[\n";
+
+    bool first = true;
+
+    for (const auto& ring : registry) {
+        const uint64_t w = ring->w.load(std::memory_order_acquire);
+        const uint64_t n = std::min(w, ring_t::capacity);
+
+        for (uint64_t i = w - n; i < w; ++i) {
+            const event_t& event = ring->events[i & ring_t::mask];
+            const auto stage_idx = std::to_underlying(event.stage);
+
+            const bool is_instant = event.tsc_begin == event.tsc_end;
+
+            file << fmt::format(
+                "{}{{\"name\":\"{}\",\"ph\":\"{}\",\"ts\":{:.3f},{}\"pid\":0,\"tid\":{},"
+                "\"args\":{{\"id\":{}}}}}",
+                first ? "" : ",\n",
+                stage_names[stage_idx],
+                is_instant ? "i" : "X",
+                to_us(tsc_origin, event.tsc_begin),
+                is_instant ? "\"s\":\"t\","
+                           : fmt::format("\"dur\":{:.3f},", to_us(event.tsc_begin, event.tsc_end)),
+                ring->thread_idx,
+                event.id);
+
+            first = false;
+
+            if (!is_instant) {
+                durations_us[stage_idx].push_back(to_us(event.tsc_begin, event.tsc_end));
+            }
+
+            // enqueue and dequeue are recorded by different threads and matched by ID
+            if (event.stage == stage_t::job_enqueue) {
+                job_enqueue_tsc[event.id] = event.tsc_begin;
+            }
+        }
+    }
+
+    file << "\n]}\n";
+
+    for (const auto& ring : registry) {
+        const uint64_t w = ring->w.load(std::memory_order_acquire);
+        const uint64_t n = std::min(w, ring_t::capacity);
+
+        for (uint64_t i = w - n; i < w; ++i) {
+            const event_t& event = ring->events[i & ring_t::mask];
+
+            if (event.stage != stage_t::job_dequeue) {
+                continue;
+            }
+
+            if (const auto it = job_enqueue_tsc.find(event.id); it != job_enqueue_tsc.end()) {
+                job_queue_wait_us.push_back(to_us(it->second, event.tsc_begin));
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < durations_us.size(); ++i) {
+        log_percentiles(stage_names[i], durations_us[i]);
+    }
+
+    log_percentiles("job_queue_wait", job_queue_wait_us);
+
+    dectnrp_print_inf("Trace of {} threads written to {}", registry_nof_assigned, filename);
+}
+
+}  // namespace dectnrp::trace
@@ -0,0 +1,224 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/common/thread/cpu_topology.hpp"
+
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <climits>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <thread>
+#include <utility>
+
+#include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/prog/log.hpp"
+#include "header_only/fmt/format.h"
+#include "header_only/fmt/ranges.h"
+
+namespace dectnrp::common {
+
+static std::string read_first_line(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+static int get_numa_node(const std::filesystem::path& cpu_path) {
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(cpu_path, ec)) {
+        const std::string name = entry.path().filename().string();
+
+        // the kernel links every CPU core to its node as cpuX/nodeY
+        if (name.size() > 4 && name.starts_with("node")) {
+            const char* const end = name.data() + name.size();
+            int node = -1;
+            const auto res = std::from_chars(name.data() + 4, end, node);
+            if (res.ec == std::errc() && res.ptr == end) {
+                return node;
+            }
+        }
+    }
+
+    return -1;
+}
+
+static int get_l3_id(const std::filesystem::path& cpu_path) {
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(cpu_path / "cache", ec)) {
+        if (!entry.path().filename().string().starts_with("index")) {
+            continue;
+        }
+
+        if (read_first_line(entry.path() / "level") != "3") {
+            continue;
+        }
+
+        const auto shared =
+            cpu_topology_t::get_cpu_cores(read_first_line(entry.path() / "shared_cpu_list"));
+
+        return shared.empty() ? -1 : shared.front();
+    }
+
+    return -1;
+}
+
+std::string cpu_domain_t::get_string() const {
+    return fmt::format("numa_node={} l3_id={} cpu_cores={}",
+                       numa_node,
+                       l3_id,
+                       fmt::join(cpu_cores.begin(), cpu_cores.end(), ","));
+}
+
+cpu_topology_t::cpu_topology_t(const std::string sysfs_cpu_path) {
+    const std::filesystem::path sysfs(sysfs_cpu_path);
+
+    std::vector<int> cpu_cores_online = get_cpu_cores(read_first_line(sysfs / "online"));
+
+    if (cpu_cores_online.empty()) {
+        for (int i = 0; i < static_cast<int>(std::thread::hardware_concurrency()); ++i) {
+            cpu_cores_online.push_back(i);
+        }
+    }
+
+    // cores excluded by taskset, cgroups etc. can not be used by any of our threads
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    const bool has_affinity = sched_getaffinity(0, sizeof(cpu_set_t), &cpuset) == 0;
+
+    std::map<std::pair<int, int>, std::vector<int>> domain_map;
+
+    for (const int cpu_core : cpu_cores_online) {
+        if (has_affinity && (cpu_core >= CPU_SETSIZE || !CPU_ISSET(cpu_core, &cpuset))) {
+            continue;
+        }
+
+        const std::filesystem::path cpu_path = sysfs / ("cpu" + std::to_string(cpu_core));
+
+        domain_map[{get_numa_node(cpu_path), get_l3_id(cpu_path)}].push_back(cpu_core);
+    }
+
+    for (auto& [key, cpu_cores] : domain_map) {
+        domains.push_back(cpu_domain_t{key.first, key.second, std::move(cpu_cores)});
+    }
+
+    // every core is at least part of one unknown domain
+    if (domains.empty()) {
+        domains.push_back(cpu_domain_t{-1, -1, cpu_cores_online});
+    }
+}
+
+std::vector<int> cpu_topology_t::get_cpu_cores(const std::string& cpu_list) {
+    std::vector<int> ret;
+
+    const char* pos = cpu_list.data();
+    const char* const end = cpu_list.data() + cpu_list.size();
+
+    while (pos < end) {
+        int first = 0;
+        auto res = std::from_chars(pos, end, first);
+        if (res.ec != std::errc() || first < 0) {
+            return {};
+        }
+
+        int last = first;
+        if (res.ptr < end && *res.ptr == '-') {
+            res = std::from_chars(res.ptr + 1, end, last);
+            if (res.ec != std::errc() || last < first) {
+                return {};
+            }
+        }
+
+        for (int i = first; i <= last; ++i) {
+            ret.push_back(i);
+        }
+
+        if (res.ptr < end && *res.ptr != ',') {
+            return {};
+        }
+
+        pos = res.ptr + 1;
+    }
+
+    std::sort(ret.begin(), ret.end());
+    ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+
+    return ret;
+}
+
+cpu_domain_scope_t::cpu_domain_scope_t(const cpu_domain_t& cpu_domain) {
+    if (!cpu_domain.is_valid()) {
+        return;
+    }
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (const int cpu_core : cpu_domain.cpu_cores) {
+        CPU_SET(static_cast<std::size_t>(cpu_core), &cpuset);
+    }
+
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset_previous) == 0 &&
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) == 0) {
+        affinity_changed = true;
+    } else {
+        dectnrp_log_wrn("unable to restrict thread to cores {}", cpu_domain.get_string());
+    }
+
+    if (cpu_domain.numa_node < 0) {
+        return;
+    }
+
+    std::array<unsigned long, 16> nodemask{};
+    constexpr std::size_t bits_per_elem = sizeof(unsigned long) * CHAR_BIT;
+
+    dectnrp_assert(static_cast<std::size_t>(cpu_domain.numa_node) < nodemask.size() * bits_per_elem,
+                   "NUMA node {} too large",
+                   cpu_domain.numa_node);
+
+    nodemask[cpu_domain.numa_node / bits_per_elem] |= 1UL << (cpu_domain.numa_node % bits_per_elem);
+
+    if (syscall(SYS_set_mempolicy,
+                MPOL_PREFERRED,
+                nodemask.data(),
+                nodemask.size() * bits_per_elem) == 0) {
+        mempolicy_changed = true;
+    } else {
+        dectnrp_log_wrn("unable to prefer memory on NUMA node {}", cpu_domain.numa_node);
+    }
+}
+
+cpu_domain_scope_t::~cpu_domain_scope_t() {
+    if (mempolicy_changed) {
+        syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0);
+    }
+
+    if (affinity_changed) {
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset_previous);
+    }
+}
+
+}  // namespace dectnrp::common
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/common/thread/free_list.hpp"
+
+#include "dectnrp/common/prog/assert.hpp"
+
+namespace dectnrp::common {
+
+free_list_t::free_list_t(const uint32_t capacity_)
+    : capacity(capacity_),
+      next(capacity_) {
+    dectnrp_assert(capacity < idx_none, "capacity too large");
+
+    for (uint32_t i = 0; i < capacity; ++i) {
+        next[i].store(i + 1 < capacity ? i + 1 : idx_none, std::memory_order_relaxed);
+    }
+
+    head.store(capacity > 0 ? 0 : idx_none, std::memory_order_release);
+}
+
+std::optional<uint32_t> free_list_t::pop() {
+    uint64_t head_old = head.load(std::memory_order_acquire);
+
+    while (true) {
+        const uint32_t idx = static_cast<uint32_t>(head_old & idx_mask);
+
+        if (idx == idx_none) {
+            return std::nullopt;
+        }
+
+        // may be stale if another thread pops idx concurrently, in which case the tag changes
+        const uint64_t tag = (head_old >> 32) + 1;
+        const uint64_t head_new = (tag << 32) | next[idx].load(std::memory_order_relaxed);
+
+        if (head.compare_exchange_weak(
+                head_old, head_new, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return idx;
+        }
+    }
+}
+
+void free_list_t::push(const uint32_t idx) {
+    dectnrp_assert(idx < capacity, "index out of range");
+
+    uint64_t head_old = head.load(std::memory_order_relaxed);
+
+    while (true) {
+        next[idx].store(static_cast<uint32_t>(head_old & idx_mask), std::memory_order_relaxed);
+
+        const uint64_t tag = (head_old >> 32) + 1;
+        const uint64_t head_new = (tag << 32) | idx;
+
+        if (head.compare_exchange_weak(
+                head_old, head_new, std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+}  // namespace dectnrp::common
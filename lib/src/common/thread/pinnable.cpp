@@ -0,0 +1,84 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/common/thread/pinnable.hpp"
+
+#include "dectnrp/common/prog/assert.hpp"
+
+namespace dectnrp::common {
+
+bool pin_budget_t::try_acquire() {
+    uint32_t nof_pins_local = nof_pins.load(std::memory_order_relaxed);
+
+    do {
+        if (nof_pins_local >= nof_pins_max) {
+            return false;
+        }
+    } while (!nof_pins.compare_exchange_weak(
+        nof_pins_local, nof_pins_local + 1, std::memory_order_relaxed));
+
+    return true;
+}
+
+void pin_budget_t::release() {
+    [[maybe_unused]] const uint32_t nof_pins_prev =
+        nof_pins.fetch_sub(1, std::memory_order_relaxed);
+
+    dectnrp_assert(0 < nof_pins_prev, "released more pins than acquired");
+}
+
+uint32_t pin_budget_t::get_nof_pins() const { return nof_pins.load(std::memory_order_relaxed); }
+
+bool pinnable_t::try_pin() {
+    if (pin_budget != nullptr && !pin_budget->try_acquire()) {
+        return false;
+    }
+
+    [[maybe_unused]] const uint32_t pin_cnt_prev = pin_cnt.fetch_add(1, std::memory_order_relaxed);
+
+    dectnrp_assert(0 < pin_cnt_prev, "object must be pinned before pinning it again");
+
+    return true;
+}
+
+void pinnable_t::unpin() {
+    // return the budget first, the object may be reused by its owner right after remove_pin()
+    if (pin_budget != nullptr) {
+        pin_budget->release();
+    }
+
+    remove_pin();
+}
+
+void pinnable_t::unpin_owner() { remove_pin(); }
+
+bool pinnable_t::is_pinned_by_others() const {
+    return pin_cnt.load(std::memory_order_acquire) > 1;
+}
+
+void pinnable_t::remove_pin() {
+    // acq_rel makes all accesses of other pin holders visible to the thread calling unpinned_func()
+    if (pin_cnt.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        pin_cnt.store(1, std::memory_order_relaxed);
+        unpinned_func();
+    }
+}
+
+}  // namespace dectnrp::common
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "dectnrp/common/thread/free_list.hpp"
+
+using namespace dectnrp;
+
+static constexpr uint32_t N_objects{8};
+static constexpr uint32_t N_threads{4};
+static constexpr uint32_t N_iterations{100000};
+
+static std::atomic<bool> in_use[N_objects];
+static std::atomic<bool> any_error{false};
+
+static void acquire_and_release(common::free_list_t& free_list) {
+    for (uint32_t i = 0; i < N_iterations; ++i) {
+        const auto idx_opt = free_list.pop();
+
+        if (!idx_opt.has_value()) {
+            continue;
+        }
+
+        // no other thread may hold the same index at the same time
+        if (in_use[idx_opt.value()].exchange(true)) {
+            any_error.store(true);
+        }
+
+        in_use[idx_opt.value()].store(false);
+
+        free_list.push(idx_opt.value());
+    }
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    common::free_list_t free_list(N_objects);
+
+    // single thread, all indices must be returned exactly once
+    std::vector<uint32_t> popped;
+    while (const auto idx_opt = free_list.pop()) {
+        popped.push_back(idx_opt.value());
+    }
+
+    if (popped.size() != N_objects) {
+        return EXIT_FAILURE;
+    }
+
+    for (const auto idx : popped) {
+        free_list.push(idx);
+    }
+
+    // multiple threads
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < N_threads; ++i) {
+        threads.emplace_back(acquire_and_release, std::ref(free_list));
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    uint32_t cnt = 0;
+    while (free_list.pop().has_value()) {
+        ++cnt;
+    }
+
+    if (any_error.load() || cnt != N_objects) {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/common/thread/pinnable.hpp"
+
+using namespace dectnrp;
+
+class object_t final : public common::pinnable_t {
+    public:
+        explicit object_t(common::pin_budget_t* pin_budget_ = nullptr) {
+            pin_budget = pin_budget_;
+        }
+
+        std::atomic<uint32_t> unpinned_cnt{0};
+
+    private:
+        void unpinned_func() override final { ++unpinned_cnt; }
+};
+
+static bool test_owner_unpins_last() {
+    object_t object;
+
+    bool any_error = !object.try_pin() || !object.try_pin();
+    any_error |= !object.is_pinned_by_others();
+
+    object.unpin();
+    object.unpin();
+    any_error |= object.is_pinned_by_others() || object.unpinned_cnt != 0;
+
+    object.unpin_owner();
+    any_error |= object.unpinned_cnt != 1;
+
+    return any_error;
+}
+
+static bool test_others_unpin_last() {
+    object_t object;
+
+    bool any_error = false;
+
+    // the object is reused after every round, as a HARQ process is
+    for (uint32_t round = 1; round <= 3; ++round) {
+        any_error |= !object.try_pin() || !object.try_pin();
+
+        object.unpin_owner();
+        object.unpin();
+        any_error |= object.unpinned_cnt != round - 1;
+
+        object.unpin();
+        any_error |= object.unpinned_cnt != round;
+    }
+
+    return any_error;
+}
+
+static bool test_budget() {
+    common::pin_budget_t pin_budget(2);
+
+    object_t a(&pin_budget);
+    object_t b(&pin_budget);
+    object_t c(&pin_budget);
+
+    bool any_error = !a.try_pin() || !b.try_pin();
+
+    // budget exhausted, neither a new nor an already pinned object can be pinned
+    any_error |= c.try_pin() || a.try_pin();
+    any_error |= pin_budget.get_nof_pins() != 2 || c.is_pinned_by_others();
+
+    // an object which cannot be pinned is released by its owner right away
+    c.unpin_owner();
+    any_error |= c.unpinned_cnt != 1;
+
+    a.unpin_owner();
+    a.unpin();
+    any_error |= a.unpinned_cnt != 1 || pin_budget.get_nof_pins() != 1;
+
+    any_error |= !c.try_pin();
+    any_error |= pin_budget.get_nof_pins() != 2;
+
+    b.unpin_owner();
+    b.unpin();
+    c.unpin_owner();
+    c.unpin();
+    any_error |= b.unpinned_cnt != 1 || c.unpinned_cnt != 2 || pin_budget.get_nof_pins() != 0;
+
+    return any_error;
+}
+
+static bool test_concurrent_unpin() {
+    constexpr uint32_t N_threads{4};
+    constexpr uint32_t N_rounds{1000};
+
+    common::pin_budget_t pin_budget(N_threads);
+    object_t object(&pin_budget);
+
+    bool any_error = false;
+
+    for (uint32_t round = 1; round <= N_rounds; ++round) {
+        // the owner pins on behalf of each thread
+        for (uint32_t i = 0; i < N_threads; ++i) {
+            any_error |= !object.try_pin();
+        }
+
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < N_threads; ++i) {
+            threads.emplace_back([&object]() { object.unpin(); });
+        }
+
+        object.unpin_owner();
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        // exactly one of the threads or the owner removed the last pin
+        any_error |= object.unpinned_cnt != round || pin_budget.get_nof_pins() != 0;
+
+        if (any_error) {
+            break;
+        }
+    }
+
+    return any_error;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    bool any_error = false;
+
+    if (test_owner_unpins_last()) {
+        dectnrp_print_wrn("owner unpinning last did not call unpinned_func() exactly once");
+        any_error = true;
+    }
+
+    if (test_others_unpin_last()) {
+        dectnrp_print_wrn("others unpinning last did not call unpinned_func() exactly once");
+        any_error = true;
+    }
+
+    if (test_budget()) {
+        dectnrp_print_wrn("pin budget not enforced");
+        any_error = true;
+    }
+
+    if (test_concurrent_unpin()) {
+        dectnrp_print_wrn("concurrent unpin did not call unpinned_func() exactly once");
+        any_error = true;
+    }
+
+    return any_error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "dectnrp/common/thread/cpu_topology.hpp"
+#include "dectnrp/common/thread/thread_placement.hpp"
+
+using namespace dectnrp;
+
+static void write_file(const std::filesystem::path& path, const std::string& content) {
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream(path) << content << "\n";
+}
+
+/// two NUMA nodes with four cores each, every node has one L3 cache
+static std::filesystem::path create_sysfs() {
+    const auto sysfs = std::filesystem::temp_directory_path() / "dectnrp_test_thread_placement";
+    std::filesystem::remove_all(sysfs);
+
+    write_file(sysfs / "online", "0-7");
+
+    for (int cpu_core = 0; cpu_core < 8; ++cpu_core) {
+        const auto cpu_path = sysfs / ("cpu" + std::to_string(cpu_core));
+        const int node = cpu_core / 4;
+
+        std::filesystem::create_directories(cpu_path / ("node" + std::to_string(node)));
+        write_file(cpu_path / "cache" / "index2" / "level", "2");
+        write_file(cpu_path / "cache" / "index2" / "shared_cpu_list", std::to_string(cpu_core));
+        write_file(cpu_path / "cache" / "index3" / "level", "3");
+        write_file(cpu_path / "cache" / "index3" / "shared_cpu_list", node == 0 ? "0-3" : "4-7");
+    }
+
+    return sysfs;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    if (common::cpu_topology_t::get_cpu_cores("0-2,5,7-8") != std::vector<int>{0, 1, 2, 5, 7, 8} ||
+        !common::cpu_topology_t::get_cpu_cores("3-1").empty() ||
+        !common::cpu_topology_t::get_cpu_cores("a").empty()) {
+        return EXIT_FAILURE;
+    }
+
+    const auto sysfs = create_sysfs();
+
+    const common::cpu_topology_t cpu_topology(sysfs.string());
+
+    std::filesystem::remove_all(sysfs);
+
+    // cores not available to this process are dropped, so only check the domain keys
+    for (const auto& cpu_domain : cpu_topology.get_domains()) {
+        for (const int cpu_core : cpu_domain.cpu_cores) {
+            if (cpu_domain.numa_node != cpu_core / 4 ||
+                cpu_domain.l3_id != cpu_domain.numa_node * 4) {
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    common::thread_placement_t thread_placement(cpu_topology);
+
+    std::vector<common::cpu_domain_t> cpu_domain_vec;
+
+    // two groups with two automatic threads each and one manual thread
+    for (int group = 0; group < 2; ++group) {
+        std::vector<common::threads_core_prio_config_t> config_vec(3);
+        config_vec[0].cpu_core = common::threads_core_prio_config_t::cpu_core_auto;
+        config_vec[1].cpu_core = common::threads_core_prio_config_t::cpu_core_auto;
+
+        const auto cpu_domain = thread_placement.add_group(
+            "group", {{"a", &config_vec[0]}, {"b", &config_vec[1]}, {"c", &config_vec[2]}});
+
+        if (!cpu_domain.is_valid() || config_vec[2].cpu_core != -1) {
+            return EXIT_FAILURE;
+        }
+
+        // automatic threads are placed within the domain of their group
+        for (uint32_t i = 0; i < 2; ++i) {
+            if (std::find(cpu_domain.cpu_cores.begin(),
+                          cpu_domain.cpu_cores.end(),
+                          config_vec[i].cpu_core) == cpu_domain.cpu_cores.end()) {
+                return EXIT_FAILURE;
+            }
+        }
+
+        // with two cores or more, both threads get their own core
+        if (cpu_domain.cpu_cores.size() > 1 && config_vec[0].cpu_core == config_vec[1].cpu_core) {
+            return EXIT_FAILURE;
+        }
+
+        cpu_domain_vec.push_back(cpu_domain);
+    }
+
+    // with both nodes available, groups are spread across nodes
+    if (cpu_topology.get_domains().size() == 2 &&
+        cpu_domain_vec[0].numa_node == cpu_domain_vec[1].numa_node) {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
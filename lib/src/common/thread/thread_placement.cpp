@@ -0,0 +1,113 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/common/thread/thread_placement.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "dectnrp/common/prog/assert.hpp"
+#include "header_only/fmt/format.h"
+
+namespace dectnrp::common {
+
+thread_placement_t::thread_placement_t(const cpu_topology_t& cpu_topology_)
+    : cpu_topology(cpu_topology_) {
+    dectnrp_assert(!cpu_topology.get_domains().empty(), "no CPU domain");
+
+    for (const auto& cpu_domain : cpu_topology.get_domains()) {
+        nof_threads_per_core.push_back(std::vector<uint32_t>(cpu_domain.cpu_cores.size(), 0));
+    }
+}
+
+cpu_domain_t thread_placement_t::add_group(const std::string& name,
+                                           const std::vector<thread_t>& thread_vec) {
+    const auto& domains = cpu_topology.get_domains();
+
+    std::vector<threads_core_prio_config_t*> auto_vec;
+    std::vector<std::string> auto_name_vec;
+
+    for (const auto& thread : thread_vec) {
+        dectnrp_assert(thread.threads_core_prio_config != nullptr, "config undefined");
+
+        const int cpu_core = thread.threads_core_prio_config->cpu_core;
+
+        if (cpu_core == threads_core_prio_config_t::cpu_core_auto) {
+            auto_vec.push_back(thread.threads_core_prio_config);
+            auto_name_vec.push_back(thread.name);
+            continue;
+        }
+
+        // fixed cores are occupied irrespective of which domain they belong to
+        for (std::size_t d = 0; d < domains.size(); ++d) {
+            const auto it = std::find(
+                domains[d].cpu_cores.begin(), domains[d].cpu_cores.end(), cpu_core);
+            if (it != domains[d].cpu_cores.end()) {
+                ++nof_threads_per_core[d][std::distance(domains[d].cpu_cores.begin(), it)];
+            }
+        }
+    }
+
+    if (auto_vec.empty()) {
+        plan.push_back(fmt::format("group {} placed manually", name));
+        return cpu_domain_t{};
+    }
+
+    // pick domain with the lowest number of threads per core after placing this group
+    std::size_t d_best = 0;
+    double load_best = 0.0;
+    for (std::size_t d = 0; d < domains.size(); ++d) {
+        const uint32_t nof_threads = std::accumulate(
+            nof_threads_per_core[d].begin(), nof_threads_per_core[d].end(), uint32_t{0});
+
+        const double load = static_cast<double>(nof_threads + auto_vec.size()) /
+                            static_cast<double>(domains[d].cpu_cores.size());
+
+        if (d == 0 || load < load_best) {
+            d_best = d;
+            load_best = load;
+        }
+    }
+
+    const cpu_domain_t& cpu_domain = domains[d_best];
+    auto& nof_threads = nof_threads_per_core[d_best];
+
+    plan.push_back(fmt::format("group {} domain {}", name, cpu_domain.get_string()));
+
+    // within the domain, every thread gets the least occupied core
+    for (std::size_t i = 0; i < auto_vec.size(); ++i) {
+        const auto it = std::min_element(nof_threads.begin(), nof_threads.end());
+        const std::size_t idx = std::distance(nof_threads.begin(), it);
+
+        auto_vec[i]->cpu_core = cpu_domain.cpu_cores[idx];
+
+        plan.push_back(fmt::format("group {} thread {} cpu_core {}{}",
+                                   name,
+                                   auto_name_vec[i],
+                                   auto_vec[i]->cpu_core,
+                                   *it > 0 ? " (shared)" : ""));
+
+        ++(*it);
+    }
+
+    return cpu_domain;
+}
+
+}  // namespace dectnrp::common
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/mac/contact_list.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/mac/contact.hpp"
+#include "dectnrp/sections_part4/mac_architecture/identity.hpp"
+
+using namespace dectnrp;
+
+static constexpr uint32_t N_contacts{300};
+
+/// identifiers of contact i, spread so that neighbouring contacts don't share hash buckets
+static sp4::mac_architecture::identity_t get_identity(const uint32_t i) {
+    const uint32_t lrdid = 0x10000000 + (i * 0x9E3779B1U) % 0x0FFFFFFF;
+
+    return sp4::mac_architecture::identity_t(1, lrdid, 7 * i + 3);
+}
+
+static uint32_t get_conn_idx_server(const uint32_t i) { return 1000 + i; }
+
+static uint32_t get_conn_idx_client(const uint32_t i) { return 5000 - 3 * i; }
+
+/// every identifier of every contact resolves to the same contact and the other identifiers
+static bool test_mappings_consistent() {
+    mac::contact_list_t<mac::contact_t> contact_list;
+
+    // no reserve(), so all maps rehash while contacts are added
+    for (uint32_t i = 0; i < N_contacts; ++i) {
+        const auto identity = get_identity(i);
+
+        contact_list.add_new_contact_and_setup_indexing(
+            identity, get_conn_idx_server(i), get_conn_idx_client(i));
+
+        contact_list.get_contact(identity.LongRadioDeviceID).identity = identity;
+    }
+
+    if (contact_list.get_contacts_vec().size() != N_contacts) {
+        return true;
+    }
+
+    for (uint32_t i = 0; i < N_contacts; ++i) {
+        const auto identity = get_identity(i);
+        const uint32_t lrdid = identity.LongRadioDeviceID;
+        const uint32_t srdid = identity.ShortRadioDeviceID;
+
+        if (!contact_list.is_lrdid_known(lrdid) || !contact_list.is_srdid_known(srdid)) {
+            dectnrp_print_wrn("contact {} unknown", i);
+            return true;
+        }
+
+        const auto idx = contact_list.get_idx_from_srdid(srdid);
+
+        if (!idx.has_value() || idx.value() != i) {
+            dectnrp_print_wrn("contact {} has incorrect index", i);
+            return true;
+        }
+
+        if (contact_list.get_lrdid_from_srdid(srdid) != lrdid ||
+            contact_list.get_srdid_from_lrdid(lrdid) != srdid ||
+            contact_list.get_lrdid_from_conn_idx_server(get_conn_idx_server(i)) != lrdid ||
+            contact_list.get_conn_idx_client_from_lrdid(lrdid) != get_conn_idx_client(i)) {
+            dectnrp_print_wrn("identifiers of contact {} inconsistent", i);
+            return true;
+        }
+
+        // all paths lead to the same contact
+        const auto& contact = contact_list.get_contact(lrdid);
+
+        if (&contact != &contact_list.get_contact_from_idx(idx.value()) ||
+            &contact != &contact_list.get_contacts_vec()[i] ||
+            contact.identity.LongRadioDeviceID != lrdid ||
+            contact.identity.ShortRadioDeviceID != srdid) {
+            dectnrp_print_wrn("contact {} resolved incorrectly", i);
+            return true;
+        }
+    }
+
+    // identifiers in between known ones are not known
+    for (uint32_t i = 0; i < N_contacts; ++i) {
+        const uint32_t srdid = get_identity(i).ShortRadioDeviceID + 1;
+
+        if (contact_list.is_srdid_known(srdid) || contact_list.get_idx_from_srdid(srdid)) {
+            return true;
+        }
+
+        if (contact_list.is_lrdid_known(get_identity(i).LongRadioDeviceID + 1)) {
+            return true;
+        }
+    }
+
+    return contact_list.is_srdid_known(
+        sp4::mac_architecture::identity_t::ShortRadioDeviceID_reserved);
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    if (test_mappings_consistent()) {
+        dectnrp_print_wrn("contact_list_t mappings inconsistent");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
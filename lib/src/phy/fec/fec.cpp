@@ -133,6 +133,9 @@ void fec_t::decode_tb(const sp3::fec_cfg_t& rx_cfg,
                       const uint32_t nof_bits_maximum) {
     dectnrp_assert(nof_bits_maximum <= rx_cfg.G, "Nof bits fed larger G");
 
+    // no sequence means no descrambling
+    srsran_sequence_t* srsran_sequence_rx = rx_cfg.d_descrambled ? nullptr : srsran_sequence;
+
     decode_tb_status_latest = pdc_decode_codeblocks(&pdc_enc,
                                                     hb.get_softbuffer_d(),
                                                     &srsran_cbsegm,
@@ -144,7 +147,7 @@ void fec_t::decode_tb(const sp3::fec_cfg_t& rx_cfg,
                                                     cb_idx,
                                                     wp,
                                                     nof_bits_maximum,
-                                                    srsran_sequence);
+                                                    srsran_sequence_rx);
 }
 
 }  // namespace dectnrp::phy
@@ -287,6 +287,9 @@ void pdc_encode_codeblocks(pdc_enc_t* q,
  *
  *      completely. This way each new rv for each CB is processed, even if the checksum was correct
  * in a previous CB.
+ *
+ *  13) Skip descrambling if srsran_sequence is nullptr. In that case, the d bits were already
+ *      descrambled by the demapper.
  */
 bool pdc_decode_codeblocks(pdc_enc_t* q,
                            srsran_softbuffer_rx_t* softbuffer,
@@ -337,7 +340,9 @@ bool pdc_decode_codeblocks(pdc_enc_t* q,
         }
 
         // descramble all bits required for this codeblock
-        if (q->llr_bit_width == 8) {
+        if (srsran_sequence == nullptr) {
+            // already descrambled by the demapper
+        } else if (q->llr_bit_width == 8) {
             srsran_scrambling_sb_offset(srsran_sequence, (int8_t*)&e_bits[rp], rp, n_e2);
         } else if (q->llr_bit_width == 16) {
             srsran_scrambling_s_offset(srsran_sequence, &e_bits[rp], rp, n_e2);
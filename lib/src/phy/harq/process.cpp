@@ -62,4 +62,12 @@ void process_t::reset() {
     rv = 0;
 }
 
+void process_t::release() {
+    dectnrp_assert(!is_outer_locked() && !is_inner_locked(), "incorrect lock state");
+
+    if (free_list != nullptr) {
+        free_list->push(id);
+    }
+}
+
 }  // namespace dectnrp::phy::harq
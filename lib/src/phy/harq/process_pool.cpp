@@ -20,19 +20,28 @@
 
 #include "dectnrp/phy/harq/process_pool.hpp"
 
+#include <algorithm>
+
 #include "dectnrp/common/prog/assert.hpp"
 
 namespace dectnrp::phy::harq {
 
 process_pool_t::process_pool_t(const sp3::packet_sizes_t maximum_packet_sizes,
                                const uint32_t nof_process_tx,
-                               const uint32_t nof_process_rx) {
+                               const uint32_t nof_process_rx)
+    : packet_sizes_lut(maximum_packet_sizes),
+      free_list_tx(std::make_unique<common::free_list_t>(nof_process_tx)),
+      free_list_rx(std::make_unique<common::free_list_t>(nof_process_rx)),
+      pin_budget_rx(std::make_unique<common::pin_budget_t>(nof_process_rx / 2)) {
     for (uint32_t i = 0; i < nof_process_tx; ++i) {
         hp_tx_vec.push_back(std::make_unique<process_tx_t>(i, maximum_packet_sizes));
+        hp_tx_vec.back()->free_list = free_list_tx.get();
     }
 
     for (uint32_t i = 0; i < nof_process_rx; ++i) {
         hp_rx_vec.push_back(std::make_unique<process_rx_t>(i, maximum_packet_sizes));
+        hp_rx_vec.back()->free_list = free_list_rx.get();
+        hp_rx_vec.back()->pin_budget = pin_budget_rx.get();
     }
 }
 
@@ -42,28 +51,29 @@ process_tx_t* process_pool_t::get_process_tx(const uint32_t PLCF_type,
                                              const finalize_tx_t ftx) const {
     dectnrp_assert(PLCF_type == 1 || PLCF_type == 2, "unknown PLCF type");
 
-    const auto packet_sizes_opt = sp3::get_packet_sizes(psdef);
+    const auto packet_sizes = get_packet_sizes_verified(psdef);
 
-    dectnrp_assert(packet_sizes_opt.has_value(), "packets must be well-defined");
+    // pop the index of any process not in use
+    const auto idx_opt = free_list_tx->pop();
 
-    // go over each HARQ process ...
-    for (uint32_t i = 0; i < hp_tx_vec.size(); ++i) {
-        // ... and try to lock it
-        if (hp_tx_vec.at(i)->try_lock_outer()) {
-            dectnrp_assert(packet_sizes_opt->N_TB_byte <= hp_tx_vec[i]->get_hb_tb()->a_len,
-                           "packet TB larger than buffer");
-
-            hp_tx_vec[i]->PLCF_type = PLCF_type;
-            hp_tx_vec[i]->network_id = network_id;
-            hp_tx_vec[i]->packet_sizes = packet_sizes_opt.value();
-            hp_tx_vec[i]->finalize_tx = ftx;
-            hp_tx_vec[i]->lock_inner();
-
-            return hp_tx_vec[i].get();
-        }
+    if (!idx_opt.has_value()) {
+        return nullptr;
     }
 
-    return nullptr;
+    const uint32_t idx = idx_opt.value();
+
+    hp_tx_vec[idx]->lock_outer();
+
+    dectnrp_assert(packet_sizes.N_TB_byte <= hp_tx_vec[idx]->get_hb_tb()->a_len,
+                   "packet TB larger than buffer");
+
+    hp_tx_vec[idx]->PLCF_type = PLCF_type;
+    hp_tx_vec[idx]->network_id = network_id;
+    hp_tx_vec[idx]->packet_sizes = packet_sizes;
+    hp_tx_vec[idx]->finalize_tx = ftx;
+    hp_tx_vec[idx]->lock_inner();
+
+    return hp_tx_vec[idx].get();
 };
 
 process_rx_t* process_pool_t::get_process_rx(const uint32_t PLCF_type,
@@ -73,29 +83,30 @@ process_rx_t* process_pool_t::get_process_rx(const uint32_t PLCF_type,
                                              const finalize_rx_t frx) const {
     dectnrp_assert(PLCF_type == 1 || PLCF_type == 2, "unknown PLCF type");
 
-    const auto packet_sizes_opt = sp3::get_packet_sizes(psdef);
+    const auto packet_sizes = get_packet_sizes_verified(psdef);
 
-    dectnrp_assert(packet_sizes_opt.has_value(), "packets must be well-defined");
+    // pop the index of any process not in use
+    const auto idx_opt = free_list_rx->pop();
 
-    // go over each HARQ process ...
-    for (uint32_t i = 0; i < hp_rx_vec.size(); ++i) {
-        // ... and try to lock it
-        if (hp_rx_vec.at(i)->try_lock_outer()) {
-            dectnrp_assert(packet_sizes_opt->N_TB_byte <= hp_rx_vec[i]->get_hb_tb()->a_len,
-                           "packet TB larger than buffer");
-
-            hp_rx_vec[i]->PLCF_type = PLCF_type;
-            hp_rx_vec[i]->network_id = network_id;
-            hp_rx_vec[i]->packet_sizes = packet_sizes_opt.value();
-            hp_rx_vec[i]->rv = rv;
-            hp_rx_vec[i]->finalize_rx = frx;
-            hp_rx_vec[i]->lock_inner();
-
-            return hp_rx_vec[i].get();
-        }
+    if (!idx_opt.has_value()) {
+        return nullptr;
     }
 
-    return nullptr;
+    const uint32_t idx = idx_opt.value();
+
+    hp_rx_vec[idx]->lock_outer();
+
+    dectnrp_assert(packet_sizes.N_TB_byte <= hp_rx_vec[idx]->get_hb_tb()->a_len,
+                   "packet TB larger than buffer");
+
+    hp_rx_vec[idx]->PLCF_type = PLCF_type;
+    hp_rx_vec[idx]->network_id = network_id;
+    hp_rx_vec[idx]->packet_sizes = packet_sizes;
+    hp_rx_vec[idx]->rv = rv;
+    hp_rx_vec[idx]->finalize_rx = frx;
+    hp_rx_vec[idx]->lock_inner();
+
+    return hp_rx_vec[idx].get();
 };
 
 process_tx_t* process_pool_t::get_process_tx_running(const uint32_t id,
@@ -128,4 +139,31 @@ process_rx_t* process_pool_t::get_process_rx_running(const uint32_t id,
     return hp_rx_vec[id].get();
 }
 
+uint32_t process_pool_t::get_nof_process_tx_in_use() const {
+    return std::count_if(hp_tx_vec.begin(), hp_tx_vec.end(), [](const auto& elem) {
+        return elem->is_outer_locked();
+    });
+}
+
+uint32_t process_pool_t::get_nof_process_rx_in_use() const {
+    return std::count_if(hp_rx_vec.begin(), hp_rx_vec.end(), [](const auto& elem) {
+        return elem->is_outer_locked();
+    });
+}
+
+sp3::packet_sizes_t process_pool_t::get_packet_sizes_verified(
+    const sp3::packet_sizes_def_t& psdef) const {
+    const sp3::packet_sizes_t* packet_sizes = packet_sizes_lut.get_packet_sizes(psdef);
+
+    if (packet_sizes != nullptr) {
+        return *packet_sizes;
+    }
+
+    const auto packet_sizes_opt = sp3::get_packet_sizes(psdef);
+
+    dectnrp_assert(packet_sizes_opt.has_value(), "packets must be well-defined");
+
+    return packet_sizes_opt.value();
+}
+
 }  // namespace dectnrp::phy::harq
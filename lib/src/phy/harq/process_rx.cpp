@@ -20,6 +20,8 @@
 
 #include "dectnrp/phy/harq/process_rx.hpp"
 
+#include "dectnrp/common/prog/assert.hpp"
+
 namespace dectnrp::phy::harq {
 
 process_rx_t::process_rx_t(const uint32_t id_, const sp3::packet_sizes_t maximum_packet_sizes)
@@ -37,17 +39,20 @@ void process_rx_t::finalize(const bool crc_status) {
         using enum finalize_rx_t;
 
         case reset_and_terminate:
-            reset_and_terminate_func();
+            // remove pin of the owner, resets and terminates unless pinned by others
+            unpin_owner();
             break;
 
         case keep_running:
+            dectnrp_assert(!is_pinned_by_others(), "running process must not be pinned");
             unlock_inner();
             break;
 
         case keep_running_or_reset_and_terminate_if_crc_correct:
             if (crc_status) [[likely]] {
-                reset_and_terminate_func();
+                unpin_owner();
             } else [[unlikely]] {
+                dectnrp_assert(!is_pinned_by_others(), "running process must not be pinned");
                 unlock_inner();
             }
             break;
@@ -64,6 +69,12 @@ void process_rx_t::reset_and_terminate_func() {
     process_t::reset();
     process_t::unlock_inner();
     process_t::unlock_outer();
+    process_t::release();
+}
+
+void process_rx_t::unpinned_func() {
+    // may be called by any thread which pinned the process, including the owner
+    reset_and_terminate_func();
 }
 
 }  // namespace dectnrp::phy::harq
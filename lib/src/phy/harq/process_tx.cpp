@@ -98,6 +98,7 @@ void process_tx_t::reset_and_terminate_func() {
     process_t::reset();
     process_t::unlock_inner();
     process_t::unlock_outer();
+    process_t::release();
 }
 
 }  // namespace dectnrp::phy::harq
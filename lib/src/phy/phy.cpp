@@ -21,6 +21,7 @@
 #include "dectnrp/phy/phy.hpp"
 
 #include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/thread/cpu_topology.hpp"
 #include "dectnrp/limits.hpp"
 #include "dectnrp/phy/resample/resampler_param.hpp"
 #include "dectnrp/radio/hw.hpp"
@@ -48,6 +49,9 @@ phy_t::phy_t(const phy_config_t& phy_config_, const radio::radio_t& radio_)
 
         dectnrp_assert(worker_pool_config.id == wp_id, "incorrect ID");
 
+        // with automatic thread placement, buffers are allocated on the NUMA node of the workers
+        const common::cpu_domain_scope_t cpu_domain_scope(worker_pool_config.cpu_domain);
+
         // initialize associated hardware
 
         // thread pool and hardware have the same id
@@ -26,6 +26,7 @@
 #include "dectnrp/common/prog/assert.hpp"
 #include "dectnrp/constants.hpp"
 #include "dectnrp/phy/resample/resampler.hpp"
+#include "dectnrp/phy/tx/tx.hpp"
 
 namespace dectnrp::phy {
 
@@ -175,6 +176,19 @@ phy_config_t::phy_config_t(const std::string directory)
             // add new thread
             worker_pool_config.threads_core_prio_config_tx_rx_vec.push_back(
                 threads_core_prio_config);
+
+            // helper threads of the TX antenna lanes follow their TX/RX thread
+            common::threads_core_prio_config_t lane_helper_config;
+            lane_helper_config.prio_offset = threads_core_prio_config.prio_offset;
+            if (threads_core_prio_config.cpu_core ==
+                common::threads_core_prio_config_t::cpu_core_auto) {
+                lane_helper_config.cpu_core = common::threads_core_prio_config_t::cpu_core_auto;
+            }
+
+            worker_pool_config.threads_core_prio_config_tx_lane_vec.push_back(
+                std::vector<common::threads_core_prio_config_t>(
+                    tx_t::get_nof_lanes(worker_pool_config.maximum_packet_sizes.tm_mode.N_TX) - 1,
+                    lane_helper_config));
         }
 
         worker_pool_config.chestim_mode_lr_default =
@@ -0,0 +1,190 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/phy/pool/elastic.hpp"
+
+#include <algorithm>
+
+#include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/thread/watch.hpp"
+
+namespace dectnrp::phy {
+
+static int64_t get_now_ns() {
+    return common::watch_t::get_elapsed_since_epoch<int64_t, common::nano, common::steady_clock>();
+}
+
+elastic_t::elastic_t(const uint32_t id_,
+                     const uint32_t nof_workers_,
+                     const int64_t latency_up_us_,
+                     const int64_t latency_down_us_,
+                     const int64_t hold_ms_)
+    : id(id_),
+      nof_workers(nof_workers_),
+      latency_up_us(latency_up_us_),
+      latency_down_us(latency_down_us_),
+      hold_ns(hold_ms_ * int64_t{1000000}),
+      nof_workers_active(1) {
+    dectnrp_assert(nof_workers > 0, "no workers");
+    dectnrp_assert(latency_down_us < latency_up_us, "no hysteresis");
+    dectnrp_assert(hold_ns > 0, "hold time must be positive");
+
+    stats.nof_workers_active_max.store(1, std::memory_order_relaxed);
+}
+
+void elastic_t::update_enqueued(const std::size_t nof_jobs) {
+    const uint32_t nof_active = nof_workers_active.load(std::memory_order_acquire);
+    const uint32_t nof_busy = nof_workers_busy.load(std::memory_order_acquire);
+    const uint32_t nof_idle = nof_active > nof_busy ? nof_active - nof_busy : 0;
+
+    // every waiting job that no idle consumer can pick up requires another consumer
+    if (nof_jobs > nof_idle) {
+        scale_up(nof_active + static_cast<uint32_t>(std::min<std::size_t>(
+                                  nof_jobs - nof_idle, nof_workers)));
+    }
+}
+
+void elastic_t::update_processed(const std::size_t nof_jobs, const int64_t latency_us) {
+    if (latency_us > latency_up_us) {
+        scale_up(nof_workers_active.load(std::memory_order_acquire) + 1);
+        return;
+    }
+
+    if (latency_us >= latency_down_us) {
+        no_load_since_ns.store(0, std::memory_order_release);
+        return;
+    }
+
+    scale_down_after_hold(nof_jobs);
+}
+
+void elastic_t::update_idle(const std::size_t nof_jobs) { scale_down_after_hold(nof_jobs); }
+
+void elastic_t::park_while_surplus(const uint32_t worker_id,
+                                   const std::atomic<bool>& keep_running) {
+    uint32_t nof_active = nof_workers_active.load(std::memory_order_acquire);
+
+    while (worker_id >= nof_active && !is_unparked_all.load(std::memory_order_acquire) &&
+           keep_running.load(std::memory_order_acquire)) {
+        // returns once the number of active workers has changed
+        nof_workers_active.wait(nof_active, std::memory_order_acquire);
+        nof_active = nof_workers_active.load(std::memory_order_acquire);
+    }
+}
+
+void elastic_t::unpark_all() {
+    is_unparked_all.store(true, std::memory_order_release);
+    nof_workers_active.store(nof_workers, std::memory_order_release);
+    nof_workers_active.notify_all();
+}
+
+std::vector<std::string> elastic_t::report_start() const {
+    std::vector<std::string> lines;
+
+    std::string str("Elastic " + std::to_string(id));
+    str.append(" nof_workers " + std::to_string(nof_workers));
+    str.append(" latency_up_us " + std::to_string(latency_up_us));
+    str.append(" latency_down_us " + std::to_string(latency_down_us));
+    str.append(" hold_ms " + std::to_string(hold_ns / int64_t{1000000}));
+
+    lines.push_back(str);
+
+    return lines;
+}
+
+std::vector<std::string> elastic_t::report_stop() const {
+    std::vector<std::string> lines;
+
+    std::string str("Elastic " + std::to_string(id));
+    str.append(" scale_up " + std::to_string(stats.scale_up.load(std::memory_order_relaxed)));
+    str.append(" scale_down " + std::to_string(stats.scale_down.load(std::memory_order_relaxed)));
+    str.append(" nof_workers_active_max " +
+               std::to_string(stats.nof_workers_active_max.load(std::memory_order_relaxed)));
+
+    lines.push_back(str);
+
+    return lines;
+}
+
+void elastic_t::scale_up(const uint32_t nof_workers_active_target) {
+    no_load_since_ns.store(0, std::memory_order_release);
+
+    const uint32_t target = std::min(nof_workers_active_target, nof_workers);
+
+    uint32_t nof_active = nof_workers_active.load(std::memory_order_acquire);
+
+    while (nof_active < target) {
+        if (nof_workers_active.compare_exchange_weak(
+                nof_active, target, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            nof_workers_active.notify_all();
+
+            stats.scale_up.fetch_add(1, std::memory_order_relaxed);
+
+            uint32_t nof_active_max = stats.nof_workers_active_max.load(std::memory_order_relaxed);
+            while (nof_active_max < target &&
+                   !stats.nof_workers_active_max.compare_exchange_weak(
+                       nof_active_max, target, std::memory_order_relaxed)) {
+            }
+
+            return;
+        }
+    }
+}
+
+void elastic_t::scale_down_after_hold(const std::size_t nof_jobs) {
+    if (nof_jobs > 0 || is_unparked_all.load(std::memory_order_acquire)) {
+        no_load_since_ns.store(0, std::memory_order_release);
+        return;
+    }
+
+    const int64_t now_ns = get_now_ns();
+
+    int64_t since_ns = no_load_since_ns.load(std::memory_order_acquire);
+
+    // first observation without load starts the hold time
+    if (since_ns == 0) {
+        no_load_since_ns.compare_exchange_strong(since_ns, now_ns, std::memory_order_acq_rel);
+        return;
+    }
+
+    if (now_ns - since_ns < hold_ns) {
+        return;
+    }
+
+    // only one consumer may claim the end of the hold time
+    if (!no_load_since_ns.compare_exchange_strong(since_ns, now_ns, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    uint32_t nof_active = nof_workers_active.load(std::memory_order_acquire);
+
+    if (nof_active > 1 && nof_workers_active.compare_exchange_strong(
+                              nof_active, nof_active - 1, std::memory_order_acq_rel)) {
+        stats.scale_down.fetch_add(1, std::memory_order_relaxed);
+
+        // unpark_all() may have been called after the check above, so undo the decrement
+        if (is_unparked_all.load(std::memory_order_acquire)) {
+            nof_workers_active.store(nof_workers, std::memory_order_release);
+            nof_workers_active.notify_all();
+        }
+    }
+}
+
+}  // namespace dectnrp::phy
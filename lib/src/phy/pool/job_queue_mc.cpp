@@ -51,6 +51,10 @@ bool job_queue_mc_t::enqueue_nto(job_t&& job) {
 
         lockv.unlock();
 
+        if (elastic != nullptr) {
+            elastic->update_enqueued(job_vec.size_approx());
+        }
+
         return true;
     }
 
@@ -58,6 +58,10 @@ bool job_queue_naive_t::enqueue_nto(job_t&& job) {
     }
 #endif
 
+    if (ret && elastic != nullptr) {
+        elastic->update_enqueued(get_nof_jobs());
+    }
+
     return ret;
 }
 
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/phy/pool/elastic.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace dectnrp;
+
+static constexpr uint32_t N_workers{4};
+static constexpr uint32_t N_iterations{200};
+
+/// consumers which do not return within this time are considered deadlocked
+static constexpr auto join_timeout{std::chrono::seconds(5)};
+
+/// mimics the loop of worker_tx_rx_t, every consumer reports no load to scale down quickly
+static void consume(phy::elastic_t& elastic,
+                    const std::atomic<bool>& keep_running,
+                    const uint32_t worker_id,
+                    std::atomic<uint32_t>& nof_returned) {
+    std::mt19937 generator(worker_id);
+    std::uniform_int_distribution<uint32_t> dist(0, 99);
+
+    while (keep_running.load(std::memory_order_acquire)) {
+        elastic.park_while_surplus(worker_id, keep_running);
+
+        // occasional load wakes up parked consumers again
+        if (dist(generator) == 0) {
+            elastic.update_enqueued(N_workers);
+        } else {
+            elastic.update_idle(0);
+        }
+    }
+
+    nof_returned.fetch_add(1, std::memory_order_acq_rel);
+}
+
+/// consumers scale down while the pool is being stopped, all of them must return
+static bool run_scale_down_racing_with_stop(const uint32_t iteration) {
+    // a hold time of zero is not allowed, so 1ms is the fastest scaling down possible
+    phy::elastic_t elastic(0, N_workers, 1000, 100, 1);
+
+    std::atomic<bool> keep_running{true};
+    std::atomic<uint32_t> nof_returned{0};
+
+    elastic.update_enqueued(N_workers);
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < N_workers; ++i) {
+        threads.emplace_back(
+            consume, std::ref(elastic), std::cref(keep_running), i, std::ref(nof_returned));
+    }
+
+    // vary the time of stopping relative to the hold time
+    std::this_thread::sleep_for(std::chrono::microseconds(500 + (iteration % 8) * 250));
+
+    // same order as in worker_pool_t::work_stop()
+    keep_running.store(false, std::memory_order_release);
+    elastic.unpark_all();
+
+    const auto deadline = std::chrono::steady_clock::now() + join_timeout;
+    while (nof_returned.load(std::memory_order_acquire) < N_workers) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            // threads are deadlocked and cannot be joined
+            std::_Exit(EXIT_FAILURE);
+        }
+        std::this_thread::yield();
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return elastic.get_nof_workers_active() != N_workers;
+}
+
+/// after unpark_all(), no report may park a consumer again
+static bool run_no_scale_down_after_unpark_all() {
+    phy::elastic_t elastic(0, N_workers, 1000, 100, 1);
+
+    elastic.update_enqueued(N_workers);
+    elastic.unpark_all();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(20);
+    while (std::chrono::steady_clock::now() < deadline) {
+        elastic.update_idle(0);
+        elastic.update_processed(0, 0);
+    }
+
+    return elastic.get_nof_workers_active() != N_workers;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    bool any_error = false;
+
+    any_error = run_no_scale_down_after_unpark_all() || any_error;
+
+    for (uint32_t i = 0; i < N_iterations; ++i) {
+        any_error = run_scale_down_racing_with_stop(i) || any_error;
+    }
+
+    return any_error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
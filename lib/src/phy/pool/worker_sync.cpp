@@ -25,6 +25,7 @@
 
 #include "dectnrp/common/adt/miscellaneous.hpp"
 #include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/prog/trace.hpp"
 #include "dectnrp/constants.hpp"
 #include "dectnrp/phy/pool/irregular_queue.hpp"
 #include "dectnrp/phy/rx/sync/regular_report.hpp"
@@ -52,6 +53,31 @@ worker_sync_t::worker_sync_t(worker_config_t& worker_config, baton_t& baton_)
         chunk_length_samples * id,
         u8subslot_length_samples * worker_pool_config.rx_chunk_unit_length_u8subslot,
         std::bind(&worker_sync_t::enqueue_irregular_job_if_due, this, std::placeholders::_1));
+
+    const metrics::labels_t labels{{"pool", std::to_string(worker_pool_config.id)},
+                                   {"worker", std::to_string(id)}};
+
+    metrics::register_counter(
+        "phy_sync_job_regular", "regular jobs enqueued", labels, stats.job_regular);
+    metrics::register_counter(
+        "phy_sync_job_packet", "packet jobs enqueued", labels, stats.job_packet);
+    metrics::register_counter("phy_sync_job_packet_not_unique",
+                              "packets detected more than once",
+                              labels,
+                              stats.job_packet_not_unique);
+    metrics::register_counter("phy_sync_job_packet_no_slot",
+                              "packet jobs discarded for lack of a job slot",
+                              labels,
+                              stats.job_packet_no_slot);
+
+    const auto& sc_stats = sync_chunk->get_stats();
+
+    metrics::register_counter(
+        "phy_sync_waitings_for_chunk", "waits for IQ samples", labels, sc_stats.waitings_for_chunk);
+    metrics::register_counter(
+        "phy_sync_detections", "packets detected", labels, sc_stats.detections);
+    metrics::register_counter(
+        "phy_sync_coarse_peaks", "coarse peaks found", labels, sc_stats.coarse_peaks);
 }
 
 void worker_sync_t::work() {
@@ -248,7 +274,7 @@ std::vector<std::string> worker_sync_t::report_stop() const {
 
     // components
 
-    auto sc_stats = sync_chunk->get_stats();
+    const auto& sc_stats = sync_chunk->get_stats();
 
     str.append(" Sync Chunk");
     str.append(" waitings_for_chunk " + std::to_string(sc_stats.waitings_for_chunk));
@@ -320,7 +346,11 @@ void worker_sync_t::enqueue_job_nto(const sync_report_t& sync_report) {
     if (baton.is_sync_time_unique(sync_report.fine_peak_time_64)) {
         ++stats.job_packet;
 
-        job_queue.enqueue_nto(job_t(sync_report));
+        dectnrp_trace_instant(job_enqueue, sync_report.fine_peak_time_64);
+
+        if (!job_queue.enqueue_nto(job_t(sync_report))) {
+            ++stats.job_packet_no_slot;
+        }
     } else {
         ++stats.job_packet_not_unique;
     }
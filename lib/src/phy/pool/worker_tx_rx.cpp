@@ -24,6 +24,7 @@
 
 #include "dectnrp/common/adt/cast.hpp"
 #include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/prog/trace.hpp"
 #include "dectnrp/common/thread/watch.hpp"
 #include "dectnrp/constants.hpp"
 #include "dectnrp/phy/interfaces/maclow_phy.hpp"
@@ -46,10 +47,12 @@ worker_tx_rx_t::worker_tx_rx_t(worker_config_t& worker_config,
     : worker_t(worker_config),
       irregular_queue(worker_config.irregular_queue),
       phy_radio(phy_radio_),
-      json_export(json_export_) {
+      json_export(json_export_),
+      elastic(worker_config.elastic) {
     tx = std::make_unique<tx_t>(worker_pool_config.maximum_packet_sizes,
                                 worker_pool_config.os_min,
-                                worker_pool_config.resampler_param);
+                                worker_pool_config.resampler_param,
+                                worker_pool_config.threads_core_prio_config_tx_lane_vec.at(id));
 
     dectnrp_assert(
         worker_pool_config.resampler_param.hw_samp_rate % constants::u8_subslots_per_sec == 0,
@@ -64,6 +67,38 @@ worker_tx_rx_t::worker_tx_rx_t(worker_config_t& worker_config,
         u8subslot_length_samples * worker_pool_config.rx_chunk_unit_length_u8subslot);
 
     chscanner = std::make_unique<chscanner_t>(buffer_rx);
+
+    // every worker is one shard of each metric
+    const metrics::labels_t labels{{"pool", std::to_string(worker_pool_config.id)},
+                                   {"worker", std::to_string(id)}};
+
+    metrics::register_counter("phy_tx_desc", "TX descriptors", labels, stats.tx_desc);
+    metrics::register_counter(
+        "phy_tx_desc_other_hw", "TX descriptors for other hw", labels, stats.tx_desc_other_hw);
+    metrics::register_counter(
+        "phy_tx_fail_no_buffer", "TX without free buffer", labels, stats.tx_fail_no_buffer);
+    metrics::register_counter("phy_tx_fail_no_buffer_other_hw",
+                              "TX without free buffer for other hw",
+                              labels,
+                              stats.tx_fail_no_buffer_other_hw);
+    metrics::register_counter("phy_tx_sent", "TX packets passed to radio", labels, stats.tx_sent);
+    metrics::register_counter("phy_rx_pcc_success", "PCC decoded", labels, stats.rx_pcc_success);
+    metrics::register_counter("phy_rx_pcc_fail", "PCC not decoded", labels, stats.rx_pcc_fail);
+    metrics::register_counter(
+        "phy_rx_pdc_success", "PDC CRC correct", labels, stats.rx_pdc_success);
+    metrics::register_counter("phy_rx_pdc_fail", "PDC CRC incorrect", labels, stats.rx_pdc_fail);
+    metrics::register_counter(
+        "phy_tpoint_work_regular", "regular firmware calls", labels, stats.tpoint_work_regular);
+    metrics::register_counter("phy_tpoint_work_irregular",
+                              "irregular firmware calls",
+                              labels,
+                              stats.tpoint_work_irregular);
+    metrics::register_counter(
+        "phy_tpoint_work_upper", "application firmware calls", labels, stats.tpoint_work_upper);
+    metrics::register_histogram("phy_rx_pdc_latency_us",
+                                "time from packet beginning until PDC processed by MAC",
+                                labels,
+                                rx_pdc_latency_us);
 }
 
 void worker_tx_rx_t::work() {
@@ -78,11 +113,22 @@ void worker_tx_rx_t::work() {
         watch.reset();
 
         while (!watch.is_elapsed<common::milli>(KEEP_RUNNING_POLL_PERIOD_MS)) {
+            // surplus workers sleep until the load increases
+            if (elastic != nullptr) {
+                elastic->park_while_surplus(id, keep_running);
+            }
+
             // wait for job or check exit condition upon timeout (to)
             if (!job_queue.wait_for_new_job_to(job)) {
+                if (elastic != nullptr) {
+                    elastic->update_idle(job_queue.get_nof_jobs());
+                }
                 continue;
             }
 
+            // reports the job's latency once it leaves the scope
+            const elastic_job_t elastic_job(*this, job);
+
             // different actions for different jobs
             if (std::holds_alternative<regular_report_t>(job.content)) {
                 TOKEN_LOCK_FIFO_OR_RETURN
@@ -108,6 +154,9 @@ void worker_tx_rx_t::work() {
                 ++stats.tpoint_work_irregular;
 
             } else if (std::holds_alternative<sync_report_t>(job.content)) {
+                dectnrp_trace_instant(job_dequeue,
+                                      std::get<sync_report_t>(job.content).fine_peak_time_64);
+
                 /* Internally tries to determine correct PLCF type 1 or 2.
                  *
                  * 1) Demodulate and decode type 1 and 2, and check both CRCs.
@@ -122,8 +171,12 @@ void worker_tx_rx_t::work() {
                  * 2) A packet MUST stay within the packet limits set by the radio device class.
                  * Otherwise, decoding might fail, potentially with an exception.
                  */
+                dectnrp_trace_begin(tsc_pcc);
                 const auto pcc_report =
                     rx_synced->demoddecod_rx_pcc(std::get<sync_report_t>(job.content));
+                dectnrp_trace_end(tsc_pcc,
+                                  demoddecod_rx_pcc,
+                                  std::get<sync_report_t>(job.content).fine_peak_time_64);
 
                 // any PLCF found?
                 if (pcc_report.plcf_decoder.has_any_plcf() == 0) {
@@ -137,7 +190,8 @@ void worker_tx_rx_t::work() {
 
                     run_tx_chscan(machigh_phy.tx_descriptor_vec,
                                   machigh_phy.irregular_report,
-                                  machigh_phy.chscan_opt);
+                                  machigh_phy.chscan_opt,
+                                  phy_maclow.sync_report.fine_peak_time_64);
 #else
                     TOKEN_LOCK_FIFO_OR_RETURN
                     // nothing to do here, but we have to increment the token's internal fifo_cnt
@@ -165,8 +219,13 @@ void worker_tx_rx_t::work() {
                 // compile all reports
                 const phy_maclow_t phy_maclow{std::get<sync_report_t>(job.content), pcc_report};
 
+                dectnrp_trace_begin(tsc_token_pcc);
                 TOKEN_LOCK_FIFO_OR_RETURN
+                dectnrp_trace_end(
+                    tsc_token_pcc, token_wait, phy_maclow.sync_report.fine_peak_time_64);
+                dectnrp_trace_begin(tsc_work_pcc);
                 const maclow_phy_t maclow_phy = tpoint->work_pcc(phy_maclow);
+                dectnrp_trace_end(tsc_work_pcc, work_pcc, phy_maclow.sync_report.fine_peak_time_64);
                 token->unlock_fifo();
 
                 // PDC can be of no interest, for instance, when a device is unknown
@@ -181,7 +240,10 @@ void worker_tx_rx_t::work() {
                 }
 
                 // demodulate and decode PDC for the PCC choice made by lower MAC
+                dectnrp_trace_begin(tsc_pdc);
                 const auto pdc_report = rx_synced->demoddecod_rx_pdc(maclow_phy);
+                dectnrp_trace_end(
+                    tsc_pdc, demoddecod_rx_pdc, phy_maclow.sync_report.fine_peak_time_64);
 
                 // compile all reports
                 const phy_machigh_t phy_machigh{phy_maclow, maclow_phy, pdc_report};
@@ -190,7 +252,11 @@ void worker_tx_rx_t::work() {
                 machigh_phy_t machigh_phy;
 
                 // call MAC regardless of correct or incorrect CRC
+                dectnrp_trace_begin(tsc_token_pdc);
                 token->lock(token_call_id);
+                dectnrp_trace_end(
+                    tsc_token_pdc, token_wait, phy_maclow.sync_report.fine_peak_time_64);
+                dectnrp_trace_begin(tsc_work_pdc);
                 if (pdc_report.crc_status) {
                     ++stats.rx_pdc_success;
                     machigh_phy = tpoint->work_pdc(phy_machigh);
@@ -198,11 +264,17 @@ void worker_tx_rx_t::work() {
                     ++stats.rx_pdc_fail;
                     machigh_phy = tpoint->work_pdc_error(phy_machigh);
                 }
+                dectnrp_trace_end(tsc_work_pdc, work_pdc, phy_maclow.sync_report.fine_peak_time_64);
                 token->unlock();
 
+                rx_pdc_latency_us.observe(
+                    (buffer_rx.get_rx_time_passed() - phy_maclow.sync_report.fine_peak_time_64) *
+                    int64_t{1000000} / static_cast<int64_t>(buffer_rx.samp_rate));
+
                 run_tx_chscan(machigh_phy.tx_descriptor_vec,
                               machigh_phy.irregular_report,
-                              machigh_phy.chscan_opt);
+                              machigh_phy.chscan_opt,
+                              phy_maclow.sync_report.fine_peak_time_64);
 
                 /* Resetting for next RX must be done AFTER transmitting and running channel
                  * measurement, as resetting buffers can be quite time consuming. For instance, a
@@ -252,6 +324,32 @@ void worker_tx_rx_t::work() {
     }
 }
 
+worker_tx_rx_t::elastic_job_t::elastic_job_t(worker_tx_rx_t& worker_tx_rx_, const job_t& job)
+    : worker_tx_rx(worker_tx_rx_),
+      fine_peak_time_64(std::holds_alternative<sync_report_t>(job.content)
+                            ? std::get<sync_report_t>(job.content).fine_peak_time_64
+                            : -1) {
+    if (worker_tx_rx.elastic != nullptr) {
+        worker_tx_rx.elastic->set_busy();
+    }
+}
+
+worker_tx_rx_t::elastic_job_t::~elastic_job_t() {
+    if (worker_tx_rx.elastic == nullptr) {
+        return;
+    }
+
+    worker_tx_rx.elastic->set_not_busy();
+
+    const int64_t latency_us =
+        fine_peak_time_64 < 0
+            ? -1
+            : (worker_tx_rx.buffer_rx.get_rx_time_passed() - fine_peak_time_64) *
+                  int64_t{1000000} / static_cast<int64_t>(worker_tx_rx.buffer_rx.samp_rate);
+
+    worker_tx_rx.elastic->update_processed(worker_tx_rx.job_queue.get_nof_jobs(), latency_us);
+}
+
 std::vector<std::string> worker_tx_rx_t::report_start() const {
     std::vector<std::string> lines;
 
@@ -294,14 +392,19 @@ std::vector<std::string> worker_tx_rx_t::report_stop() const {
 
 void worker_tx_rx_t::run_tx_chscan(const tx_descriptor_vec_t& tx_descriptor_vec,
                                    const irregular_report_t& irregular_report,
-                                   chscan_opt_t& chscan_opt) {
+                                   chscan_opt_t& chscan_opt,
+                                   const int64_t trace_id) {
     // generate packets and pass data to radio layer for transmission
     for (auto& tx_descriptor : tx_descriptor_vec) {
         radio::buffer_tx_t* buffer_tx = nullptr;
 
+        // buffers are sized exactly for the packet
+        const uint32_t N_samples_buffer_tx =
+            tx->get_N_samples_buffer_tx(tx_descriptor.hp_tx.get_packet_sizes());
+
         if (tx_descriptor.hw_id <= tx_descriptor_t::hw_id_associated) {
             // try to get a buffer from associated hw
-            buffer_tx = buffer_tx_pool.get_buffer_tx_to_fill();
+            buffer_tx = buffer_tx_pool.get_buffer_tx_to_fill(N_samples_buffer_tx);
 
             ++stats.tx_desc;
 
@@ -314,7 +417,7 @@ void worker_tx_rx_t::run_tx_chscan(const tx_descriptor_vec_t& tx_descriptor_vec,
         } else {
             // try to get a buffer from another hw
             buffer_tx = phy_radio.radio_ctrl_vec.at(tx_descriptor.hw_id_associated)
-                            .buffer_tx_pool.get_buffer_tx_to_fill();
+                            .buffer_tx_pool.get_buffer_tx_to_fill(N_samples_buffer_tx);
 
             ++stats.tx_desc_other_hw;
 
@@ -325,7 +428,9 @@ void worker_tx_rx_t::run_tx_chscan(const tx_descriptor_vec_t& tx_descriptor_vec,
             }
         }
 
+        dectnrp_trace_begin(tsc_tx);
         tx->generate_tx_packet(tx_descriptor, *buffer_tx);
+        dectnrp_trace_end(tsc_tx, tx_generation, trace_id);
 
         ++stats.tx_sent;
 
@@ -347,8 +452,10 @@ void worker_tx_rx_t::run_tx_chscan(const tx_descriptor_vec_t& tx_descriptor_vec,
         chscan_opt_t chscan_opt_empty = chscan_opt_t{std::nullopt};
 
         // recursive call
-        run_tx_chscan(
-            machigh_phy.tx_descriptor_vec, machigh_phy.irregular_report, chscan_opt_empty);
+        run_tx_chscan(machigh_phy.tx_descriptor_vec,
+                      machigh_phy.irregular_report,
+                      chscan_opt_empty,
+                      trace_id);
     }
 }
 
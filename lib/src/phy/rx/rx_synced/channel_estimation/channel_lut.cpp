@@ -20,47 +20,64 @@
 
 #include "dectnrp/phy/rx/rx_synced/channel_estimation/channel_lut.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <limits>
+#include <map>
+#include <mutex>
 
 extern "C" {
 #include "srsran/phy/utils/vector.h"
 }
 
 #include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/prog/log.hpp"
 #include "dectnrp/sections_part3/drs.hpp"
 #include "dectnrp/sections_part3/physical_resources.hpp"
+#include "header_only/fmt/format.h"
 
 static constexpr uint32_t N_EFF_TX_MAX_PRECALC = 4U;
 
 // for equal weight vectors, we compare real and imaginary part
 static constexpr double PHY_RX_RX_SYNCED_CHANNEL_ESTIMATION_EQUALITY_THRESHOLD = 1e-4;
 
+// must be incremented whenever the generation of tables or the file layout changes
+static constexpr uint32_t CHANNEL_LUT_CACHE_FILE_VERSION = 1U;
+
+// sections of cache files begin at multiples of this alignment
+static constexpr std::size_t CHANNEL_LUT_CACHE_FILE_ALIGNMENT = 64;
+
+#ifdef RX_SYNCED_PARAM_CHANNEL_LUT_CACHE_FILE_PREFIX
+static constexpr const char* CHANNEL_LUT_CACHE_FILE_PREFIX =
+    RX_SYNCED_PARAM_CHANNEL_LUT_CACHE_FILE_PREFIX;
+#else
+static constexpr const char* CHANNEL_LUT_CACHE_FILE_PREFIX = "";
+#endif
+
 namespace dectnrp::phy {
 
 channel_lut_t::channel_lut_t(const uint32_t b_max_,
                              const uint32_t N_eff_TX_max_,
                              const channel_statistics_t channel_statistics_)
+    : channel_lut_t(b_max_, N_eff_TX_max_, channel_statistics_, CHANNEL_LUT_CACHE_FILE_PREFIX) {}
+
+channel_lut_t::channel_lut_t(const uint32_t b_max_,
+                             const uint32_t N_eff_TX_max_,
+                             const channel_statistics_t channel_statistics_,
+                             const std::string& cache_file_prefix)
     : b_max(b_max_),
       N_eff_TX_max(N_eff_TX_max_),
-      channel_statistics(channel_statistics_) {
+      channel_statistics(channel_statistics_),
+      tables(tables_t::get_shared(b_max, N_eff_TX_max, channel_statistics, cache_file_prefix)) {
     // preallocate
     idx_pilot_symb.resize(N_EFF_TX_MAX_PRECALC);
     idx_weights_symb.resize(N_EFF_TX_MAX_PRECALC);
-
-    init_lut_x_vec(0, b_max, channel_statistics, lut_0_vec, lut_0_weight_vecs);
-    init_lut_x_vec(5, b_max, channel_statistics, lut_5_vec, lut_5_weight_vecs);
-
-    // initialize only if necessary
-    if (N_eff_TX_max >= 4) {
-        init_lut_x_vec(10, b_max, channel_statistics, lut_10_vec, lut_10_weight_vecs);
-    }
-}
-
-channel_lut_t::~channel_lut_t() {
-    free(lut_0_weight_vecs);
-    free(lut_5_weight_vecs);
-    free(lut_10_weight_vecs);
 }
 
 void channel_lut_t::set_configuration_packet(const uint32_t b_idx_, const uint32_t N_eff_TX_) {
@@ -71,32 +88,21 @@ void channel_lut_t::set_configuration_packet(const uint32_t b_idx_, const uint32
 void channel_lut_t::set_configuration_ps(const bool chestim_mode_lr, const uint32_t ps_idx_) {
     ps_idx = ps_idx_;
 
-    if (chestim_mode_lr) {
-        if (N_eff_TX <= 2) {
-            // lut_5_vec
-            idx_pilot_effective = lut_5_vec[b_idx].idx_pilot.get();
-            idx_weights_effective = lut_5_vec[b_idx].idx_weights.get();
-            lut_x_weight_vecs_effective = lut_5_weight_vecs;
-        } else {
-            // lut_10_vec
-            idx_pilot_effective = lut_10_vec[b_idx].idx_pilot.get();
-            idx_weights_effective = lut_10_vec[b_idx].idx_weights.get();
-            lut_x_weight_vecs_effective = lut_10_weight_vecs;
-        }
-        nof_drs_subc_interp = channel_statistics.nof_drs_interp_lr;
-    } else {
-        // lut_0_vec
-        idx_pilot_effective = lut_0_vec[b_idx].idx_pilot.get();
-        idx_weights_effective = lut_0_vec[b_idx].idx_weights.get();
-        lut_x_weight_vecs_effective = lut_0_weight_vecs;
-        nof_drs_subc_interp = channel_statistics.nof_drs_interp_l;
-    }
+    // N_step=0, N_step=5 or N_step=10
+    const std::size_t x = chestim_mode_lr ? (N_eff_TX <= 2 ? 1 : 2) : 0;
+
+    dectnrp_assert(b_idx < tables->lut_x_vec[x].size(), "LUT not initialized");
+
+    lut_effective = &tables->lut_x_vec[x][b_idx];
+    lut_x_weight_vecs_effective = tables->lut_x_weight_vecs[x];
+    nof_drs_subc_interp = chestim_mode_lr ? channel_statistics.nof_drs_interp_lr
+                                          : channel_statistics.nof_drs_interp_l;
 }
 
-const std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE*>& channel_lut_t::get_idx_pilot_symb(
+const std::vector<const RX_SYNCED_PARAM_LUT_IDX_TYPE*>& channel_lut_t::get_idx_pilot_symb(
     const uint32_t ofdm_symb_ps_idx) {
     // load in default order
-    idx_pilot_effective->get_stage_prealloc(ofdm_symb_ps_idx, idx_pilot_symb);
+    lut_effective->get_stage_prealloc(lut_effective->idx_pilot, ofdm_symb_ps_idx, idx_pilot_symb);
 
     /* Figure 4.5-2 and 4.5-3
      *
@@ -121,10 +127,11 @@ const std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE*>& channel_lut_t::get_idx_pilot_s
     return idx_pilot_symb;
 }
 
-const std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE*>& channel_lut_t::get_idx_weights_symb(
+const std::vector<const RX_SYNCED_PARAM_LUT_IDX_TYPE*>& channel_lut_t::get_idx_weights_symb(
     const uint32_t ofdm_symb_ps_idx) {
     // load in default order
-    idx_weights_effective->get_stage_prealloc(ofdm_symb_ps_idx, idx_weights_symb);
+    lut_effective->get_stage_prealloc(
+        lut_effective->idx_weights, ofdm_symb_ps_idx, idx_weights_symb);
 
     /* Figure 4.5-2 and 4.5-3
      *
@@ -153,11 +160,11 @@ const RX_SYNCED_PARAM_WEIGHTS_TYPE* channel_lut_t::get_weight_vecs() const {
     return lut_x_weight_vecs_effective;
 }
 
-void channel_lut_t::swap_upper_lower_half(std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE*>& in) {
+void channel_lut_t::swap_upper_lower_half(std::vector<const RX_SYNCED_PARAM_LUT_IDX_TYPE*>& in) {
     dectnrp_assert(in.size() == 4, "incorrect length, should be 4");
 
-    RX_SYNCED_PARAM_LUT_IDX_TYPE* A = in[0];
-    RX_SYNCED_PARAM_LUT_IDX_TYPE* B = in[1];
+    const RX_SYNCED_PARAM_LUT_IDX_TYPE* A = in[0];
+    const RX_SYNCED_PARAM_LUT_IDX_TYPE* B = in[1];
 
     in[0] = in[2];
     in[1] = in[3];
@@ -165,21 +172,342 @@ void channel_lut_t::swap_upper_lower_half(std::vector<RX_SYNCED_PARAM_LUT_IDX_TY
     in[3] = B;
 }
 
+std::size_t channel_lut_t::lut_t::get_len(const uint32_t N_b_OCC_plus_DC,
+                                         const uint32_t ps_t_length) {
+    return std::size_t{N_EFF_TX_MAX_PRECALC} * ps_t_length * N_b_OCC_plus_DC;
+}
+
+void channel_lut_t::lut_t::get_stage_prealloc(
+    const RX_SYNCED_PARAM_LUT_IDX_TYPE* base,
+    const uint32_t t_idx,
+    std::vector<const RX_SYNCED_PARAM_LUT_IDX_TYPE*>& vec) const {
+    dectnrp_assert(t_idx < ps_t_length, "t_idx too large");
+    dectnrp_assert(vec.size() == N_EFF_TX_MAX_PRECALC, "incorrect number of transmit streams");
+
+    for (uint32_t ts_idx = 0; ts_idx < N_EFF_TX_MAX_PRECALC; ++ts_idx) {
+        vec[ts_idx] = &base[(ts_idx * ps_t_length + t_idx) * N_b_OCC_plus_DC];
+    }
+}
+
+namespace {
+
+/// layout of a cache file, all sections begin at multiples of CHANNEL_LUT_CACHE_FILE_ALIGNMENT
+struct cache_file_header_t {
+        char magic[8];
+        uint32_t version;
+        uint32_t sizeof_idx;
+        uint32_t sizeof_weights;
+        uint32_t b_max;
+        uint64_t nof_lut_x;
+        char key[192];
+        uint64_t idx_offset;
+        uint64_t idx_len;
+        uint64_t weight_vecs_offset[3];
+        uint64_t weight_vecs_len[3];
+};
+
+constexpr char cache_file_magic[8] = {'D', 'N', 'R', 'P', 'L', 'U', 'T', '\0'};
+
+constexpr std::size_t align_up(const std::size_t offset) {
+    return (offset + CHANNEL_LUT_CACHE_FILE_ALIGNMENT - 1) / CHANNEL_LUT_CACHE_FILE_ALIGNMENT *
+           CHANNEL_LUT_CACHE_FILE_ALIGNMENT;
+}
+
+}  // namespace
+
+channel_lut_t::tables_t::tables_t(const uint32_t b_max,
+                                  const uint32_t N_eff_TX_max,
+                                  const channel_statistics_t& channel_statistics) {
+    // initialize lut_x_vec[2] only if necessary
+    const std::size_t nof_lut_x = (N_eff_TX_max >= 4) ? 3 : 2;
+
+    idx_storage.resize(get_idx_len(b_max, nof_lut_x));
+
+    RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_base = idx_storage.data();
+    for (std::size_t x = 0; x < nof_lut_x; ++x) {
+        init_lut_x_vec(N_step_virtual_vec[x],
+                       b_max,
+                       channel_statistics,
+                       idx_base,
+                       weight_vecs_storage[x]);
+
+        lut_x_weight_vecs[x] = weight_vecs_storage[x].data();
+
+        idx_base += get_idx_len_lut_x(b_max, x);
+    }
+
+    init_lut_x_vec_pointers(b_max, nof_lut_x, idx_storage.data());
+}
+
+channel_lut_t::tables_t::tables_t(const std::string& filename, const std::string& key) {
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(cache_file_header_t)) {
+        close(fd);
+        return;
+    }
+
+    void* addr = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // mapping remains valid after closing the file descriptor
+    close(fd);
+
+    if (addr == MAP_FAILED) {
+        return;
+    }
+
+    mmap_addr = addr;
+    mmap_len = static_cast<std::size_t>(st.st_size);
+
+    const auto* ptr = static_cast<const uint8_t*>(mmap_addr);
+
+    cache_file_header_t header;
+    std::memcpy(&header, ptr, sizeof(header));
+
+    // file of an older version, for different parameters or of different types
+    if (std::memcmp(header.magic, cache_file_magic, sizeof(cache_file_magic)) != 0 ||
+        header.version != CHANNEL_LUT_CACHE_FILE_VERSION ||
+        header.sizeof_idx != sizeof(RX_SYNCED_PARAM_LUT_IDX_TYPE) ||
+        header.sizeof_weights != sizeof(RX_SYNCED_PARAM_WEIGHTS_TYPE) ||
+        header.nof_lut_x < 2 || 3 < header.nof_lut_x ||
+        std::strncmp(header.key, key.c_str(), sizeof(header.key)) != 0 ||
+        header.idx_len != get_idx_len(header.b_max, header.nof_lut_x)) {
+        return;
+    }
+
+    // truncated file
+    if (mmap_len < header.idx_offset + header.idx_len * sizeof(RX_SYNCED_PARAM_LUT_IDX_TYPE)) {
+        return;
+    }
+    for (std::size_t x = 0; x < header.nof_lut_x; ++x) {
+        if (header.weight_vecs_len[x] == 0 ||
+            mmap_len < header.weight_vecs_offset[x] +
+                           header.weight_vecs_len[x] * sizeof(RX_SYNCED_PARAM_WEIGHTS_TYPE)) {
+            return;
+        }
+    }
+
+    for (std::size_t x = 0; x < header.nof_lut_x; ++x) {
+        lut_x_weight_vecs[x] = reinterpret_cast<const RX_SYNCED_PARAM_WEIGHTS_TYPE*>(
+            ptr + header.weight_vecs_offset[x]);
+    }
+
+    init_lut_x_vec_pointers(
+        header.b_max,
+        header.nof_lut_x,
+        reinterpret_cast<const RX_SYNCED_PARAM_LUT_IDX_TYPE*>(ptr + header.idx_offset));
+}
+
+channel_lut_t::tables_t::~tables_t() {
+    if (mmap_addr != nullptr) {
+        munmap(mmap_addr, mmap_len);
+    }
+}
+
+std::shared_ptr<const channel_lut_t::tables_t> channel_lut_t::tables_t::get_shared(
+    const uint32_t b_max,
+    const uint32_t N_eff_TX_max,
+    const channel_statistics_t& channel_statistics,
+    const std::string& cache_file_prefix) {
+    // tables are released once the last channel_lut_t using them is destroyed
+    static std::mutex mtx;
+    static std::map<std::string, std::weak_ptr<const tables_t>> registry;
+
+    const std::string key = get_key(b_max, N_eff_TX_max, channel_statistics);
+
+    // hold lock while generating so that identical tables are never generated twice
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (auto tables = registry[key].lock()) {
+        return tables;
+    }
+
+    std::shared_ptr<const tables_t> tables;
+
+    if (cache_file_prefix.empty()) {
+        tables = std::make_shared<const tables_t>(b_max, N_eff_TX_max, channel_statistics);
+    } else {
+        const std::string filename = cache_file_prefix + key + ".bin";
+
+        tables = std::make_shared<const tables_t>(filename, key);
+
+        if (!tables->is_valid()) {
+            dectnrp_log_inf("Channel LUT cache file {} unavailable, generating", filename);
+
+            auto tables_new =
+                std::make_shared<const tables_t>(b_max, N_eff_TX_max, channel_statistics);
+
+            if (!tables_new->save(filename, key)) {
+                dectnrp_log_wrn("Unable to write channel LUT cache file {}", filename);
+            }
+
+            tables = tables_new;
+        }
+    }
+
+    registry[key] = tables;
+
+    return tables;
+}
+
+bool channel_lut_t::tables_t::save(const std::string& filename, const std::string& key) const {
+    dectnrp_assert(is_valid(), "tables not initialized");
+    dectnrp_assert(key.size() < sizeof(cache_file_header_t::key), "key too long");
+
+    const std::size_t nof_lut_x = lut_x_vec[2].empty() ? 2 : 3;
+
+    cache_file_header_t header{};
+    std::memcpy(header.magic, cache_file_magic, sizeof(cache_file_magic));
+    header.version = CHANNEL_LUT_CACHE_FILE_VERSION;
+    header.sizeof_idx = sizeof(RX_SYNCED_PARAM_LUT_IDX_TYPE);
+    header.sizeof_weights = sizeof(RX_SYNCED_PARAM_WEIGHTS_TYPE);
+    header.b_max = sp3::phyres::b_idx2b[lut_x_vec[0].size() - 1];
+    header.nof_lut_x = nof_lut_x;
+    std::strncpy(header.key, key.c_str(), sizeof(header.key) - 1);
+
+    header.idx_offset = align_up(sizeof(header));
+    header.idx_len = idx_storage.size();
+
+    std::size_t offset = header.idx_offset + header.idx_len * sizeof(RX_SYNCED_PARAM_LUT_IDX_TYPE);
+    for (std::size_t x = 0; x < nof_lut_x; ++x) {
+        header.weight_vecs_offset[x] = align_up(offset);
+        header.weight_vecs_len[x] = weight_vecs_storage[x].size();
+        offset = header.weight_vecs_offset[x] +
+                 header.weight_vecs_len[x] * sizeof(RX_SYNCED_PARAM_WEIGHTS_TYPE);
+    }
+
+    // write to temporary file first, other processes must never map a partially written file
+    const std::string filename_tmp = filename + ".tmp" + std::to_string(getpid());
+
+    std::ofstream f(filename_tmp, std::ios::binary | std::ios::trunc);
+    if (!f.is_open()) {
+        return false;
+    }
+
+    const auto write_at = [&f](const std::size_t pos, const void* data, const std::size_t len) {
+        // pad with zeros up to the section offset
+        while (static_cast<std::size_t>(f.tellp()) < pos) {
+            f.put('\0');
+        }
+        f.write(static_cast<const char*>(data), static_cast<std::streamsize>(len));
+    };
+
+    write_at(0, &header, sizeof(header));
+    write_at(header.idx_offset,
+             idx_storage.data(),
+             idx_storage.size() * sizeof(RX_SYNCED_PARAM_LUT_IDX_TYPE));
+    for (std::size_t x = 0; x < nof_lut_x; ++x) {
+        write_at(header.weight_vecs_offset[x],
+                 weight_vecs_storage[x].data(),
+                 weight_vecs_storage[x].size() * sizeof(RX_SYNCED_PARAM_WEIGHTS_TYPE));
+    }
+
+    f.close();
+
+    if (!f.good() || std::rename(filename_tmp.c_str(), filename.c_str()) != 0) {
+        std::remove(filename_tmp.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void channel_lut_t::tables_t::init_lut_x_vec_pointers(const uint32_t b_max,
+                                                      const std::size_t nof_lut_x,
+                                                      const RX_SYNCED_PARAM_LUT_IDX_TYPE* base) {
+    // same order as in init_lut_x_vec(), pilot indices followed by weight indices for every b
+    for (std::size_t x = 0; x < nof_lut_x; ++x) {
+        const uint32_t ps_t_length = N_step_virtual_vec[x] + 1;
+
+        for (uint32_t b_idx = 0; b_idx <= sp3::phyres::b2b_idx[b_max]; ++b_idx) {
+            const uint32_t N_b_OCC_plus_DC = sp3::phyres::N_b_OCC_plus_DC_lut[b_idx];
+            const std::size_t len = lut_t::get_len(N_b_OCC_plus_DC, ps_t_length);
+
+            lut_x_vec[x].push_back(lut_t(N_b_OCC_plus_DC, ps_t_length, base, base + len));
+
+            base += 2 * len;
+        }
+    }
+}
+
+std::size_t channel_lut_t::tables_t::get_idx_len_lut_x(const uint32_t b_max, const std::size_t x) {
+    std::size_t len = 0;
+
+    for (uint32_t b_idx = 0; b_idx <= sp3::phyres::b2b_idx[b_max]; ++b_idx) {
+        len += 2 * lut_t::get_len(sp3::phyres::N_b_OCC_plus_DC_lut[b_idx],
+                                  N_step_virtual_vec[x] + 1);
+    }
+
+    return len;
+}
+
+std::size_t channel_lut_t::tables_t::get_idx_len(const uint32_t b_max,
+                                                 const std::size_t nof_lut_x) {
+    std::size_t len = 0;
+
+    for (std::size_t x = 0; x < nof_lut_x; ++x) {
+        len += get_idx_len_lut_x(b_max, x);
+    }
+
+    return len;
+}
+
+std::string channel_lut_t::tables_t::get_key(const uint32_t b_max,
+                                             const uint32_t N_eff_TX_max,
+                                             const channel_statistics_t& channel_statistics) {
+    // generation depends on the optimization flags
+#ifdef RX_SYNCED_PARAM_CHANNEL_LUT_OPT_INDEX_PREVIOUS
+    constexpr uint32_t opt_index_previous = 1;
+#else
+    constexpr uint32_t opt_index_previous = 0;
+#endif
+
+#ifdef RX_SYNCED_PARAM_CHANNEL_LUT_SEARCH_ABORT_THRESHOLD
+    constexpr double search_abort_threshold = RX_SYNCED_PARAM_CHANNEL_LUT_SEARCH_ABORT_THRESHOLD;
+#else
+    constexpr double search_abort_threshold = 0.0;
+#endif
+
+    return fmt::format("b{}_x{}_df{:.0f}_T{:.6e}_nu{:.6e}_tau{:.6e}_snr{:.6e}_lr{}_l{}_o{}_s{:.3f}",
+                       b_max,
+                       (N_eff_TX_max >= 4) ? 3 : 2,
+                       channel_statistics.delta_u_f,
+                       channel_statistics.T_u_symb,
+                       channel_statistics.nu_max_hz,
+                       channel_statistics.tau_rms_sec,
+                       channel_statistics.snr_db,
+                       channel_statistics.nof_drs_interp_lr,
+                       channel_statistics.nof_drs_interp_l,
+                       opt_index_previous,
+                       search_abort_threshold);
+}
+
 void channel_lut_t::init_lut_x_vec(const uint32_t N_step_virtual,
                                    const uint32_t b_max,
                                    const channel_statistics_t& channel_statistics,
-                                   std::vector<lut_t>& lut_x_vec,
-                                   RX_SYNCED_PARAM_WEIGHTS_TYPE*& lut_x_weight_vecs) {
+                                   RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_base,
+                                   std::vector<RX_SYNCED_PARAM_WEIGHTS_TYPE>& lut_x_weight_vecs) {
     // How long is the processing stage in time domain?
     const uint32_t ps_t_length = N_step_virtual + 1;
 
     // convert to maximum index of b
     const uint32_t b_idx_max = sp3::phyres::b2b_idx[b_max];
 
-    // first init sizes for every value of b
+    // first determine memory of every value of b, pilot indices followed by weight indices
+    std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE*> idx_pilot_vec;
+    std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE*> idx_weights_vec;
     for (uint32_t b_idx = 0; b_idx <= b_idx_max; ++b_idx) {
-        lut_x_vec.push_back(
-            lut_t(sp3::phyres::N_b_OCC_plus_DC_lut[b_idx], ps_t_length, N_EFF_TX_MAX_PRECALC));
+        const std::size_t len =
+            lut_t::get_len(sp3::phyres::N_b_OCC_plus_DC_lut[b_idx], ps_t_length);
+
+        idx_pilot_vec.push_back(idx_base);
+        idx_weights_vec.push_back(idx_base + len);
+
+        idx_base += 2 * len;
     }
 
     /* When we create every weight vector for the maximum value of b, there is no need for new
@@ -200,8 +528,8 @@ void channel_lut_t::init_lut_x_vec(const uint32_t N_step_virtual,
         init_lut(N_step_virtual,
                  b,
                  channel_statistics,
-                 *(lut_x_vec[b_idx].idx_pilot.get()),
-                 *(lut_x_vec[b_idx].idx_weights.get()),
+                 idx_pilot_vec[b_idx],
+                 idx_weights_vec[b_idx],
                  weight_vecs_tmp);
 
         if (static_cast<uint32_t>(b_idx) < b_idx_max) {
@@ -216,11 +544,7 @@ void channel_lut_t::init_lut_x_vec(const uint32_t N_step_virtual,
     const uint32_t nof_drs_subc_interp = weight_vecs_tmp[0].size();
 
     // allocate memory
-#if RX_SYNCED_PARAM_WEIGHTS_TYPE_CHOICE == RX_SYNCED_PARAM_WEIGHTS_TYPE_REAL
-    lut_x_weight_vecs = srsran_vec_f_malloc(weight_vecs_tmp.size() * nof_drs_subc_interp);
-#elif RX_SYNCED_PARAM_WEIGHTS_TYPE_CHOICE == RX_SYNCED_PARAM_WEIGHTS_TYPE_COMP
-    lut_x_weight_vecs = srsran_vec_cf_malloc(weight_vecs_tmp.size() * nof_drs_subc_interp);
-#endif
+    lut_x_weight_vecs.resize(weight_vecs_tmp.size() * nof_drs_subc_interp);
 
     // copy into memory block
     for (uint32_t i = 0; i < weight_vecs_tmp.size(); ++i) {
@@ -233,16 +557,12 @@ void channel_lut_t::init_lut_x_vec(const uint32_t N_step_virtual,
 void channel_lut_t::init_lut(const uint32_t N_step_virtual,
                              const uint32_t b,
                              const channel_statistics_t& channel_statistics,
-                             processing_stage_t<RX_SYNCED_PARAM_LUT_IDX_TYPE>& idx_pilot,
-                             processing_stage_t<RX_SYNCED_PARAM_LUT_IDX_TYPE>& idx_weights,
+                             RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_pilot,
+                             RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_weights,
                              common::vec2d<RX_SYNCED_PARAM_WEIGHTS_TYPE>& weight_vecs_tmp) {
-    // get dimensions of processing stages
-    const uint32_t ps_t_length = idx_pilot.N_t_domain_max;
-    const uint32_t N_b_OCC_plus_DC = idx_pilot.N_f_domain_max;
-
-    // set processing stage configuration for current value of b
-    idx_pilot.set_configuration(N_b_OCC_plus_DC, ps_t_length);
-    idx_weights.set_configuration(N_b_OCC_plus_DC, ps_t_length);
+    // dimensions of processing stages
+    const uint32_t ps_t_length = N_step_virtual + 1;
+    const uint32_t N_b_OCC_plus_DC = sp3::phyres::N_b_OCC_plus_DC_lut[sp3::phyres::b2b_idx[b]];
 
     // generate DRS symbols for all values of b and all TS
     sp3::drs_t drs(b, N_EFF_TX_MAX_PRECALC);
@@ -299,10 +619,9 @@ void channel_lut_t::init_lut(const uint32_t N_step_virtual,
              * Figure 4.5-2 and Figure 4.5-3 the first OFDM symbol index with DRS pilots is t=1,
              * we start filling the processing stage at symbol index 0.
              */
-            RX_SYNCED_PARAM_LUT_IDX_TYPE* wp_idx_pilot =
-                idx_pilot.get_stage_specific(t - 1, ts_idx);
-            RX_SYNCED_PARAM_LUT_IDX_TYPE* wp_idx_weights =
-                idx_weights.get_stage_specific(t - 1, ts_idx);
+            const std::size_t offset = (ts_idx * ps_t_length + t - 1) * N_b_OCC_plus_DC;
+            RX_SYNCED_PARAM_LUT_IDX_TYPE* wp_idx_pilot = &idx_pilot[offset];
+            RX_SYNCED_PARAM_LUT_IDX_TYPE* wp_idx_weights = &idx_weights[offset];
 
             /* Within an OFDM symbol, the optimal index is monotonically increasing. So for any
              * subcarrier, we can efficiently start our search at the optimal index of the last
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/phy/rx/rx_synced/channel_estimation/channel_lut.hpp"
+#include "dectnrp/phy/rx/rx_synced/rx_synced_param.hpp"
+#include "dectnrp/sections_part3/numerologies.hpp"
+#include "dectnrp/sections_part3/physical_resources.hpp"
+
+using namespace dectnrp;
+
+static constexpr uint32_t b_max = 2;
+static constexpr uint32_t N_eff_TX_max = 4;
+
+/// every index and the bit pattern of every weight read by rx_synced_t, for all configurations
+static std::vector<uint32_t> get_lut_content(phy::channel_lut_t& channel_lut) {
+    std::vector<uint32_t> content;
+
+    for (uint32_t b_idx = 0; b_idx <= sp3::phyres::b2b_idx[b_max]; ++b_idx) {
+        const uint32_t N_b_OCC_plus_DC = sp3::phyres::N_b_OCC_plus_DC_lut[b_idx];
+
+        // N_step=0, N_step=5 and N_step=10
+        for (const uint32_t N_eff_TX : {1, 4}) {
+            for (const bool chestim_mode_lr : {false, true}) {
+                channel_lut.set_configuration_packet(b_idx, N_eff_TX);
+                channel_lut.set_configuration_ps(chestim_mode_lr, 0);
+
+                const uint32_t ps_t_length = chestim_mode_lr ? (N_eff_TX <= 2 ? 6 : 11) : 1;
+                const uint32_t nof_drs_subc_interp = channel_lut.get_nof_drs_subc_interp();
+                const RX_SYNCED_PARAM_WEIGHTS_TYPE* weight_vecs = channel_lut.get_weight_vecs();
+
+                for (uint32_t t_idx = 0; t_idx < ps_t_length; ++t_idx) {
+                    const auto& idx_pilot = channel_lut.get_idx_pilot_symb(t_idx);
+                    const auto& idx_weights = channel_lut.get_idx_weights_symb(t_idx);
+
+                    for (uint32_t ts_idx = 0; ts_idx < N_eff_TX_max; ++ts_idx) {
+                        for (uint32_t i = 0; i < N_b_OCC_plus_DC; ++i) {
+                            content.push_back(idx_pilot[ts_idx][i]);
+                            content.push_back(idx_weights[ts_idx][i]);
+
+                            const RX_SYNCED_PARAM_WEIGHTS_TYPE* weights =
+                                &weight_vecs[idx_weights[ts_idx][i] * nof_drs_subc_interp];
+
+                            const std::size_t offset = content.size();
+                            content.resize(offset + sizeof(RX_SYNCED_PARAM_WEIGHTS_TYPE) *
+                                                        nof_drs_subc_interp / sizeof(uint32_t));
+                            std::memcpy(&content[offset],
+                                        weights,
+                                        sizeof(RX_SYNCED_PARAM_WEIGHTS_TYPE) * nof_drs_subc_interp);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return content;
+}
+
+static bool test_cache_file(const std::string& cache_file_prefix) {
+    const auto numerology = sp3::get_numerologies(1, 1);
+
+    const std::vector<double> V0 = RX_SYNCED_PARAM_NU_MAX_HZ_VEC;
+    const std::vector<double> V1 = RX_SYNCED_PARAM_TAU_RMS_SEC_VEC;
+    const std::vector<double> V2 = RX_SYNCED_PARAM_SNR_DB_VEC;
+    const std::vector<uint32_t> V3 = RX_SYNCED_PARAM_NOF_DRS_INTERP_LR_VEC;
+    const std::vector<uint32_t> V4 = RX_SYNCED_PARAM_NOF_DRS_INTERP_L_VEC;
+
+    const phy::channel_statistics_t chst(
+        numerology.delta_u_f, numerology.T_u_symb, V0[0], V1[0], V2[0], V3[0], V4[0]);
+
+    bool any_error = false;
+
+    // tables are shared while any instance is alive, so every instance is destroyed before the next
+    std::vector<uint32_t> content_generated;
+    {
+        phy::channel_lut_t channel_lut(b_max, N_eff_TX_max, chst, "");
+        any_error |= channel_lut.is_mapped();
+        content_generated = get_lut_content(channel_lut);
+    }
+
+    // no cache file yet, so the tables are generated and saved
+    {
+        phy::channel_lut_t channel_lut(b_max, N_eff_TX_max, chst, cache_file_prefix);
+        any_error |= channel_lut.is_mapped();
+        any_error |= get_lut_content(channel_lut) != content_generated;
+    }
+
+    // cache file is mapped and must be equal to the generated tables bit for bit
+    {
+        phy::channel_lut_t channel_lut(b_max, N_eff_TX_max, chst, cache_file_prefix);
+        if (!channel_lut.is_mapped()) {
+            dectnrp_print_wrn("cache file not mapped");
+            return true;
+        }
+        any_error |= get_lut_content(channel_lut) != content_generated;
+    }
+
+    return any_error;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() /
+                                      ("dectnrp_channel_lut_" + std::to_string(getpid()));
+
+    std::filesystem::create_directories(dir);
+
+    const bool any_error = test_cache_file(dir.string() + "/");
+
+    std::filesystem::remove_all(dir);
+
+    if (any_error) {
+        dectnrp_print_wrn("channel LUT loaded from cache file differs from generated one");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
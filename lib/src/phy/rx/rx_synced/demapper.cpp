@@ -0,0 +1,189 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/phy/rx/rx_synced/demapper.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+#include "dectnrp/common/adt/decibels.hpp"
+#include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/phy/phy_config.hpp"
+#include "dectnrp/phy/rx/rx_synced/rx_synced_param.hpp"
+
+namespace dectnrp::phy::demapper {
+
+float get_llr_scale(const uint32_t N_bps, const float snr_dB) {
+    // same fixed-point scales as srsran's 16 bit demapper, extended to 1024-QAM
+    float scale = 0.0f;
+    switch (N_bps) {
+        case 1:
+        case 2:
+            scale = 100.0f;
+            break;
+        case 4:
+            scale = 400.0f;
+            break;
+        case 6:
+            scale = 700.0f;
+            break;
+        case 8:
+            scale = 1000.0f;
+            break;
+        case 10:
+            scale = 1300.0f;
+            break;
+        default:
+            dectnrp_assert_failure("N_bps {} not supported", N_bps);
+            break;
+    }
+
+#if PHY_LLR_BIT_WIDTH == 8
+    // keep the largest regular LLRs within the range of int8_t
+    scale /= 8.0f;
+#endif
+
+    // LLRs are proportional to the SNR, but are never increased beyond the base scale
+    const float snr_factor =
+        common::adt::db2pow(snr_dB - RX_SYNCED_PARAM_DEMAPPER_SNR_DB_FULL_SCALE);
+
+    return scale * std::clamp(snr_factor, RX_SYNCED_PARAM_DEMAPPER_SCALE_MIN, 1.0f);
+}
+
+/// demap B consecutive cells, all LLRs of the block are stored contiguously before conversion
+template <uint32_t N_bps, uint32_t B, typename T>
+static inline void demap_block(const float* __restrict s_f,
+                               const float scale,
+                               const float d,
+                               const uint8_t* __restrict c,
+                               T* __restrict llr) {
+    // per dimension, a square QAM uses N_bps/2 bits
+    constexpr uint32_t N_bpd = N_bps / 2;
+
+    constexpr float llr_min = static_cast<float>(std::numeric_limits<T>::min());
+    constexpr float llr_max = static_cast<float>(std::numeric_limits<T>::max());
+
+    float l[B * N_bps];
+
+    for (uint32_t i = 0; i < B; ++i) {
+        const float y_re = scale * s_f[2 * i];
+        const float y_im = scale * s_f[2 * i + 1];
+
+        float* l_i = &l[i * N_bps];
+
+        if constexpr (N_bps == 1) {
+            l_i[0] = -(y_re + y_im) / std::numbers::sqrt2_v<float>;
+        } else {
+            l_i[0] = -y_re;
+            l_i[1] = -y_im;
+
+            // each further bit splits the previous decision region in half
+            for (uint32_t k = 1; k < N_bpd; ++k) {
+                const float threshold = static_cast<float>(1U << (N_bpd - k)) * d;
+                l_i[2 * k] = std::abs(l_i[2 * k - 2]) - threshold;
+                l_i[2 * k + 1] = std::abs(l_i[2 * k - 1]) - threshold;
+            }
+        }
+    }
+
+    // descramble by flipping the sign wherever the scrambling bit is one, then saturate
+    for (uint32_t j = 0; j < B * N_bps; ++j) {
+        const float l_j = c[j] != 0 ? -l[j] : l[j];
+        llr[j] = static_cast<T>(std::clamp(l_j, llr_min, llr_max));
+    }
+}
+
+template <uint32_t N_bps, typename T>
+static void demap_and_descramble_N_bps(const cf_t* symbols,
+                                       const float scale,
+                                       const uint8_t* c,
+                                       T* llr,
+                                       const uint32_t nof_symbols) {
+    // cells per block
+    constexpr uint32_t B = 32;
+
+    // average energy of a square QAM with amplitudes +-1, +-3, ... is 2*(M-1)/3
+    constexpr float norm = 2.0f * static_cast<float>((1U << N_bps) - 1U) / 3.0f;
+
+    // distance between two neighbouring amplitudes is 2*d
+    const float d = scale / std::sqrt(norm);
+
+    const float* s_f = reinterpret_cast<const float*>(symbols);
+
+    uint32_t i = 0;
+    for (; i + B <= nof_symbols; i += B) {
+        demap_block<N_bps, B>(&s_f[2 * i], scale, d, &c[i * N_bps], &llr[i * N_bps]);
+    }
+
+    // remaining cells
+    for (; i < nof_symbols; ++i) {
+        demap_block<N_bps, 1>(&s_f[2 * i], scale, d, &c[i * N_bps], &llr[i * N_bps]);
+    }
+}
+
+template <typename T>
+void demap_and_descramble(const uint32_t N_bps,
+                          const cf_t* symbols,
+                          const float scale,
+                          const uint8_t* c,
+                          T* llr,
+                          const uint32_t nof_symbols) {
+    switch (N_bps) {
+        case 1:
+            demap_and_descramble_N_bps<1>(symbols, scale, c, llr, nof_symbols);
+            break;
+        case 2:
+            demap_and_descramble_N_bps<2>(symbols, scale, c, llr, nof_symbols);
+            break;
+        case 4:
+            demap_and_descramble_N_bps<4>(symbols, scale, c, llr, nof_symbols);
+            break;
+        case 6:
+            demap_and_descramble_N_bps<6>(symbols, scale, c, llr, nof_symbols);
+            break;
+        case 8:
+            demap_and_descramble_N_bps<8>(symbols, scale, c, llr, nof_symbols);
+            break;
+        case 10:
+            demap_and_descramble_N_bps<10>(symbols, scale, c, llr, nof_symbols);
+            break;
+        default:
+            dectnrp_assert_failure("N_bps {} not supported", N_bps);
+            break;
+    }
+}
+
+template void demap_and_descramble<int16_t>(const uint32_t N_bps,
+                                            const cf_t* symbols,
+                                            const float scale,
+                                            const uint8_t* c,
+                                            int16_t* llr,
+                                            const uint32_t nof_symbols);
+
+template void demap_and_descramble<int8_t>(const uint32_t N_bps,
+                                           const cf_t* symbols,
+                                           const float scale,
+                                           const uint8_t* c,
+                                           int8_t* llr,
+                                           const uint32_t nof_symbols);
+
+}  // namespace dectnrp::phy::demapper
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/phy/rx/rx_synced/dispersion/dispersion_csi.hpp"
+
+namespace dectnrp::phy {
+
+void dispersion_csi_t::update_from_phy(const dispersion_report_t& dispersion_report) {
+    if (dispersion_report.has_tau_rms()) {
+        dispersion.tau_rms_sec =
+            dispersion.has_tau_rms()
+                ? alpha * dispersion_report.tau_rms_sec + (1.0f - alpha) * dispersion.tau_rms_sec
+                : dispersion_report.tau_rms_sec;
+    }
+
+    if (dispersion_report.has_nu_max()) {
+        dispersion.nu_max_hz =
+            dispersion.has_nu_max()
+                ? alpha * dispersion_report.nu_max_hz + (1.0f - alpha) * dispersion.nu_max_hz
+                : dispersion_report.nu_max_hz;
+    }
+}
+
+}  // namespace dectnrp::phy
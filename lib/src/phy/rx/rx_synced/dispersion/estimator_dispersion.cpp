@@ -0,0 +1,165 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/phy/rx/rx_synced/dispersion/estimator_dispersion.hpp"
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+
+extern "C" {
+#include "srsran/phy/utils/vector.h"
+}
+
+#include "dectnrp/common/adt/decibels.hpp"
+#include "dectnrp/sections_part3/drs.hpp"
+#include "dectnrp/sections_part3/numerologies.hpp"
+
+namespace dectnrp::phy {
+
+/// lower limit of any correlation coefficient to keep the inversions finite
+static constexpr float rho_min{0.05f};
+
+/// J0(x) is inverted with 1-x^2/4, the argument is limited to the first zero of J0
+static constexpr float jakes_x_max{2.4f};
+
+estimator_dispersion_t::estimator_dispersion_t(const uint32_t b_max, const uint32_t N_RX_)
+    : estimator_t(),
+      N_RX(N_RX_) {
+    for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
+        chestim_drs_zf_previous.push_back(
+            srsran_vec_cf_malloc(sp3::drs_t::get_nof_drs_subc(b_max)));
+    }
+
+    P_previous.resize(N_RX);
+}
+
+estimator_dispersion_t::~estimator_dispersion_t() {
+    for (auto& elem : chestim_drs_zf_previous) {
+        free(elem);
+    }
+}
+
+void estimator_dispersion_t::set_numerology(const uint32_t u, const uint32_t b) {
+    const auto numerologies = sp3::get_numerologies(u, b);
+
+    delta_u_f = static_cast<double>(numerologies.delta_u_f);
+    T_u_symb = numerologies.T_u_symb;
+}
+
+void estimator_dispersion_t::process_stf(
+    [[maybe_unused]] const channel_antennas_t& channel_antennas,
+    [[maybe_unused]] const process_stf_meta_t& process_stf_meta) {}
+
+void estimator_dispersion_t::process_drs(const channel_antennas_t& channel_antennas,
+                                         const process_drs_meta_t& process_drs_meta) {
+    // only OFDM symbols with DRS cells of transmit stream 0 are used
+    if (process_drs_meta.TS_idx_first != 0) {
+        return;
+    }
+
+    const uint32_t nof_pairs = N_DRS_cells_b - 1;
+
+    // go over each RX antenna
+    for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
+        const cf_t* chestim_drs_zf = channel_antennas[ant_idx]->get_chestim_drs_zf(0);
+
+        lv_32fc_t P;
+        volk_32fc_x2_conjugate_dot_prod_32fc(
+            &P, (const lv_32fc_t*)chestim_drs_zf, (const lv_32fc_t*)chestim_drs_zf, N_DRS_cells_b);
+
+        // neighbouring pilots, four subcarriers apart
+        lv_32fc_t R;
+        volk_32fc_x2_conjugate_dot_prod_32fc(&R,
+                                             (const lv_32fc_t*)&chestim_drs_zf[1],
+                                             (const lv_32fc_t*)chestim_drs_zf,
+                                             nof_pairs);
+
+        acc_f.R_sum += std::abs(R);
+        acc_f.R_cnt += nof_pairs;
+        acc_f.P_sum += P.real();
+        acc_f.P_cnt += N_DRS_cells_b;
+
+        // pilots with the same index, N_step symbols and two subcarriers apart
+        if (has_previous) {
+            volk_32fc_x2_conjugate_dot_prod_32fc(&R,
+                                                 (const lv_32fc_t*)chestim_drs_zf,
+                                                 (const lv_32fc_t*)chestim_drs_zf_previous[ant_idx],
+                                                 N_DRS_cells_b);
+
+            acc_t.R_sum += std::abs(R);
+            acc_t.R_cnt += N_DRS_cells_b;
+            acc_t.P_sum += (P.real() + P_previous[ant_idx]) / 2.0f;
+            acc_t.P_cnt += N_DRS_cells_b;
+        }
+
+        srsran_vec_cf_copy(chestim_drs_zf_previous[ant_idx], chestim_drs_zf, N_DRS_cells_b);
+        P_previous[ant_idx] = P.real();
+    }
+
+    has_previous = true;
+}
+
+dispersion_report_t estimator_dispersion_t::get_dispersion_report(const float snr_dB) const {
+    if (acc_f.R_cnt == 0 || acc_f.P_sum <= 0.0f) {
+        return dispersion_report_t();
+    }
+
+    // share of signal power in the received power
+    const float snr = common::adt::db2pow(snr_dB);
+    const float S_share = snr / (1.0f + snr);
+
+    const float S_f = acc_f.P_sum / static_cast<float>(acc_f.P_cnt) * S_share;
+    const float rho_f =
+        std::clamp(acc_f.R_sum / static_cast<float>(acc_f.R_cnt) / S_f, rho_min, 1.0f);
+
+    // |r_f(4 * delta_u_f)| = 1 / sqrt(1 + (2 * pi * tau_rms * 4 * delta_u_f)^2)
+    const float two_pi_delta_f = 2.0f * static_cast<float>(M_PI) * static_cast<float>(delta_u_f);
+    const float tau_rms_sec = std::sqrt(1.0f / (rho_f * rho_f) - 1.0f) / (4.0f * two_pi_delta_f);
+
+    if (acc_t.R_cnt == 0 || acc_t.P_sum <= 0.0f) {
+        return dispersion_report_t(tau_rms_sec, -1.0f);
+    }
+
+    // remove frequency correlation at two subcarriers
+    const float rho_f_2 =
+        1.0f / std::sqrt(1.0f + std::pow(2.0f * two_pi_delta_f * tau_rms_sec, 2.0f));
+
+    const float S_t = acc_t.P_sum / static_cast<float>(acc_t.P_cnt) * S_share;
+    const float rho_t =
+        std::clamp(acc_t.R_sum / static_cast<float>(acc_t.R_cnt) / S_t / rho_f_2, rho_min, 1.0f);
+
+    // J0(2 * pi * nu_max * delta_t) ~ 1 - x^2/4
+    const float x = std::min(2.0f * std::sqrt(1.0f - rho_t), jakes_x_max);
+    const float delta_t = static_cast<float>(sp3::drs_t::get_N_step(N_eff_TX) * T_u_symb);
+    const float nu_max_hz = x / (2.0f * static_cast<float>(M_PI) * delta_t);
+
+    return dispersion_report_t(tau_rms_sec, nu_max_hz);
+}
+
+void estimator_dispersion_t::reset_internal() {
+    acc_f = corr_acc_t();
+    acc_t = corr_acc_t();
+    has_previous = false;
+}
+
+}  // namespace dectnrp::phy
@@ -0,0 +1,222 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/phy/rx/rx_synced/dispersion/estimator_dispersion.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/phy/rx/rx_synced/dispersion/dispersion_csi.hpp"
+#include "dectnrp/sections_part3/drs.hpp"
+#include "dectnrp/sections_part3/numerologies.hpp"
+
+/**
+ * \brief Two paths of equal power, the second delayed by tau_sec. The RMS delay spread is tau_sec/2
+ * and, for small delays, the correlation of pilots four subcarriers apart matches the one of the
+ * exponential power delay profile assumed by the estimator. Both paths are Doppler shifted by
+ * +nu_hz and -nu_hz, so for nu_hz=0 the channel is static.
+ */
+static dectnrp::phy::dispersion_report_t get_dispersion_report(const uint32_t u,
+                                                               const uint32_t b,
+                                                               const double tau_sec,
+                                                               const double nu_hz) {
+    const uint32_t N_RX = 8;
+    const uint32_t N_eff_TX = 1;
+    const uint32_t nof_drs_symb = 4;
+    const float snr_dB = 100.0f;
+
+    const auto numerologies = dectnrp::sp3::get_numerologies(u, b);
+    const double delta_u_f = static_cast<double>(numerologies.delta_u_f);
+    const uint32_t nof_drs_subc = dectnrp::sp3::drs_t::get_nof_drs_subc(b);
+    const uint32_t N_step = dectnrp::sp3::drs_t::get_N_step(N_eff_TX);
+
+    dectnrp::phy::channel_antennas_t channel_antennas;
+    for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
+        channel_antennas.push_back(std::make_unique<dectnrp::phy::channel_antenna_t>(b, N_eff_TX));
+    }
+
+    dectnrp::phy::estimator_dispersion_t estimator_dispersion(b, N_RX);
+    estimator_dispersion.reset(b, N_eff_TX);
+    estimator_dispersion.set_numerology(u, b);
+
+    // random initial phase of both paths, different for each antenna
+    std::mt19937 generator(u * 1000 + b);
+    std::uniform_real_distribution<double> dist_phase(0.0, 2.0 * M_PI);
+    std::vector<double> phase_0(N_RX), phase_1(N_RX);
+    for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
+        phase_0[ant_idx] = dist_phase(generator);
+        phase_1[ant_idx] = dist_phase(generator);
+    }
+
+    for (uint32_t drs_symb_idx = 0; drs_symb_idx < nof_drs_symb; ++drs_symb_idx) {
+        // DRS cells are four subcarriers apart and shifted by two subcarriers every other symbol
+        const uint32_t k_offset = (drs_symb_idx % 2) * 2;
+
+        const double t = static_cast<double>(drs_symb_idx * N_step) * numerologies.T_u_symb;
+        const double doppler_phase = 2.0 * M_PI * nu_hz * t;
+
+        for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
+            // zero-forced estimates are written by rx_synced_t, here we write them directly
+            auto* chestim_drs_zf =
+                const_cast<cf_t*>(channel_antennas[ant_idx]->get_chestim_drs_zf(0));
+
+            for (uint32_t i = 0; i < nof_drs_subc; ++i) {
+                const double f = static_cast<double>(4 * i + k_offset) * delta_u_f;
+                const std::complex<double> h =
+                    std::polar(1.0, phase_0[ant_idx] + doppler_phase) +
+                    std::polar(1.0, phase_1[ant_idx] - doppler_phase - 2.0 * M_PI * f * tau_sec);
+                chestim_drs_zf[i] =
+                    cf_t{static_cast<float>(h.real()), static_cast<float>(h.imag())};
+            }
+        }
+
+        const dectnrp::phy::process_drs_meta_t process_drs_meta(
+            N_eff_TX, 0, 0, 1 + drs_symb_idx * N_step);
+
+        estimator_dispersion.process_drs(channel_antennas, process_drs_meta);
+    }
+
+    return estimator_dispersion.get_dispersion_report(snr_dB);
+}
+
+/// static channel, the Doppler spread must be close to zero
+static bool run_test(const uint32_t u, const uint32_t b, const double tau_sec) {
+    const auto dispersion_report = get_dispersion_report(u, b, tau_sec, 0.0);
+
+    const double delta_u_f = static_cast<double>(dectnrp::sp3::get_numerologies(u, b).delta_u_f);
+
+    const double tau_rms_sec = tau_sec / 2.0;
+    const double tau_rms_err_sec = std::abs(dispersion_report.tau_rms_sec - tau_rms_sec);
+
+    // the lower bound of the correlation limits the resolution for a single path
+    const double tau_rms_tol_sec = std::max(0.1 * tau_rms_sec, 0.05e-6);
+    const double nu_max_tol_hz = 0.005 * delta_u_f;
+
+    const bool error = !dispersion_report.has_tau_rms() || !dispersion_report.has_nu_max() ||
+                       tau_rms_tol_sec < tau_rms_err_sec ||
+                       nu_max_tol_hz < dispersion_report.nu_max_hz;
+
+    dectnrp_print_inf("u={} b={} tau_rms={:.3f}us estimated tau_rms={:.3f}us nu_max={:.1f}Hz {}",
+                      u,
+                      b,
+                      tau_rms_sec * 1.0e6,
+                      dispersion_report.tau_rms_sec * 1.0e6,
+                      dispersion_report.nu_max_hz,
+                      error ? "ERROR" : "");
+
+    return error;
+}
+
+/**
+ * \brief The link starts static and then becomes time-variant. Two paths Doppler shifted by +nu_hz
+ * and -nu_hz have a time correlation of cos(2*pi*nu_hz*dt), which the Jakes fit of the estimator
+ * maps to roughly sqrt(2)*nu_hz. The estimate must grow with nu_hz, and the hint of
+ * dispersion_csi_t must follow from the static to the time-variant value.
+ */
+static bool run_test_doppler() {
+    const uint32_t u = 1;
+    const uint32_t b = 8;
+    const double tau_sec = 0.5e-6;
+
+    bool error = false;
+
+    dectnrp::phy::dispersion_csi_t dispersion_csi;
+
+    const auto dispersion_report_static = get_dispersion_report(u, b, tau_sec, 0.0);
+    for (uint32_t i = 0; i < 8; ++i) {
+        dispersion_csi.update_from_phy(dispersion_report_static);
+    }
+
+    const float nu_max_hz_static = dispersion_csi.get_hint().nu_max_hz;
+
+    float nu_max_hz_previous = dispersion_report_static.nu_max_hz;
+
+    for (const double nu_hz : {100.0, 200.0, 400.0}) {
+        const auto dispersion_report = get_dispersion_report(u, b, tau_sec, nu_hz);
+
+        const bool error_estimate = !dispersion_report.has_nu_max() ||
+                                    dispersion_report.nu_max_hz <= nu_max_hz_previous ||
+                                    dispersion_report.nu_max_hz < nu_hz ||
+                                    2.0 * nu_hz < dispersion_report.nu_max_hz;
+
+        nu_max_hz_previous = dispersion_report.nu_max_hz;
+
+        // the delay spread is unaffected by the Doppler shifts
+        const bool error_tau_rms =
+            0.1 * tau_sec / 2.0 <
+            std::abs(dispersion_report.tau_rms_sec - dispersion_report_static.tau_rms_sec);
+
+        // the first report moves the hint by alpha, further reports let it converge
+        dispersion_csi.update_from_phy(dispersion_report);
+
+        const float nu_max_hz_first = dispersion_csi.get_hint().nu_max_hz;
+
+        for (uint32_t i = 0; i < 16; ++i) {
+            dispersion_csi.update_from_phy(dispersion_report);
+        }
+
+        // a report without Doppler spread leaves the hint unchanged
+        dispersion_csi.update_from_phy(
+            dectnrp::phy::dispersion_report_t(dispersion_report.tau_rms_sec, -1.0f));
+
+        const float nu_max_hz_hint = dispersion_csi.get_hint().nu_max_hz;
+
+        const bool error_hint =
+            nu_max_hz_first <= nu_max_hz_static || dispersion_report.nu_max_hz <= nu_max_hz_first ||
+            0.01f * dispersion_report.nu_max_hz <
+                std::abs(nu_max_hz_hint - dispersion_report.nu_max_hz);
+
+        error = error || error_estimate || error_tau_rms || error_hint;
+
+        dectnrp_print_inf("nu={:.1f}Hz estimated nu_max={:.1f}Hz hint nu_max={:.1f}Hz {}",
+                          nu_hz,
+                          dispersion_report.nu_max_hz,
+                          nu_max_hz_hint,
+                          error_estimate || error_tau_rms || error_hint ? "ERROR" : "");
+    }
+
+    return error;
+}
+
+int main() {
+    bool any_error = false;
+
+    for (const uint32_t u : {1, 2}) {
+        for (const uint32_t b : {4, 8, 16}) {
+            for (const double tau_sec : {0.0, 0.25e-6, 0.5e-6, 1.0e-6}) {
+                // keep the product of delay and pilot spacing within the validity of the model
+                if (0.2 < tau_sec * 4.0 * static_cast<double>(u) * 27000.0) {
+                    continue;
+                }
+
+                any_error = run_test(u, b, tau_sec) || any_error;
+            }
+        }
+    }
+
+    any_error = run_test_doppler() || any_error;
+
+    return any_error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
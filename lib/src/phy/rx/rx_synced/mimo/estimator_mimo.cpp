@@ -22,7 +22,10 @@
 
 #include <volk/volk.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <tuple>
 
 extern "C" {
 #include "srsran/phy/utils/vector.h"
@@ -33,6 +36,68 @@ extern "C" {
 
 namespace dectnrp::phy {
 
+namespace {
+
+/// largest matrix W with a single column and the largest number of ranks considered
+constexpr uint32_t N_TX_virt_max = 4;
+
+/**
+ * \brief Real-valued quadratic form w^H*G*w of a Hermitian matrix G. The vector w is a column of a
+ * beamforming matrix stored in row-major order, so its elements are stride elements apart.
+ */
+float get_quadratic_form(const cf_t* G, const cf_t* w, const uint32_t N, const uint32_t stride) {
+    float ret = 0.0f;
+
+    for (uint32_t a = 0; a < N; ++a) {
+        const cf_t w_a = w[a * stride];
+
+        // diagonal is real
+        const float w_a_abs_sq = __real__(w_a) * __real__(w_a) + __imag__(w_a) * __imag__(w_a);
+        ret += __real__(G[a * N + a]) * w_a_abs_sq;
+
+        // upper triangle, lower triangle is its complex conjugate
+        for (uint32_t b = a + 1; b < N; ++b) {
+            ret += 2.0f * __real__(conjj(w_a) * G[a * N + b] * w[b * stride]);
+        }
+    }
+
+    return ret;
+}
+
+/// log2 of the determinant of a small Hermitian positive definite matrix A, A is overwritten
+float get_log2_det_hermitian(cf_t* A, const uint32_t N) {
+    float ret = 0.0f;
+
+    // Cholesky decomposition A = L*L^H in place, only the lower triangle is used
+    for (uint32_t j = 0; j < N; ++j) {
+        float d = __real__(A[j * N + j]);
+        for (uint32_t k = 0; k < j; ++k) {
+            d -= __real__(A[j * N + k]) * __real__(A[j * N + k]) +
+                 __imag__(A[j * N + k]) * __imag__(A[j * N + k]);
+        }
+
+        // numerically not positive definite, treat as no capacity left
+        if (d <= 0.0f) {
+            return ret;
+        }
+
+        const float L_jj = std::sqrt(d);
+        ret += 2.0f * std::log2(L_jj);
+
+        for (uint32_t i = j + 1; i < N; ++i) {
+            cf_t L_ij = A[i * N + j];
+            for (uint32_t k = 0; k < j; ++k) {
+                L_ij -= A[i * N + k] * conjj(A[j * N + k]);
+            }
+            A[i * N + j] = L_ij / L_jj;
+        }
+    }
+
+    return ret;
+}
+
+}  // namespace
+
 estimator_mimo_t::estimator_mimo_t(const uint32_t N_RX_, const uint32_t N_TS_max_)
     : estimator_t(),
       N_RX(N_RX_),
@@ -51,13 +116,11 @@ estimator_mimo_t::estimator_mimo_t(const uint32_t N_RX_, const uint32_t N_TS_max
             srsran_vec_cf_malloc(N_RX * RX_SYNCED_PARAM_MIMO_N_WIDEBAND_CELLS));
     }
 
-    stage_multiplication =
-        srsran_vec_cf_malloc(std::max(N_RX, N_TS_max) * RX_SYNCED_PARAM_MIMO_N_WIDEBAND_CELLS);
+    gram_rx_ts.resize(N_RX * N_TS_max * N_TS_max);
+    gram_rx_ts_transpose.resize(N_TS_max * N_RX * N_RX);
 }
 
 estimator_mimo_t::~estimator_mimo_t() {
-    free(stage_multiplication);
-
     for (auto elem : stage_rx_ts_transpose_vec) {
         free(elem);
     }
@@ -90,20 +153,33 @@ void estimator_mimo_t::process_drs(const channel_antennas_t& channel_antennas,
     // extract selected cells of OFDM spectrum onto stages
     set_stages(channel_antennas, process_drs_meta);
 
+    // reduce the wideband channel to Gram matrices, all codebook searches are based on these
+    set_gram(process_drs_meta.N_TS, N_RX, stage_rx_ts_vec, gram_rx_ts);
+    set_gram(N_RX, process_drs_meta.N_TS, stage_rx_ts_transpose_vec, gram_rx_ts_transpose);
+
     // optional beamforming matrix for other side to use
     if (process_drs_meta.N_TS == 1) {
         mimo_report.tm_3_7_beamforming_idx = 0;
     } else {
-        mimo_report.tm_3_7_beamforming_idx = mode_single_spatial_stream_3_7(
-            W, process_drs_meta.N_TS, N_RX, stage_rx_ts_vec, stage_multiplication);
+        mimo_report.tm_3_7_beamforming_idx =
+            mode_single_spatial_stream_3_7(W, process_drs_meta.N_TS, N_RX, gram_rx_ts);
     }
 
     // optional beamforming matrix for this receiver to use if channel is reciprocal
     if (N_RX == 1) {
         mimo_report.tm_3_7_beamforming_reciprocal_idx = 0;
     } else {
-        mimo_report.tm_3_7_beamforming_reciprocal_idx = mode_single_spatial_stream_3_7(
-            W, N_RX, process_drs_meta.N_TS, stage_rx_ts_transpose_vec, stage_multiplication);
+        mimo_report.tm_3_7_beamforming_reciprocal_idx =
+            mode_single_spatial_stream_3_7(W, N_RX, process_drs_meta.N_TS, gram_rx_ts_transpose);
+    }
+
+    // optional rank and beamforming matrix for other side to use with multiple spatial streams
+    if (process_drs_meta.N_TS == 1 || N_TX_virt_max < process_drs_meta.N_TS) {
+        mimo_report.RI = 1;
+        mimo_report.PMI = 0;
+    } else {
+        std::tie(mimo_report.RI, mimo_report.PMI) =
+            mode_multi_spatial_stream(W, process_drs_meta.N_TS, N_RX, gram_rx_ts, snr_dB);
     }
 }
 
@@ -159,11 +235,37 @@ void estimator_mimo_t::set_stages(const channel_antennas_t& channel_antennas,
     }
 }
 
+void estimator_mimo_t::set_gram(const uint32_t N_TX_virt,
+                                const uint32_t N_RX_virt,
+                                const std::vector<cf_t*>& stage,
+                                std::vector<cf_t>& gram) {
+    dectnrp_assert(N_RX_virt * N_TX_virt * N_TX_virt <= gram.size(), "gram too small");
+
+    for (std::size_t rx = 0; rx < N_RX_virt; ++rx) {
+        cf_t* G = &gram[rx * N_TX_virt * N_TX_virt];
+
+        // G[a][b] = sum over cells of conj(H[rx][a]) * H[rx][b], Hermitian so only compute half
+        for (std::size_t a = 0; a < N_TX_virt; ++a) {
+            for (std::size_t b = a; b < N_TX_virt; ++b) {
+                lv_32fc_t dot;
+
+                volk_32fc_x2_conjugate_dot_prod_32fc(
+                    &dot,
+                    (const lv_32fc_t*)&stage.at(rx)[b * RX_SYNCED_PARAM_MIMO_N_WIDEBAND_CELLS],
+                    (const lv_32fc_t*)&stage.at(rx)[a * RX_SYNCED_PARAM_MIMO_N_WIDEBAND_CELLS],
+                    RX_SYNCED_PARAM_MIMO_N_WIDEBAND_CELLS);
+
+                G[a * N_TX_virt + b] = cf_t{dot.real(), dot.imag()};
+                G[b * N_TX_virt + a] = cf_t{dot.real(), -dot.imag()};
+            }
+        }
+    }
+}
+
 uint32_t estimator_mimo_t::mode_single_spatial_stream_3_7(const sp3::W_t& W,
                                                           const uint32_t N_TX_virt,
                                                           const uint32_t N_RX_virt,
-                                                          const std::vector<cf_t*>& stage,
-                                                          cf_t* stage_multiplication) {
+                                                          const std::vector<cf_t>& gram) {
     dectnrp_assert(1 < N_TX_virt, "single TX antenna does not allow beamforming");
 
     // get reference to all available beamforming matrices for a single transmit stream
@@ -209,41 +311,25 @@ uint32_t estimator_mimo_t::mode_single_spatial_stream_3_7(const sp3::W_t& W,
 
         // RX antennas of opposite size
         for (std::size_t rx = 0; rx < N_RX_virt; ++rx) {
-            // sum of power across all TS for a single RX antenna
-            lv_32fc_t sum = lv_cmake(0.0f, 0.0f);
-
-            for (std::size_t tx = 0; tx < N_TX_virt; ++tx) {
-                volk_32fc_s32fc_multiply2_32fc(
-                    (lv_32fc_t*)stage_multiplication,
-                    (const lv_32fc_t*)&stage.at(rx)[tx * RX_SYNCED_PARAM_MIMO_N_WIDEBAND_CELLS],
-                    (const lv_32fc_t*)&W_mat_single.at(tx),
-                    RX_SYNCED_PARAM_MIMO_N_WIDEBAND_CELLS);
-
-                lv_32fc_t sum_partial;
-
-                volk_32fc_accumulator_s32fc(&sum_partial,
-                                            (const lv_32fc_t*)stage_multiplication,
-                                            RX_SYNCED_PARAM_MIMO_N_WIDEBAND_CELLS);
-
-                sum += sum_partial;
-            }
+            // wideband power received at a single RX antenna
+            const float power = get_quadratic_form(
+                &gram[rx * N_TX_virt * N_TX_virt], W_mat_single.data(), N_TX_virt, 1);
 
 #if RX_SYNCED_PARAM_MODE_3_7_METRIC == RX_SYNCED_PARAM_MODE_3_7_METRIC_HIGHEST_MIN_RX_POWER
-            if (std::abs(sum) < power_inner) {
-                power_inner = std::abs(sum);
-            }
+            power_inner = std::min(power_inner, power);
 #elif RX_SYNCED_PARAM_MODE_3_7_METRIC == RX_SYNCED_PARAM_MODE_3_7_METRIC_MAX_RX_POWER
-            power_inner += std::abs(sum);
+            power_inner += power;
 #elif RX_SYNCED_PARAM_MODE_3_7_METRIC == RX_SYNCED_PARAM_MODE_3_7_METRIC_MIN_SPREAD_RX_POWER
-            power_min = std::min(power_min, std::abs(sum));
-            power_max = std::max(power_max, std::abs(sum));
+            power_min = std::min(power_min, power);
+            power_max = std::max(power_max, power);
             power_inner = power_max - power_min;
 #else
 #error "undefined mode 3 and 7 metric"
 #endif
         }
 
-        power_inner *= scaling_factor[wm];
+        // scaling factor is given for amplitudes
+        power_inner *= scaling_factor[wm] * scaling_factor[wm];
 
 #if RX_SYNCED_PARAM_MODE_3_7_METRIC == RX_SYNCED_PARAM_MODE_3_7_METRIC_HIGHEST_MIN_RX_POWER
         if (power_outer < power_inner) {
@@ -270,4 +356,72 @@ uint32_t estimator_mimo_t::mode_single_spatial_stream_3_7(const sp3::W_t& W,
     return ret;
 }
 
+std::pair<uint32_t, uint32_t> estimator_mimo_t::mode_multi_spatial_stream(
+    const sp3::W_t& W,
+    const uint32_t N_TX_virt,
+    const uint32_t N_RX_virt,
+    const std::vector<cf_t>& gram,
+    const float snr_dB) {
+    dectnrp_assert(1 < N_TX_virt && N_TX_virt <= N_TX_virt_max, "incorrect number of antennas");
+
+    const uint32_t N_TX_virt_sq = N_TX_virt * N_TX_virt;
+
+    // sum across RX antennas yields H^H*H, normalized to the average across wideband cells
+    std::array<cf_t, N_TX_virt_max * N_TX_virt_max> G{};
+    for (uint32_t rx = 0; rx < N_RX_virt; ++rx) {
+        for (uint32_t i = 0; i < N_TX_virt_sq; ++i) {
+            G[i] += gram[rx * N_TX_virt_sq + i];
+        }
+    }
+
+    const float snr_lin = std::pow(10.0f, snr_dB / 10.0f) /
+                          static_cast<float>(RX_SYNCED_PARAM_MIMO_N_WIDEBAND_CELLS);
+
+    float capacity_max = -1.0f;
+    std::pair<uint32_t, uint32_t> ret{1, 0};
+
+    // number of spatial streams can't exceed the number of antennas on either side
+    for (uint32_t N_SS = 1; N_SS <= std::min(N_TX_virt, N_RX_virt); N_SS *= 2) {
+        const auto& W_mat = W.get_W(N_SS, N_TX_virt);
+        const auto& scaling_factor = W.get_scaling_factor(N_SS, N_TX_virt);
+
+        for (std::size_t wm = 0; wm < W_mat.size(); ++wm) {
+            const cf_t* W_single = W_mat[wm].data();
+            const float scale = snr_lin * scaling_factor[wm] * scaling_factor[wm];
+
+            // A = I + SNR * W^H * G * W, W has N_TX_virt rows and N_SS columns
+            std::array<cf_t, N_TX_virt_max * N_TX_virt_max> GW;
+            for (uint32_t a = 0; a < N_TX_virt; ++a) {
+                for (uint32_t s = 0; s < N_SS; ++s) {
+                    cf_t sum = cf_t{0.0f, 0.0f};
+                    for (uint32_t b = 0; b < N_TX_virt; ++b) {
+                        sum += G[a * N_TX_virt + b] * W_single[b * N_SS + s];
+                    }
+                    GW[a * N_SS + s] = sum;
+                }
+            }
+
+            std::array<cf_t, N_TX_virt_max * N_TX_virt_max> A;
+            for (uint32_t s0 = 0; s0 < N_SS; ++s0) {
+                for (uint32_t s1 = 0; s1 < N_SS; ++s1) {
+                    cf_t sum = cf_t{0.0f, 0.0f};
+                    for (uint32_t a = 0; a < N_TX_virt; ++a) {
+                        sum += conjj(W_single[a * N_SS + s0]) * GW[a * N_SS + s1];
+                    }
+                    A[s0 * N_SS + s1] = scale * sum + (s0 == s1 ? 1.0f : 0.0f);
+                }
+            }
+
+            const float capacity = get_log2_det_hermitian(A.data(), N_SS);
+
+            if (capacity_max < capacity) {
+                capacity_max = capacity;
+                ret = std::make_pair(N_SS, static_cast<uint32_t>(wm));
+            }
+        }
+    }
+
+    return ret;
+}
+
 }  // namespace dectnrp::phy
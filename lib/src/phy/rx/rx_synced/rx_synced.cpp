@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <tuple>
 
 extern "C" {
 #include "srsran/phy/modem/demod_soft.h"
@@ -36,6 +37,7 @@ extern "C" {
 }
 #endif
 
+#include "dectnrp/common/adt/decibels.hpp"
 #include "dectnrp/common/complex.hpp"
 #include "dectnrp/common/json/json_export.hpp"
 #include "dectnrp/common/prog/assert.hpp"
@@ -43,6 +45,7 @@ extern "C" {
 #include "dectnrp/phy/phy_config.hpp"
 #include "dectnrp/phy/resample/resampler_param.hpp"
 #include "dectnrp/phy/rx/rx_synced/channel_estimation/channel_statistics.hpp"
+#include "dectnrp/phy/rx/rx_synced/demapper.hpp"
 #include "dectnrp/phy/rx/rx_synced/rx_synced_param.hpp"
 #include "dectnrp/phy/worker_pool_config.hpp"
 #include "dectnrp/sections_part3/numerologies.hpp"
@@ -117,10 +120,8 @@ rx_synced_t::rx_synced_t(const radio::buffer_rx_t& buffer_rx_,
     const uint32_t N_b_OCC_plus_DC_max = sp3::phyres::N_b_OCC_plus_DC_lut[b_idx_max];
     const uint32_t processing_stage_len_max = N_eff_TX2processing_stage_len[N_eff_TX_max];
 
-    // we demap upper and lower spectrum separately
-    demapping_stage = srsran_vec_u8_malloc(N_b_OCC_plus_DC_max *
-                                           worker_pool_config_.maximum_packet_sizes.mcs.N_bps *
-                                           PHY_D_RX_DATA_TYPE_SIZE);
+    // only used for the PCC which is always QPSK, the PDC is demapped directly into the HARQ buffer
+    demapping_stage = srsran_vec_u8_malloc(N_b_OCC_plus_DC_max * 2 * PHY_D_RX_DATA_TYPE_SIZE);
 
     processing_stage = std::make_unique<processing_stage_t<cf_t>>(
         N_b_OCC_plus_DC_max, processing_stage_len_max, N_RX);
@@ -131,6 +132,7 @@ rx_synced_t::rx_synced_t(const radio::buffer_rx_t& buffer_rx_,
     estimator_mimo = std::make_unique<estimator_mimo_t>(
         N_RX, worker_pool_config_.maximum_packet_sizes.tm_mode.N_TS);
     estimator_aoa = std::make_unique<estimator_aoa_t>(b_max, N_RX);
+    estimator_dispersion = std::make_unique<estimator_dispersion_t>(b_max, N_RX);
 
     const auto numerologies = sp3::get_numerologies(u_max, 1);
 
@@ -152,6 +154,19 @@ rx_synced_t::rx_synced_t(const radio::buffer_rx_t& buffer_rx_,
     // initialize for every RX antenna
     for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
         channel_antennas.push_back(std::make_unique<channel_antenna_t>(b_max, N_eff_TX_max));
+        chestim_ts0.push_back(channel_antennas.back()->chestim[0]);
+    }
+
+    // pick specialized kernels once, nullptr if not instantiated for this configuration
+    mrc_kernel = kernels::get_mrc(N_RX);
+    interp_kernels.resize(std::max(*std::max_element(V3.begin(), V3.end()),
+                                   *std::max_element(V4.begin(), V4.end())) +
+                          1);
+    for (const uint32_t nof_drs_subc_interp : V3) {
+        interp_kernels[nof_drs_subc_interp] = kernels::get_interp(nof_drs_subc_interp);
+    }
+    for (const uint32_t nof_drs_subc_interp : V4) {
+        interp_kernels[nof_drs_subc_interp] = kernels::get_interp(nof_drs_subc_interp);
     }
 
     hb_rx_plcf = harq::buffer_rx_plcf_t::new_unique_instance();
@@ -249,6 +264,11 @@ pcc_report_t rx_synced_t::demoddecod_rx_pcc(sync_report_t& sync_report_) {
     estimator_snr->reset(sync_report->b, sync_report->N_eff_TX);
     estimator_mimo->reset(sync_report->b, sync_report->N_eff_TX);
     estimator_aoa->reset(sync_report->b, sync_report->N_eff_TX);
+    estimator_dispersion->reset(sync_report->b, sync_report->N_eff_TX);
+    estimator_dispersion->set_numerology(sync_report->u, sync_report->b);
+
+    // the sender is unknown until the PCC is decoded
+    dispersion_hint = dispersion_report_t();
 
     /* At this point, we know the OFDM symbol sizes but we don't know yet how many OFDM symbols
      * there are in the current packet. To retrieve that information, we have to collect the PCC and
@@ -350,39 +370,14 @@ pdc_report_t rx_synced_t::demoddecod_rx_pdc(const maclow_phy_t& maclow_phy_) {
     fec_cfg.network_id = maclow_phy->hp_rx->get_network_id();
     fec_cfg.Z = packet_sizes->psdef.Z;
 
+    fec_cfg.d_descrambled = true;
+
     fec->segmentate_and_pick_scrambling_sequence(fec_cfg);
 
-    dectnrp_assert(packet_sizes->psdef.mcs_index <= 9, "Unable to set modem table for MCS index");
-
-    // set symbol demapper
-    switch (packet_sizes->psdef.mcs_index) {
-        // BPSK
-        case 0:
-            srsran_mod = SRSRAN_MOD_BPSK;
-            break;
-        // QPSK
-        case 1:
-        case 2:
-            srsran_mod = SRSRAN_MOD_QPSK;
-            break;
-        // 16 QAM
-        case 3:
-        case 4:
-            srsran_mod = SRSRAN_MOD_16QAM;
-            break;
-        // 64 QAM
-        case 5:
-        case 6:
-        case 7:
-            srsran_mod = SRSRAN_MOD_64QAM;
-            break;
-        // 256 QAM
-        case 8:
-        case 9:
-        default:
-            srsran_mod = SRSRAN_MOD_256QAM;
-            break;
-    }
+    // configure demapper, which descrambles while writing d bits
+    scrambling_c = fec->get_srsran_sequence()->c;
+    llr_scale = demapper::get_llr_scale(packet_sizes->mcs.N_bps,
+                                        estimator_snr->get_current_snr_dB_estimation());
 
     dectnrp_assert(ofdm_symb_idx <= packet_sizes->N_DF_symb,
                    "Absolute OFDM symbol index too large.");
@@ -391,8 +386,11 @@ pdc_report_t rx_synced_t::demoddecod_rx_pdc(const maclow_phy_t& maclow_phy_) {
     mac_pdu_decoder.set_configuration(
         maclow_phy_.hp_rx->get_hb_tb()->get_a(), packet_sizes->N_TB_byte, packet_sizes->psdef.u);
 
+    // pick Wiener filter, mode and stride based on the channel the MAC knows for this sender
+    run_pdc_chestim_config_pick();
+
     // process PDC based on mode
-    if (chestim_mode_lr_default) {
+    if (chestim_mode_lr_packet) {
         run_pdc_ps_in_chestim_mode_lr_t();
     }
     run_pdc_ps_in_chestim_mode_lr_f();
@@ -426,13 +424,23 @@ pdc_report_t rx_synced_t::demoddecod_rx_pdc(const maclow_phy_t& maclow_phy_) {
                    TS_idx_last,
                    sync_report->N_eff_TX);
 
+    // rank selection depends on the SNR
+    estimator_mimo->set_snr_dB(estimator_snr->get_current_snr_dB_estimation());
+
     // use derotated and packed DRS symbols
     estimator_mimo->process_drs(channel_antennas, process_drs_meta);
 #endif
 
     return pdc_report_t(mac_pdu_decoder,
                         estimator_snr->get_current_snr_dB_estimation(),
-                        estimator_mimo->get_mimo_report());
+                        estimator_mimo->get_mimo_report(),
+#ifdef RX_SYNCED_PARAM_DISPERSION_BASED_ON_DRS
+                        estimator_dispersion->get_dispersion_report(
+                            estimator_snr->get_current_snr_dB_estimation())
+#else
+                        dispersion_report_t()
+#endif
+    );
 }
 
 void rx_synced_t::reset_for_next_pcc() {
@@ -831,7 +839,7 @@ void rx_synced_t::run_drs_chestim_zf() {
 
 #if defined(RX_SYNCED_PARAM_STO_RESIDUAL_BASED_ON_DRS) || \
     defined(RX_SYNCED_PARAM_CFO_RESIDUAL_BASED_ON_DRS) || \
-    defined(RX_SYNCED_PARAM_SNR_BASED_ON_DRS)
+    defined(RX_SYNCED_PARAM_SNR_BASED_ON_DRS) || defined(RX_SYNCED_PARAM_DISPERSION_BASED_ON_DRS)
     const process_drs_meta_t process_drs_meta(
         sync_report->N_eff_TX, TS_idx_first, TS_idx_last, ofdm_symb_idx);
 #endif
@@ -856,6 +864,10 @@ void rx_synced_t::run_drs_chestim_zf() {
     estimator_snr->process_drs(channel_antennas, process_drs_meta);
 #endif
 
+#ifdef RX_SYNCED_PARAM_DISPERSION_BASED_ON_DRS
+    estimator_dispersion->process_drs(channel_antennas, process_drs_meta);
+#endif
+
     // the SNR estimation has improved, find optimal Wiener filter
     run_drs_channel_lut_pick();
 }
@@ -868,18 +880,54 @@ void rx_synced_t::run_drs_channel_lut_pick() {
         // load current SNR estimation
         const float snr_now = estimator_snr->get_current_snr_dB_estimation();
 
-        // find channel_luts element with best closest SNR
-        uint32_t idx = 0;
-        float snr_diff = std::fabs(snr_now - channel_luts[idx]->channel_statistics.snr_db);
-        for (uint32_t i = 1; i < channel_luts.size(); ++i) {
-            const float s = std::fabs(snr_now - channel_luts[i]->channel_statistics.snr_db);
-            if (s <= snr_diff) {
-                snr_diff = s;
-                idx = i;
+        /* A LUT is adequate if it was designed for at least the delay and Doppler spread of the
+         * hint. Spreads larger than those of any LUT are limited, so that at least one LUT is
+         * always adequate. Without a hint, every LUT is adequate.
+         */
+        double nu_max_hz_lut = 0.0;
+        double tau_rms_sec_lut = 0.0;
+        for (const auto& elem : channel_luts) {
+            nu_max_hz_lut = std::max(nu_max_hz_lut, elem->channel_statistics.nu_max_hz);
+            tau_rms_sec_lut = std::max(tau_rms_sec_lut, elem->channel_statistics.tau_rms_sec);
+        }
+
+        const double nu_max_hz = dispersion_hint.has_nu_max()
+                                     ? std::min(double{dispersion_hint.nu_max_hz}, nu_max_hz_lut)
+                                     : 0.0;
+        const double tau_rms_sec =
+            dispersion_hint.has_tau_rms()
+                ? std::min(double{dispersion_hint.tau_rms_sec}, tau_rms_sec_lut)
+                : 0.0;
+
+        /* Among all adequate LUTs, find the one with the closest SNR. For equally close SNRs, the
+         * LUT with the smaller spreads has statistics closer to the actual channel.
+         */
+        channel_lut_effective = nullptr;
+        double snr_diff = 0.0;
+        for (const auto& elem : channel_luts) {
+            const auto& chst = elem->channel_statistics;
+
+            if (chst.nu_max_hz < nu_max_hz || chst.tau_rms_sec < tau_rms_sec) {
+                continue;
             }
+
+            const double s = std::fabs(snr_now - chst.snr_db);
+
+            if (channel_lut_effective != nullptr) {
+                const auto& chst_best = channel_lut_effective->channel_statistics;
+
+                if (snr_diff < s ||
+                    (s == snr_diff && std::tie(chst_best.nu_max_hz, chst_best.tau_rms_sec) <=
+                                          std::tie(chst.nu_max_hz, chst.tau_rms_sec))) {
+                    continue;
+                }
+            }
+
+            snr_diff = s;
+            channel_lut_effective = elem.get();
         }
 
-        channel_lut_effective = channel_luts[idx].get();
+        dectnrp_assert(channel_lut_effective != nullptr, "no channel LUT picked");
 
 #ifndef RX_SYNCED_PARAM_CHANNEL_LUT_LOOKUP_AFTER_EVERY_DRS_SYMBOL_OR_ONCE
     }
@@ -890,6 +938,55 @@ void rx_synced_t::run_drs_channel_lut_pick() {
                                                     sync_report->N_eff_TX);
 }
 
+void rx_synced_t::run_pdc_chestim_config_pick() {
+    // defaults are used whenever the channel of the sender is unknown
+    chestim_mode_lr_packet = chestim_mode_lr_default;
+    chestim_mode_lr_t_stride_packet = chestim_mode_lr_t_stride;
+
+    dispersion_hint = maclow_phy->dispersion_hint;
+
+    if (!dispersion_hint.has_tau_rms() && !dispersion_hint.has_nu_max()) {
+        return;
+    }
+
+    // during the PCC, the Wiener filter was picked without a hint
+    channel_lut_effective = nullptr;
+    run_drs_channel_lut_pick();
+
+    // mode lr is never used if disabled in the configuration
+    if (!chestim_mode_lr_default || !dispersion_hint.has_nu_max()) {
+        return;
+    }
+
+    const float snr_dB = estimator_snr->get_current_snr_dB_estimation();
+
+    /* For a time distance of x/(2*pi*nu_max), the correlation of the channel is J0(x) ~ 1-x^2/4.
+     * Using an outdated channel estimate thus adds an error power of 2*(1-J0(x)) ~ x^2/2 relative
+     * to the signal power, which must stay below the noise power minus a margin.
+     */
+    const float x_max = std::sqrt(
+        2.0f * common::adt::db2pow(-(snr_dB + RX_SYNCED_PARAM_DISPERSION_ERROR_MARGIN_DB)));
+
+    const double T_u_symb = sp3::get_numerologies(sync_report->u, sync_report->b).T_u_symb;
+    const float x_per_symbol = 2.0f * static_cast<float>(M_PI) * dispersion_hint.nu_max_hz *
+                               static_cast<float>(T_u_symb);
+
+    // number of OFDM symbols across which a single channel estimate remains adequate
+    const float nof_symb_adequate =
+        x_per_symbol > 0.0f ? x_max / x_per_symbol : static_cast<float>(N_step);
+
+    // in mode lr=false, the channel estimate of one DRS symbol is used for N_step symbols
+    if (RX_SYNCED_PARAM_DISPERSION_LR_SNR_DB_MAX <= snr_dB &&
+        static_cast<float>(N_step) <= nof_symb_adequate) {
+        chestim_mode_lr_packet = false;
+        return;
+    }
+
+    chestim_mode_lr_packet = true;
+    chestim_mode_lr_t_stride_packet = static_cast<uint32_t>(
+        std::clamp(nof_symb_adequate, 1.0f, static_cast<float>(N_step)));
+}
+
 void rx_synced_t::run_drs_ch_interpolation() {
     // tell channel_lut which LUT to use
     channel_lut_effective->set_configuration_ps(chestim_mode_lr, ps_idx);
@@ -902,6 +999,8 @@ void rx_synced_t::run_drs_ch_interpolation() {
     // number of consecutive pilots for interpolation
     const uint32_t nof_drs_subc_interp = channel_lut_effective->get_nof_drs_subc_interp();
 
+    const kernels::interp_func_t interp_kernel = interp_kernels[nof_drs_subc_interp];
+
     // if chestim_mode_lr=true, all transmit streams are available, otherwise only those of the last
     // OFDM symbol with DRS cells
     const uint32_t TS_idx_first_local = chestim_mode_lr ? 0 : TS_idx_first;
@@ -928,6 +1027,16 @@ void rx_synced_t::run_drs_ch_interpolation() {
             // target
             cf_t* chestim_ts = channel_antennas[ant_idx]->chestim[ts_idx];
 
+            if (interp_kernel != nullptr) {
+                interp_kernel(chestim_ts,
+                              chestim_drs_zf_ts,
+                              idx_pilot_this_ts,
+                              idx_weights_this_ts,
+                              weight_vecs,
+                              N_b_OCC_plus_DC);
+                continue;
+            }
+
             // ... and estimate the channel at each subcarrier
             for (uint32_t subc_idx = 0; subc_idx < N_b_OCC_plus_DC; ++subc_idx) {
 #if RX_SYNCED_PARAM_WEIGHTS_TYPE_CHOICE == RX_SYNCED_PARAM_WEIGHTS_TYPE_REAL
@@ -952,46 +1061,18 @@ void rx_synced_t::run_pcc_collection_and_demapping() {
     // load indices of PCC cells in this OFDM symbol
     const std::vector<uint32_t>& k_i_one_symbol = pcc.get_k_i_one_symbol();
 
-    /* With and without transmit diversity, we have to collect the signals across multiple antennas
-     * in a numerator and a denominator as in https://en.wikipedia.org/wiki/Maximal-ratio_combining.
-     * For this, we reuse mixer_stage and fft_stage as they are no longer required for the current
-     * OFDM symbol.
-     */
-    srsran_vec_cf_zero(mixer_stage[0], k_i_one_symbol.size());
-    srsran_vec_cf_zero(fft_stage, k_i_one_symbol.size());
-
     // only one transmit stream?
     if (sync_report->N_eff_TX == 1) {
-        // https://en.wikipedia.org/wiki/Maximal-ratio_combining
-
-        // go over each RX antenna
-        for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
-            // y_mrc is the received OFDM symbol at this antenna
-            const cf_t* y_mrc = ofdm_symbol_now[ant_idx];
-
-            // h_mrc is the estimated channel at this antenna in transmit stream 0
-            const cf_t* h_mrc = channel_antennas[ant_idx]->chestim[0];
-
-            // collect all PCC cells
-            uint32_t cnt = 0;
-            for (uint32_t k_i : k_i_one_symbol) {
-                // MRC: conj(h)
-                const cf_t h_conj_mrc = conjj(h_mrc[k_i]);
-
-                // MRC numerator: y*conj(h)
-                mixer_stage[0][cnt] += y_mrc[k_i] * h_conj_mrc;
-
-                // MRC denominator: |h|^2 = h*conj(h)
-                fft_stage[cnt++] += h_mrc[k_i] * h_conj_mrc;
-            }
-        }
-
-        // MRC numerator/denomimator, technically not required as PCC always uses QPSK
-        volk_32fc_x2_divide_32fc((lv_32fc_t*)mixer_stage[0],
-                                 (const lv_32fc_t*)mixer_stage[0],
-                                 (const lv_32fc_t*)fft_stage,
-                                 k_i_one_symbol.size());
+        // MRC run by run, technically the division is not required as PCC always uses QPSK
+        run_pxx_mrc_compacted(pcc.get_k_i_runs_one_symbol());
     } else {
+        /* With transmit diversity, we have to collect the signals across multiple antennas in a
+         * numerator and a denominator. For this, we reuse mixer_stage and fft_stage as they are no
+         * longer required for the current OFDM symbol.
+         */
+        srsran_vec_cf_zero(mixer_stage[0], k_i_one_symbol.size());
+        srsran_vec_cf_zero(fft_stage, k_i_one_symbol.size());
+
         run_pxx_mode_transmit_diversity(k_i_one_symbol, PCC_idx);
     }
 
@@ -1094,7 +1175,7 @@ void rx_synced_t::run_pdc_ps_in_chestim_mode_lr_t() {
             processing_stage->get_stage_prealloc(ofdm_symb_ps_idx, ofdm_symbol_now);
 
             // update channel estimation
-            if ((ofdm_symb_ps_idx - relative_start) % chestim_mode_lr_t_stride == 0) {
+            if ((ofdm_symb_ps_idx - relative_start) % chestim_mode_lr_t_stride_packet == 0) {
                 run_drs_ch_interpolation();
             }
 
@@ -1205,104 +1286,92 @@ void rx_synced_t::run_pdc_mode_single_antenna() {
     /* With only one transmit stream, the optimal way to combine the signals from all RX
      * antennas is MRC https://en.wikipedia.org/wiki/Maximal-ratio_combining.
      *
-     * We use mixer_stage[0] to collect the numerator across all antennas for each subcarrier.
-     * We use fft_stage to collect the denominator across all antennas for each subcarrier.
+     * PDC cells are combined run by run and compacted into mixer_stage[0]. The symbol is then
+     * demapped with a single call, independent of whether it also contains DRS or PCC cells.
      */
-
-    // load PDC subcarrier indices
-    const std::vector<uint32_t>& k_i_one_symbol = pdc.get_k_i_one_symbol();
-    uint32_t k_i_one_symbol_size = k_i_one_symbol.size();
-
-    /* When the current OFDM symbol only contains PDC cells, we split processing of the symbol in
-     * two steps, one for the lower and one for the upper spectrum half.
-     *
-     * If, however, the symbol contains not only PDC cells, we process the entire OFDM
-     * symbol/spectrum in a single step and then call srsran_demod_soft_demodulate_b() and
-     * srsran_demod_soft_demodulate_s() for each complex PDC cell individually. This way, internally
-     * no SIMD instructions are used and the alignment is not relevant.
-     */
-    // two steps when only PDC cells, one step otherwise
-    const uint32_t step_max = (k_i_one_symbol_size == N_b_OCC) ? 2 : 1;
-    // number of cells per step: either one half the spectrum, or the full spectrum + DC carrier
-    const uint32_t step_width = (step_max == 2) ? N_b_OCC / 2 : N_b_OCC + 1;
-
-    // step by step
-    for (uint32_t step = 0; step < step_max; ++step) {
-        // 0 for lower spectrum, (N_b_OCC / 2 + 1) for upper
-        const uint32_t read_offset = (N_b_OCC / 2 + 1) * step;
-
-        // we reuse mixer_stage and fft_stage pointers as they are no longer required for the
-        // current OFDM symbol
-        srsran_vec_cf_zero(mixer_stage[0], step_width);
-        srsran_vec_cf_zero(fft_stage, step_width);
-
-        // collect from all antennas
-        for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
-            // numerator y*conj(h) for this antenna
-            volk_32fc_x2_multiply_conjugate_32fc(
-                (lv_32fc_t*)mrc_stage,
-                (const lv_32fc_t*)&ofdm_symbol_now[ant_idx][read_offset],
-                (const lv_32fc_t*)&channel_antennas[ant_idx]->chestim[0][read_offset],
-                step_width);
-
-            // sum up MRC numerator
-            volk_32fc_x2_add_32fc((lv_32fc_t*)mixer_stage[0],
-                                  (const lv_32fc_t*)mixer_stage[0],
-                                  (const lv_32fc_t*)mrc_stage,
-                                  step_width);
-
-            // denominator |h|^2=h*conj(h) for this antenna
-            volk_32fc_x2_multiply_conjugate_32fc(
-                (lv_32fc_t*)mrc_stage,
-                (const lv_32fc_t*)&channel_antennas[ant_idx]->chestim[0][read_offset],
-                (const lv_32fc_t*)&channel_antennas[ant_idx]->chestim[0][read_offset],
-                step_width);
-
-            // sum up MRC denominator
-            volk_32fc_x2_add_32fc((lv_32fc_t*)fft_stage,
-                                  (const lv_32fc_t*)fft_stage,
-                                  (const lv_32fc_t*)mrc_stage,
-                                  step_width);
-        }
-
-        // MRC numerator/denomimator
-        volk_32fc_x2_divide_32fc((lv_32fc_t*)mixer_stage[0],
-                                 (const lv_32fc_t*)mixer_stage[0],
-                                 (const lv_32fc_t*)fft_stage,
-                                 step_width);
+    const uint32_t N_cells = run_pxx_mrc_compacted(pdc.get_k_i_runs_one_symbol());
 
 #ifdef PHY_RX_RX_SYNCED_TCP_SCOPE
-        tcp_scope->send_to_scope(std::vector<cf_t*>{mixer_stage[0]}, step_width);
+    tcp_scope->send_to_scope(std::vector<cf_t*>{mixer_stage[0]}, N_cells);
 #endif
 
-        // demap: all pointers must be memory-aligned!
-        if (step_max == 2) {
-            // entire lower of upper spectrum half
-            srsran_demod_soft_demodulate_s(
-                srsran_mod, mixer_stage[0], (short*)demapping_stage, step_width);
-
-            // copy from demapping stage to d-bits of HARQ buffer
-            memcpy(hb_tb->get_d(PDC_bits_idx * PHY_D_RX_DATA_TYPE_SIZE),
-                   demapping_stage,
-                   step_width * packet_sizes->mcs.N_bps * PHY_D_RX_DATA_TYPE_SIZE);
+    run_pdc_demapping(N_cells);
+}
 
-            PDC_subc_idx += step_width;
-            PDC_bits_idx += step_width * packet_sizes->mcs.N_bps;
+void rx_synced_t::run_pdc_demapping(const uint32_t N_cells) {
+    // demap and descramble directly into d bits of HARQ buffer
+    demapper::demap_and_descramble(
+        packet_sizes->mcs.N_bps,
+        mixer_stage[0],
+        llr_scale,
+        &scrambling_c[PDC_bits_idx],
+        reinterpret_cast<PHY_D_RX_DATA_TYPE*>(hb_tb->get_d(PDC_bits_idx * PHY_D_RX_DATA_TYPE_SIZE)),
+        N_cells);
+
+    PDC_subc_idx += N_cells;
+    PDC_bits_idx += N_cells * packet_sizes->mcs.N_bps;
+}
 
+uint32_t rx_synced_t::run_pxx_mrc_compacted(const std::vector<sp3::df_pxc_t::run_t>& runs) {
+    uint32_t cnt = 0;
+
+    for (const auto& run : runs) {
+        if (mrc_kernel != nullptr) {
+            // single pass over all antennas, writes MRC output directly into mixer_stage[0]
+            mrc_kernel(&mixer_stage[0][cnt],
+                       ofdm_symbol_now.data(),
+                       chestim_ts0.data(),
+                       run.start,
+                       run.length);
         } else {
-            // one PDC cell at a time
-            for (uint32_t i : k_i_one_symbol) {
-                srsran_demod_soft_demodulate_s(
-                    srsran_mod,
-                    &mixer_stage[0][i],
-                    (short*)hb_tb->get_d(PDC_bits_idx * PHY_D_RX_DATA_TYPE_SIZE),
-                    1);
-
-                ++PDC_subc_idx;
-                PDC_bits_idx += packet_sizes->mcs.N_bps;
+            // we reuse mixer_stage and fft_stage pointers as they are no longer required for the
+            // current OFDM symbol
+            srsran_vec_cf_zero(&mixer_stage[0][cnt], run.length);
+            srsran_vec_cf_zero(&fft_stage[cnt], run.length);
+
+            // collect from all antennas
+            for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
+                const cf_t* y_mrc = &ofdm_symbol_now[ant_idx][run.start];
+                const cf_t* h_mrc = &channel_antennas[ant_idx]->chestim[0][run.start];
+
+                // numerator y*conj(h) for this antenna
+                volk_32fc_x2_multiply_conjugate_32fc((lv_32fc_t*)mrc_stage,
+                                                     (const lv_32fc_t*)y_mrc,
+                                                     (const lv_32fc_t*)h_mrc,
+                                                     run.length);
+
+                // sum up MRC numerator
+                volk_32fc_x2_add_32fc((lv_32fc_t*)&mixer_stage[0][cnt],
+                                      (const lv_32fc_t*)&mixer_stage[0][cnt],
+                                      (const lv_32fc_t*)mrc_stage,
+                                      run.length);
+
+                // denominator |h|^2=h*conj(h) for this antenna
+                volk_32fc_x2_multiply_conjugate_32fc((lv_32fc_t*)mrc_stage,
+                                                     (const lv_32fc_t*)h_mrc,
+                                                     (const lv_32fc_t*)h_mrc,
+                                                     run.length);
+
+                // sum up MRC denominator
+                volk_32fc_x2_add_32fc((lv_32fc_t*)&fft_stage[cnt],
+                                      (const lv_32fc_t*)&fft_stage[cnt],
+                                      (const lv_32fc_t*)mrc_stage,
+                                      run.length);
             }
         }
+
+        cnt += run.length;
+    }
+
+    if (mrc_kernel == nullptr) {
+        // MRC numerator/denomimator
+        volk_32fc_x2_divide_32fc((lv_32fc_t*)mixer_stage[0],
+                                 (const lv_32fc_t*)mixer_stage[0],
+                                 (const lv_32fc_t*)fft_stage,
+                                 cnt);
     }
+
+    return cnt;
 }
 
 void rx_synced_t::run_pdc_mode_transmit_diversity() {
@@ -1315,17 +1384,7 @@ void rx_synced_t::run_pdc_mode_transmit_diversity() {
 
     run_pxx_mode_transmit_diversity(k_i_one_symbol, PDC_subc_idx);
 
-    // entire lower of upper spectrum half
-    srsran_demod_soft_demodulate_s(
-        srsran_mod, mixer_stage[0], (short*)demapping_stage, k_i_one_symbol.size());
-
-    // copy from demapping stage to d-bits of HARQ buffer
-    memcpy(hb_tb->get_d(PDC_bits_idx * PHY_D_RX_DATA_TYPE_SIZE),
-           demapping_stage,
-           k_i_one_symbol.size() * packet_sizes->mcs.N_bps * PHY_D_RX_DATA_TYPE_SIZE);
-
-    PDC_subc_idx += k_i_one_symbol.size();
-    PDC_bits_idx += k_i_one_symbol.size() * packet_sizes->mcs.N_bps;
+    run_pdc_demapping(k_i_one_symbol.size());
 }
 
 void rx_synced_t::run_pdc_mode_AxA_MIMO() {
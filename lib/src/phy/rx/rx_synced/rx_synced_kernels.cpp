@@ -0,0 +1,143 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/phy/rx/rx_synced/rx_synced_kernels.hpp"
+
+/* Both lists are set by CMake with ENABLE_SPECIALIZED, e.g. PHY_KERNELS_N_RX=1,2,4,8. Without
+ * them, no kernel is instantiated and every getter returns nullptr.
+ */
+#ifndef PHY_KERNELS_N_RX
+#define PHY_KERNELS_N_RX
+#endif
+
+#ifndef PHY_KERNELS_NOF_DRS_INTERP
+#define PHY_KERNELS_NOF_DRS_INTERP
+#endif
+
+namespace dectnrp::phy::kernels {
+
+/* Complex numbers are accessed as interleaved floats. This avoids the NaN handling of C complex
+ * multiplication and lets the compiler vectorize across subcarriers.
+ */
+
+/// MRC of B consecutive subcarriers starting at k0, accumulators stay in registers
+template <uint32_t N_RX, uint32_t B>
+static inline void mrc_block(float* __restrict out_f,
+                             const cf_t* const* y,
+                             const cf_t* const* h,
+                             const uint32_t k0) {
+    float num_re[B]{};
+    float num_im[B]{};
+    float den[B]{};
+
+    // numerator y*conj(h) and denominator |h|^2 summed across all antennas
+    for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
+        const float* __restrict y_f = reinterpret_cast<const float*>(y[ant_idx] + k0);
+        const float* __restrict h_f = reinterpret_cast<const float*>(h[ant_idx] + k0);
+
+        for (uint32_t k = 0; k < B; ++k) {
+            const float y_re = y_f[2 * k];
+            const float y_im = y_f[2 * k + 1];
+            const float h_re = h_f[2 * k];
+            const float h_im = h_f[2 * k + 1];
+
+            num_re[k] += y_re * h_re + y_im * h_im;
+            num_im[k] += y_im * h_re - y_re * h_im;
+            den[k] += h_re * h_re + h_im * h_im;
+        }
+    }
+
+    for (uint32_t k = 0; k < B; ++k) {
+        const float den_inv = 1.0f / den[k];
+        out_f[2 * k] = num_re[k] * den_inv;
+        out_f[2 * k + 1] = num_im[k] * den_inv;
+    }
+}
+
+template <uint32_t N_RX>
+static void mrc(cf_t* out,
+                const cf_t* const* y,
+                const cf_t* const* h,
+                const uint32_t offset,
+                const uint32_t len) {
+    constexpr uint32_t B = 16;
+
+    float* out_f = reinterpret_cast<float*>(out);
+
+    uint32_t k = 0;
+    for (; k + B <= len; k += B) {
+        mrc_block<N_RX, B>(&out_f[2 * k], y, h, offset + k);
+    }
+    for (; k < len; ++k) {
+        mrc_block<N_RX, 1>(&out_f[2 * k], y, h, offset + k);
+    }
+}
+
+#if RX_SYNCED_PARAM_WEIGHTS_TYPE_CHOICE == RX_SYNCED_PARAM_WEIGHTS_TYPE_REAL
+template <uint32_t nof_drs_subc_interp>
+static void interp(cf_t* chestim,
+                   const cf_t* drs_zf,
+                   const RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_pilot,
+                   const RX_SYNCED_PARAM_LUT_IDX_TYPE* idx_weights,
+                   const RX_SYNCED_PARAM_WEIGHTS_TYPE* weight_vecs,
+                   const uint32_t len) {
+    float* __restrict chestim_f = reinterpret_cast<float*>(chestim);
+
+    for (uint32_t subc_idx = 0; subc_idx < len; ++subc_idx) {
+        const float* pilots = reinterpret_cast<const float*>(drs_zf + idx_pilot[subc_idx]);
+        const float* weights = &weight_vecs[idx_weights[subc_idx] * nof_drs_subc_interp];
+
+        float re = 0.0f;
+        float im = 0.0f;
+
+        for (uint32_t i = 0; i < nof_drs_subc_interp; ++i) {
+            re += pilots[2 * i] * weights[i];
+            im += pilots[2 * i + 1] * weights[i];
+        }
+
+        chestim_f[2 * subc_idx] = re;
+        chestim_f[2 * subc_idx + 1] = im;
+    }
+}
+#endif
+
+template <uint32_t... N>
+static mrc_func_t select_mrc(const uint32_t N_RX) {
+    mrc_func_t ret = nullptr;
+    ((ret = (N == N_RX) ? &mrc<N> : ret), ...);
+    return ret;
+}
+
+template <uint32_t... N>
+static interp_func_t select_interp([[maybe_unused]] const uint32_t nof_drs_subc_interp) {
+    interp_func_t ret = nullptr;
+#if RX_SYNCED_PARAM_WEIGHTS_TYPE_CHOICE == RX_SYNCED_PARAM_WEIGHTS_TYPE_REAL
+    ((ret = (N == nof_drs_subc_interp) ? &interp<N> : ret), ...);
+#endif
+    return ret;
+}
+
+mrc_func_t get_mrc(const uint32_t N_RX) { return select_mrc<PHY_KERNELS_N_RX>(N_RX); }
+
+interp_func_t get_interp(const uint32_t nof_drs_subc_interp) {
+    return select_interp<PHY_KERNELS_NOF_DRS_INTERP>(nof_drs_subc_interp);
+}
+
+}  // namespace dectnrp::phy::kernels
@@ -0,0 +1,328 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/phy/rx/rx_synced/demapper.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "dectnrp/common/adt/decibels.hpp"
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/phy/fec/fec.hpp"
+#include "dectnrp/phy/harq/buffer_rx.hpp"
+#include "dectnrp/phy/harq/buffer_tx.hpp"
+#include "dectnrp/phy/phy_config.hpp"
+#include "dectnrp/phy/rx/rx_synced/rx_synced_param.hpp"
+#include "dectnrp/sections_part3/derivative/packet_sizes.hpp"
+#include "dectnrp/sections_part3/fix/mod.hpp"
+#include "dectnrp/sections_part3/radio_device_class.hpp"
+#include "srsran/srsran.h"
+
+/* The fused demapper replaces srsran_demod_soft_demodulate_s() followed by
+ * srsran_scrambling_s_offset(). First, both paths are compared LLR by LLR for every modulation
+ * order. Second, full transport blocks are demapped with the SNR-dependent scale and decoded, with
+ * HARQ combining across redundancy versions.
+ */
+
+using namespace dectnrp;
+
+static constexpr uint32_t N_cells{1000};
+
+/// srsran converts to fixed-point after each stage of its piecewise linear approximation
+static constexpr int32_t tolerance{4};
+
+static bool test_equivalence(const uint32_t N_bps, srsran_channel_awgn_t& awgn) {
+    const uint32_t N_bits = N_cells * N_bps;
+
+    std::mt19937 generator(N_bps);
+    std::uniform_int_distribution<uint32_t> bit_dist(0, 1);
+
+    uint8_t* bits = srsran_vec_u8_malloc(N_bits);
+    cf_t* symbols = srsran_vec_cf_malloc(N_cells);
+    cf_t* symbols_plus_noise = srsran_vec_cf_malloc(N_cells);
+    int16_t* llr_srsran = srsran_vec_i16_malloc(N_bits);
+    int16_t* llr_fused = srsran_vec_i16_malloc(N_bits);
+
+    for (uint32_t i = 0; i < N_bits; ++i) {
+        bits[i] = bit_dist(generator);
+    }
+
+    srsran_modem_table_t modem_table;
+    srsran_modem_table_lte(&modem_table, sp3::fix::get_srsran_mod(N_bps));
+    srsran_mod_modulate(&modem_table, bits, symbols, N_bits);
+
+    // noisy, but without saturating int16_t
+    srsran_channel_awgn_set_n0(&awgn, -20.0f);
+    srsran_channel_awgn_run_c(&awgn, symbols, symbols_plus_noise, N_cells);
+
+    srsran_sequence_t sequence = {};
+    srsran_sequence_LTE_pr(&sequence, N_bits, 0x1234 + N_bps);
+
+    // reference path
+    srsran_demod_soft_demodulate_s(
+        sp3::fix::get_srsran_mod(N_bps), symbols_plus_noise, llr_srsran, N_cells);
+    srsran_scrambling_s_offset(&sequence, llr_srsran, 0, N_bits);
+
+    bool any_error = false;
+
+    // full scale in two calls, the first ending with an incomplete block of cells
+    const float scale =
+        phy::demapper::get_llr_scale(N_bps, RX_SYNCED_PARAM_DEMAPPER_SNR_DB_FULL_SCALE);
+
+    const uint32_t N_cells_first = 77;
+
+    phy::demapper::demap_and_descramble<int16_t>(
+        N_bps, symbols_plus_noise, scale, sequence.c, llr_fused, N_cells_first);
+    phy::demapper::demap_and_descramble<int16_t>(N_bps,
+                                                 &symbols_plus_noise[N_cells_first],
+                                                 scale,
+                                                 &sequence.c[N_cells_first * N_bps],
+                                                 &llr_fused[N_cells_first * N_bps],
+                                                 N_cells - N_cells_first);
+
+    for (uint32_t i = 0; i < N_bits; ++i) {
+        if (std::abs(static_cast<int32_t>(llr_fused[i]) - llr_srsran[i]) > tolerance) {
+            dectnrp_print_wrn("N_bps={} LLR {} is {} instead of {}",
+                              N_bps,
+                              i,
+                              llr_fused[i],
+                              llr_srsran[i]);
+            any_error = true;
+            break;
+        }
+    }
+
+    // below full scale, LLRs shrink proportionally to the SNR
+    const float snr_dB = RX_SYNCED_PARAM_DEMAPPER_SNR_DB_FULL_SCALE - 6.0f;
+    const float factor = common::adt::db2pow(snr_dB - RX_SYNCED_PARAM_DEMAPPER_SNR_DB_FULL_SCALE);
+
+    phy::demapper::demap_and_descramble<int16_t>(N_bps,
+                                                 symbols_plus_noise,
+                                                 phy::demapper::get_llr_scale(N_bps, snr_dB),
+                                                 sequence.c,
+                                                 llr_fused,
+                                                 N_cells);
+
+    for (uint32_t i = 0; i < N_bits; ++i) {
+        const float expected = factor * static_cast<float>(llr_srsran[i]);
+        if (std::abs(static_cast<float>(llr_fused[i]) - expected) > tolerance) {
+            dectnrp_print_wrn("N_bps={} scaled LLR {} is {} instead of {}",
+                              N_bps,
+                              i,
+                              llr_fused[i],
+                              expected);
+            any_error = true;
+            break;
+        }
+    }
+
+    srsran_sequence_free(&sequence);
+    srsran_modem_table_free(&modem_table);
+
+    free(bits);
+    free(symbols);
+    free(symbols_plus_noise);
+    free(llr_srsran);
+    free(llr_fused);
+
+    return any_error;
+}
+
+/**
+ * \brief Every transmission is demapped with the scale for its own SNR and combined in the HARQ
+ * buffer. Transmissions below RX_SYNCED_PARAM_DEMAPPER_SNR_DB_FULL_SCALE are weighted less.
+ *
+ * \param snr_dB_vec SNR of each transmission
+ * \return number of packets which could not be decoded after all transmissions
+ */
+static uint32_t run_harq(const std::string& radio_device_class_string,
+                         const uint32_t mcs_index,
+                         const std::vector<float>& snr_dB_vec,
+                         const uint32_t N_packets,
+                         srsran_channel_awgn_t& awgn) {
+    const auto rdc = sp3::get_radio_device_class(radio_device_class_string);
+    const auto packet_sizes_maximum = sp3::get_maximum_packet_sizes(radio_device_class_string);
+
+    auto hb_tx = std::make_unique<phy::harq::buffer_tx_t>(
+        phy::harq::buffer_tx_t::COMPONENT_T::TRANSPORT_BLOCK,
+        packet_sizes_maximum.N_TB_byte,
+        packet_sizes_maximum.G,
+        packet_sizes_maximum.C,
+        packet_sizes_maximum.psdef.Z);
+
+    auto hb_rx = std::make_unique<phy::harq::buffer_rx_t>(packet_sizes_maximum.N_TB_byte,
+                                                          packet_sizes_maximum.G,
+                                                          packet_sizes_maximum.C,
+                                                          packet_sizes_maximum.psdef.Z);
+
+    auto fec = std::make_unique<phy::fec_t>(packet_sizes_maximum);
+
+    const uint32_t network_id = 123456789;
+    fec->add_new_network_id(network_id);
+
+    const sp3::packet_sizes_def_t psdef = {.u = 1,
+                                           .b = 1,
+                                           .PacketLengthType = 1,
+                                           .PacketLength = rdc.PacketLength_min,
+                                           .tm_mode_index = 0,
+                                           .mcs_index = mcs_index,
+                                           .Z = rdc.Z_min};
+
+    const auto packet_sizes = sp3::get_packet_sizes(psdef);
+
+    if (!packet_sizes.has_value()) {
+        dectnrp_print_wrn("impossible packet sizes configuration");
+        return N_packets;
+    }
+
+    const uint32_t N_bps = packet_sizes->mcs.N_bps;
+
+    sp3::fec_cfg_t tx_cfg = {.PLCF_type = 2,
+                             .closed_loop = false,
+                             .beamforming = false,
+                             .N_TB_bits = packet_sizes->N_TB_bits,
+                             .N_bps = N_bps,
+                             .rv = 0,
+                             .G = packet_sizes->G,
+                             .network_id = network_id,
+                             .Z = psdef.Z};
+
+    // receiver descrambles while demapping
+    sp3::fec_cfg_t rx_cfg = tx_cfg;
+    rx_cfg.d_descrambled = true;
+
+    uint8_t* const d_unpacked = srsran_vec_u8_malloc(packet_sizes_maximum.G);
+    cf_t* const symbols = srsran_vec_cf_malloc(packet_sizes_maximum.N_PDC_subc);
+    cf_t* const symbols_plus_noise = srsran_vec_cf_malloc(packet_sizes_maximum.N_PDC_subc);
+
+    srsran_modem_table_t modem_table;
+    srsran_modem_table_lte(&modem_table, sp3::fix::get_srsran_mod(N_bps));
+    srsran_modem_table_bytes(&modem_table);
+
+    std::mt19937 generator(mcs_index);
+    std::uniform_int_distribution<uint32_t> byte_dist(0, 255);
+
+    uint32_t packet_error = 0;
+
+    for (uint32_t iter = 0; iter < N_packets; ++iter) {
+        hb_tx->reset_a_cnt_and_softbuffer();
+        hb_rx->reset_a_cnt_and_softbuffer();
+
+        for (uint32_t i = 0; i < packet_sizes->N_TB_byte; ++i) {
+            hb_tx->get_a()[i] = byte_dist(generator);
+        }
+
+        bool packet_correct = false;
+
+        for (std::size_t transmission = 0; transmission < snr_dB_vec.size(); ++transmission) {
+            // same order of redundancy versions as in tb2pdc_awgn
+            tx_cfg.rv = std::array<uint32_t, 4>{0, 2, 3, 1}[transmission % 4];
+            rx_cfg.rv = tx_cfg.rv;
+
+            fec->segmentate_and_pick_scrambling_sequence(tx_cfg);
+            fec->encode_tb(tx_cfg, *hb_tx.get(), tx_cfg.G);
+
+            srsran_bit_unpack_vector(hb_tx->get_d(), d_unpacked, tx_cfg.G);
+            srsran_mod_modulate(&modem_table, d_unpacked, symbols, tx_cfg.G);
+
+            srsran_channel_awgn_set_n0(&awgn, -snr_dB_vec[transmission]);
+            srsran_channel_awgn_run_c(
+                &awgn, symbols, symbols_plus_noise, packet_sizes->N_PDC_subc);
+
+            fec->segmentate_and_pick_scrambling_sequence(rx_cfg);
+
+            phy::demapper::demap_and_descramble(
+                N_bps,
+                symbols_plus_noise,
+                phy::demapper::get_llr_scale(N_bps, snr_dB_vec[transmission]),
+                fec->get_srsran_sequence()->c,
+                reinterpret_cast<PHY_D_RX_DATA_TYPE*>(hb_rx->get_d()),
+                packet_sizes->N_PDC_subc);
+
+            fec->decode_tb(rx_cfg, *hb_rx.get(), rx_cfg.G);
+
+            if (fec->get_decode_tb_status_latest()) {
+                packet_correct = std::equal(
+                    hb_rx->get_a(), hb_rx->get_a() + packet_sizes->N_TB_byte, hb_tx->get_a());
+                break;
+            }
+        }
+
+        if (!packet_correct) {
+            ++packet_error;
+        }
+    }
+
+    srsran_modem_table_free(&modem_table);
+
+    free(d_unpacked);
+    free(symbols);
+    free(symbols_plus_noise);
+
+    return packet_error;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    srsran_channel_awgn_t awgn;
+    srsran_channel_awgn_init(&awgn, 1234);
+
+    bool any_error = false;
+
+    for (const uint32_t N_bps : {1U, 2U, 4U, 6U, 8U}) {
+        if (test_equivalence(N_bps, awgn)) {
+            dectnrp_print_wrn("equivalence test failed for N_bps={}", N_bps);
+            any_error = true;
+        }
+    }
+
+    const std::string rdc_string("1.1.1.A");
+    const uint32_t N_packets = 10;
+
+    // a single transmission at high SNR uses the full scale and decodes for every MCS
+    for (uint32_t mcs_index = 0; mcs_index <= sp3::get_radio_device_class(rdc_string).mcs_index_min;
+         ++mcs_index) {
+        if (run_harq(rdc_string, mcs_index, {30.0f}, N_packets, awgn) != 0) {
+            dectnrp_print_wrn("decoding failed for MCS {}", mcs_index);
+            any_error = true;
+        }
+    }
+
+    // QPSK at rate 1/2, every transmission at 0 dB is demapped with the minimum scale
+    if (run_harq(rdc_string, 1, {0.0f, 0.0f, 0.0f, 0.0f}, N_packets, awgn) > 1) {
+        dectnrp_print_wrn("HARQ combining at minimum scale failed");
+        any_error = true;
+    }
+
+    // a weak first transmission with a small scale must not spoil a strong retransmission
+    if (run_harq(rdc_string, 1, {-5.0f, 25.0f}, N_packets, awgn) != 0) {
+        dectnrp_print_wrn("HARQ combining with different scales failed");
+        any_error = true;
+    }
+
+    srsran_channel_awgn_free(&awgn);
+
+    return any_error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
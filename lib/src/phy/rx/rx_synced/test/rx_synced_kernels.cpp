@@ -0,0 +1,216 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/phy/rx/rx_synced/rx_synced_kernels.hpp"
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "srsran/phy/utils/vector.h"
+}
+
+#include "dectnrp/common/prog/print.hpp"
+
+/* Compares every instantiated kernel against the generic VOLK path of rx_synced_t. The lists of
+ * instantiated dimensions are set by CMake with ENABLE_SPECIALIZED.
+ */
+
+static constexpr uint32_t N_subc{56 * 16 + 1};
+static constexpr float tolerance{1.0e-4f};
+
+static std::mt19937 generator(123);
+
+static void fill_random(cf_t* vec, const uint32_t len) {
+    std::normal_distribution<float> dist(0.0f, 1.0f);
+    for (uint32_t i = 0; i < len; ++i) {
+        vec[i] = cf_t{dist(generator), dist(generator)};
+    }
+}
+
+static bool is_close(const cf_t* a, const cf_t* b, const uint32_t len) {
+    for (uint32_t i = 0; i < len; ++i) {
+        const float err = std::abs(__real__ a[i] - __real__ b[i]) +
+                          std::abs(__imag__ a[i] - __imag__ b[i]);
+        const float mag = std::abs(__real__ b[i]) + std::abs(__imag__ b[i]);
+        if (err > tolerance * std::max(mag, 1.0f)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// same sequence of VOLK calls as rx_synced_t::run_pxx_mrc_compacted()
+static void mrc_generic(cf_t* out,
+                        cf_t* den,
+                        cf_t* stage,
+                        const std::vector<cf_t*>& y,
+                        const std::vector<cf_t*>& h,
+                        const uint32_t offset,
+                        const uint32_t len) {
+    srsran_vec_cf_zero(out, len);
+    srsran_vec_cf_zero(den, len);
+
+    for (uint32_t ant_idx = 0; ant_idx < y.size(); ++ant_idx) {
+        const cf_t* y_mrc = &y[ant_idx][offset];
+        const cf_t* h_mrc = &h[ant_idx][offset];
+
+        volk_32fc_x2_multiply_conjugate_32fc(
+            (lv_32fc_t*)stage, (const lv_32fc_t*)y_mrc, (const lv_32fc_t*)h_mrc, len);
+        volk_32fc_x2_add_32fc((lv_32fc_t*)out, (const lv_32fc_t*)out, (const lv_32fc_t*)stage, len);
+
+        volk_32fc_x2_multiply_conjugate_32fc(
+            (lv_32fc_t*)stage, (const lv_32fc_t*)h_mrc, (const lv_32fc_t*)h_mrc, len);
+        volk_32fc_x2_add_32fc((lv_32fc_t*)den, (const lv_32fc_t*)den, (const lv_32fc_t*)stage, len);
+    }
+
+    volk_32fc_x2_divide_32fc((lv_32fc_t*)out, (const lv_32fc_t*)out, (const lv_32fc_t*)den, len);
+}
+
+static bool test_mrc(const uint32_t N_RX) {
+    const auto mrc_kernel = dectnrp::phy::kernels::get_mrc(N_RX);
+
+    if (mrc_kernel == nullptr) {
+        dectnrp_print_wrn("mrc N_RX={} configured but not instantiated", N_RX);
+        return true;
+    }
+
+    std::vector<cf_t*> y(N_RX), h(N_RX);
+    for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
+        y[ant_idx] = srsran_vec_cf_malloc(N_subc);
+        h[ant_idx] = srsran_vec_cf_malloc(N_subc);
+        fill_random(y[ant_idx], N_subc);
+        fill_random(h[ant_idx], N_subc);
+    }
+
+    cf_t* out_kernel = srsran_vec_cf_malloc(N_subc);
+    cf_t* out_generic = srsran_vec_cf_malloc(N_subc);
+    cf_t* den = srsran_vec_cf_malloc(N_subc);
+    cf_t* stage = srsran_vec_cf_malloc(N_subc);
+
+    bool error = false;
+
+    // runs of different lengths and offsets, including lengths which are not a multiple of blocks
+    for (const uint32_t offset : {0U, 1U, 7U, 28U}) {
+        for (const uint32_t len : {1U, 15U, 16U, 17U, 56U, 100U, N_subc - 28U}) {
+            mrc_kernel(out_kernel, y.data(), h.data(), offset, len);
+            mrc_generic(out_generic, den, stage, y, h, offset, len);
+
+            if (!is_close(out_kernel, out_generic, len)) {
+                dectnrp_print_wrn("mrc N_RX={} offset={} len={} mismatch", N_RX, offset, len);
+                error = true;
+            }
+        }
+    }
+
+    for (uint32_t ant_idx = 0; ant_idx < N_RX; ++ant_idx) {
+        free(y[ant_idx]);
+        free(h[ant_idx]);
+    }
+    free(out_kernel);
+    free(out_generic);
+    free(den);
+    free(stage);
+
+    return error;
+}
+
+#if RX_SYNCED_PARAM_WEIGHTS_TYPE_CHOICE == RX_SYNCED_PARAM_WEIGHTS_TYPE_REAL
+static bool test_interp(const uint32_t nof_drs_subc_interp) {
+    const auto interp_kernel = dectnrp::phy::kernels::get_interp(nof_drs_subc_interp);
+
+    if (interp_kernel == nullptr) {
+        dectnrp_print_wrn("interp nof_drs_subc_interp={} configured but not instantiated",
+                          nof_drs_subc_interp);
+        return true;
+    }
+
+    // DRS cells of two OFDM symbols interlaced, plus weight vectors of a LUT
+    const uint32_t nof_drs_subc = 2 * 14 * 16;
+    const uint32_t nof_weight_vecs = 32;
+
+    cf_t* drs_zf = srsran_vec_cf_malloc(nof_drs_subc);
+    fill_random(drs_zf, nof_drs_subc);
+
+    std::vector<RX_SYNCED_PARAM_LUT_IDX_TYPE> idx_pilot(N_subc), idx_weights(N_subc);
+    std::uniform_int_distribution<uint32_t> dist_pilot(0, nof_drs_subc - nof_drs_subc_interp);
+    std::uniform_int_distribution<uint32_t> dist_weights(0, nof_weight_vecs - 1);
+    for (uint32_t i = 0; i < N_subc; ++i) {
+        idx_pilot[i] = dist_pilot(generator);
+        idx_weights[i] = dist_weights(generator);
+    }
+
+    std::vector<RX_SYNCED_PARAM_WEIGHTS_TYPE> weight_vecs(nof_weight_vecs * nof_drs_subc_interp);
+    std::uniform_real_distribution<float> dist_weight(-1.0f, 1.0f);
+    for (auto& weight : weight_vecs) {
+        weight = dist_weight(generator);
+    }
+
+    cf_t* chestim_kernel = srsran_vec_cf_malloc(N_subc);
+    cf_t* chestim_generic = srsran_vec_cf_malloc(N_subc);
+
+    interp_kernel(
+        chestim_kernel, drs_zf, idx_pilot.data(), idx_weights.data(), weight_vecs.data(), N_subc);
+
+    // same VOLK call per subcarrier as rx_synced_t::run_drs_ch_interpolation()
+    for (uint32_t subc_idx = 0; subc_idx < N_subc; ++subc_idx) {
+        volk_32fc_32f_dot_prod_32fc_u((lv_32fc_t*)&chestim_generic[subc_idx],
+                                      (const lv_32fc_t*)&drs_zf[idx_pilot[subc_idx]],
+                                      &weight_vecs[idx_weights[subc_idx] * nof_drs_subc_interp],
+                                      nof_drs_subc_interp);
+    }
+
+    const bool error = !is_close(chestim_kernel, chestim_generic, N_subc);
+
+    if (error) {
+        dectnrp_print_wrn("interp nof_drs_subc_interp={} mismatch", nof_drs_subc_interp);
+    }
+
+    free(drs_zf);
+    free(chestim_kernel);
+    free(chestim_generic);
+
+    return error;
+}
+#endif
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    bool any_error = false;
+
+#ifdef PHY_KERNELS_N_RX
+    for (const uint32_t N_RX : {PHY_KERNELS_N_RX}) {
+        any_error = test_mrc(N_RX) || any_error;
+    }
+#endif
+
+#if defined(PHY_KERNELS_NOF_DRS_INTERP) && \
+    RX_SYNCED_PARAM_WEIGHTS_TYPE_CHOICE == RX_SYNCED_PARAM_WEIGHTS_TYPE_REAL
+    for (const uint32_t nof_drs_subc_interp : {PHY_KERNELS_NOF_DRS_INTERP}) {
+        any_error = test_interp(nof_drs_subc_interp) || any_error;
+    }
+#endif
+
+    return any_error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
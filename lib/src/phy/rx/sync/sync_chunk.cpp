@@ -23,6 +23,7 @@
 #include <algorithm>
 
 #include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/prog/trace.hpp"
 #include "dectnrp/phy/resample/resampler_param.hpp"
 #include "dectnrp/phy/rx/sync/sync_param.hpp"
 #include "dectnrp/sections_part3/stf.hpp"
@@ -166,6 +167,8 @@ std::optional<sync_report_t> sync_chunk_t::search() {
         if (autocorrelator_detection->search_by_correlation(localbuffer_cnt_w, sync_report)) {
             ++stats.detections;
 
+            dectnrp_trace_begin(tsc_detection);
+
             /// \todo add u detection to correlator
             // For now we set the value of u to the maximum of the radio device class. Ideally, the
             // current of value of u would be provided by the detector.
@@ -256,6 +259,8 @@ std::optional<sync_report_t> sync_chunk_t::search() {
                     static_cast<int64_t>(crosscorrelator->search_length_l) +
                     static_cast<int64_t>(sync_report.fine_peak_time_local);
 
+                dectnrp_trace_end(tsc_detection, detection, sync_report.fine_peak_time_64);
+
                 return sync_report;
             } else {
                 // reset all values of sync_report
@@ -305,6 +310,8 @@ void sync_chunk_t::wait_for_chunk_nto() {
 
     wait_until_nto(chunk_time_start_64);
 
+    dectnrp_trace_instant(chunk_ready, chunk_time_start_64);
+
     autocorrelator_detection->set_power_of_first_stf_pattern(
         resample_until_nto(stf_bos_pattern_length_samples));
 }
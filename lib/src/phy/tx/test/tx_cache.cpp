@@ -0,0 +1,159 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/phy/harq/process_pool.hpp"
+#include "dectnrp/phy/tx/tx_cache.hpp"
+#include "dectnrp/phy/tx/tx_descriptor.hpp"
+#include "dectnrp/sections_part3/derivative/packet_sizes.hpp"
+
+using namespace dectnrp;
+
+static constexpr uint32_t N_TX{2};
+static constexpr uint32_t N_samples{64};
+
+/// samples which identify the packet they were inserted for
+static std::vector<std::vector<radio::cf32_t>> get_samples(const uint32_t tag) {
+    std::vector<std::vector<radio::cf32_t>> samples(N_TX, std::vector<radio::cf32_t>(N_samples));
+
+    for (uint32_t i = 0; i < N_TX; ++i) {
+        for (uint32_t j = 0; j < N_samples; ++j) {
+            samples[i][j] = radio::cf32_t{static_cast<float>(tag), static_cast<float>(i * j)};
+        }
+    }
+
+    return samples;
+}
+
+static void insert(phy::tx_cache_t& tx_cache, const uint32_t tag) {
+    auto samples = get_samples(tag);
+
+    std::vector<radio::cf32_t*> ant_streams;
+    for (auto& elem : samples) {
+        ant_streams.push_back(elem.data());
+    }
+
+    tx_cache.insert(ant_streams, N_TX, N_samples);
+}
+
+/// true if the entry of the last key set is missing or does not hold the samples of tag
+static bool is_not_hit(phy::tx_cache_t& tx_cache, const uint32_t tag) {
+    const auto* entry = tx_cache.find();
+
+    if (entry == nullptr) {
+        return true;
+    }
+
+    return entry->N_samples != N_samples || entry->ant_streams != get_samples(tag);
+}
+
+static bool test_hit_miss_eviction() {
+    const auto packet_sizes_maximum = sp3::get_maximum_packet_sizes("1.1.1.A");
+
+    phy::harq::process_pool_t hpp(packet_sizes_maximum, 1, 1);
+
+    auto* hp_tx = hpp.get_process_tx(
+        1, 0x12345678, packet_sizes_maximum.psdef, phy::harq::finalize_tx_t::reset_and_terminate);
+
+    if (hp_tx == nullptr) {
+        dectnrp_print_wrn("HARQ process TX unavailable");
+        return true;
+    }
+
+    const uint32_t N_TB_byte = hp_tx->get_packet_sizes().N_TB_byte;
+    for (uint32_t i = 0; i < N_TB_byte; ++i) {
+        hp_tx->get_a_tb()[i] = static_cast<uint8_t>(i);
+    }
+
+    const phy::tx_meta_t tx_meta = {.optimal_scaling_DAC = false,
+                                    .DAC_scale = 1.0f,
+                                    .iq_phase_rad = 0.0f,
+                                    .iq_phase_increment_s2s_post_resampling_rad = 0.0f,
+                                    .GI_percentage = 5,
+                                    .cacheable = true};
+
+    const phy::tx_descriptor_t tx_descriptor(*hp_tx, 0, tx_meta, radio::buffer_tx_meta_t());
+
+    phy::tx_cache_t tx_cache(2);
+
+    // packets A, B and C only differ in the first TB byte
+    const auto set_key = [&](const uint8_t first_byte) {
+        hp_tx->get_a_tb()[0] = first_byte;
+        tx_cache.set_key(tx_descriptor);
+    };
+
+    bool any_error = false;
+
+    // A: empty cache misses, then hits after insertion
+    set_key(0xa);
+    any_error |= tx_cache.find() != nullptr;
+    insert(tx_cache, 0xa);
+    set_key(0xa);
+    any_error |= is_not_hit(tx_cache, 0xa);
+
+    // B: differs from A in a single TB byte
+    set_key(0xb);
+    any_error |= tx_cache.find() != nullptr;
+    insert(tx_cache, 0xb);
+
+    // same content as A but a different DAC scale
+    const phy::tx_meta_t tx_meta_scaled = {.optimal_scaling_DAC = false,
+                                           .DAC_scale = 0.5f,
+                                           .iq_phase_rad = 0.0f,
+                                           .iq_phase_increment_s2s_post_resampling_rad = 0.0f,
+                                           .GI_percentage = 5,
+                                           .cacheable = true};
+    hp_tx->get_a_tb()[0] = 0xa;
+    tx_cache.set_key(phy::tx_descriptor_t(*hp_tx, 0, tx_meta_scaled, radio::buffer_tx_meta_t()));
+    any_error |= tx_cache.find() != nullptr;
+
+    // A is used again, so B becomes the least recently used entry
+    set_key(0xa);
+    any_error |= is_not_hit(tx_cache, 0xa);
+
+    // C evicts B
+    set_key(0xc);
+    any_error |= tx_cache.find() != nullptr;
+    insert(tx_cache, 0xc);
+
+    set_key(0xb);
+    any_error |= tx_cache.find() != nullptr;
+    set_key(0xa);
+    any_error |= is_not_hit(tx_cache, 0xa);
+    set_key(0xc);
+    any_error |= is_not_hit(tx_cache, 0xc);
+
+    hp_tx->finalize();
+
+    return any_error;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    if (test_hit_miss_eviction()) {
+        dectnrp_print_wrn("tx_cache_t hit, miss or eviction incorrect");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
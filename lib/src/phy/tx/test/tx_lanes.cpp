@@ -0,0 +1,183 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "dectnrp/common/adt/freq_shift.hpp"
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/phy/harq/process_pool.hpp"
+#include "dectnrp/phy/phy_config.hpp"
+#include "dectnrp/phy/resample/resampler.hpp"
+#include "dectnrp/phy/tx/tx.hpp"
+#include "dectnrp/phy/tx/tx_descriptor.hpp"
+#include "dectnrp/radio/buffer_tx_pool.hpp"
+#include "dectnrp/sections_part3/derivative/packet_sizes.hpp"
+
+namespace dectnrp::radio {
+
+/// takes the role of the radio thread and copies the samples of a transmittable buffer
+class buffer_tx_reader_test_t {
+    public:
+        static std::vector<std::vector<cf32_t>> pop(buffer_tx_pool_t& buffer_tx_pool) {
+            const int32_t idx =
+                buffer_tx_pool.pop_earliest_before(std::numeric_limits<int64_t>::max());
+
+            if (idx < 0) {
+                return {};
+            }
+
+            auto& buffer_tx = *buffer_tx_pool.buffer_tx_vec[idx];
+
+            const uint32_t tx_length_samples =
+                buffer_tx.tx_length_samples.load(std::memory_order_acquire);
+
+            std::vector<std::vector<cf32_t>> samples;
+            for (const auto* ant_stream : buffer_tx.ant_streams) {
+                samples.emplace_back(ant_stream, ant_stream + tx_length_samples);
+            }
+
+            buffer_tx.set_transmitted_or_abort();
+
+            return samples;
+        }
+};
+
+}  // namespace dectnrp::radio
+
+using namespace dectnrp;
+
+static constexpr uint32_t network_id{0x12345678};
+
+/// IQ samples of one packet per antenna for every packet definition
+using samples_t = std::vector<std::vector<std::vector<radio::cf32_t>>>;
+
+static samples_t generate(const std::string& radio_device_class_string,
+                          const std::vector<sp3::packet_sizes_def_t>& psdef_vec,
+                          const uint32_t N_TX_per_lane) {
+    const auto packet_sizes_maximum = sp3::get_maximum_packet_sizes(radio_device_class_string);
+
+    phy::harq::process_pool_t hpp(packet_sizes_maximum, 1, 1);
+
+    // resampling and frequency shift are applied per lane
+    const uint32_t os_min = 2;
+    const uint32_t dect_samp_rate_os = packet_sizes_maximum.numerology.B_u_b_DFT * os_min;
+    const uint32_t hw_samp_rate =
+        phy::resampler_t::get_samp_rate_converted_with_temporary_overflow(dect_samp_rate_os, 10, 9);
+    const auto resampler_param =
+        phy::phy_config_t::get_resampler_param_verified(hw_samp_rate, dect_samp_rate_os, true);
+
+    radio::buffer_tx_pool_t buffer_tx_pool(
+        0,
+        packet_sizes_maximum.tm_mode.N_TX,
+        1,
+        sp3::get_N_samples_in_packet_length_max(packet_sizes_maximum, hw_samp_rate));
+
+    phy::tx_t tx(packet_sizes_maximum, os_min, resampler_param, {}, N_TX_per_lane);
+    tx.add_new_network_id(network_id);
+
+    const phy::tx_meta_t tx_meta = {
+        .optimal_scaling_DAC = false,
+        .DAC_scale = 1.0f,
+        .iq_phase_rad = 0.5f,
+        .iq_phase_increment_s2s_post_resampling_rad =
+            common::adt::get_sample2sample_phase_inc(100.0e3f, hw_samp_rate),
+        .GI_percentage = 10,
+        .cacheable = false};
+
+    samples_t samples;
+
+    for (const auto& psdef : psdef_vec) {
+        auto* hp_tx =
+            hpp.get_process_tx(1, network_id, psdef, phy::harq::finalize_tx_t::reset_and_terminate);
+
+        if (hp_tx == nullptr) {
+            return {};
+        }
+
+        for (uint32_t i = 0; i < constants::plcf_type_2_byte; ++i) {
+            hp_tx->get_a_plcf()[i] = static_cast<uint8_t>(i * 7);
+        }
+
+        for (uint32_t i = 0; i < hp_tx->get_packet_sizes().N_TB_byte; ++i) {
+            hp_tx->get_a_tb()[i] = static_cast<uint8_t>(i * 13);
+        }
+
+        const phy::tx_descriptor_t tx_descriptor(*hp_tx, 0, tx_meta, radio::buffer_tx_meta_t());
+
+        auto* buffer_tx = buffer_tx_pool.get_buffer_tx_to_fill(
+            tx.get_N_samples_buffer_tx(hp_tx->get_packet_sizes()));
+
+        if (buffer_tx == nullptr) {
+            hp_tx->finalize();
+            return {};
+        }
+
+        tx.generate_tx_packet(tx_descriptor, *buffer_tx);
+
+        hp_tx->finalize();
+
+        samples.push_back(radio::buffer_tx_reader_test_t::pop(buffer_tx_pool));
+    }
+
+    return samples;
+}
+
+/// the same packets generated with one lane and with several lanes have identical IQ samples
+static bool test_lanes_identical(const std::string& radio_device_class_string) {
+    const auto packet_sizes_maximum = sp3::get_maximum_packet_sizes(radio_device_class_string);
+
+    const uint32_t N_TX_max = packet_sizes_maximum.tm_mode.N_TX;
+
+    // all antennas, two antennas and lanes without antennas, one beamformed stream on all antennas
+    std::vector<sp3::packet_sizes_def_t> psdef_vec(3, packet_sizes_maximum.psdef);
+    psdef_vec[1].tm_mode_index = 3;
+    psdef_vec[2].tm_mode_index = 7;
+
+    const auto samples_single = generate(radio_device_class_string, psdef_vec, N_TX_max);
+
+    if (samples_single.size() != psdef_vec.size()) {
+        dectnrp_print_wrn("packet generation failed");
+        return true;
+    }
+
+    for (const uint32_t N_TX_per_lane : {phy::tx_t::get_N_TX_per_lane(N_TX_max), 1U}) {
+        if (generate(radio_device_class_string, psdef_vec, N_TX_per_lane) != samples_single) {
+            dectnrp_print_wrn("{} antennas per lane differ from a single lane", N_TX_per_lane);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    for (const auto rdc : {"1.8.4.A", "2.12.8.A"}) {
+        if (test_lanes_identical(rdc)) {
+            dectnrp_print_wrn("TX antenna lanes test failed for {}", rdc);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
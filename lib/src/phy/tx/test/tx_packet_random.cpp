@@ -72,7 +72,8 @@ int generate_random_TX_packet_within_rdc_limits(std::string radio_device_class_s
     }
 
     // initial configuration of hardware (only set fields required, usually read from file)
-    const dectnrp::radio::hw_config_t hw_config = {.nof_buffer_tx = 1, .rx_prestream_ms = 0};
+    const dectnrp::radio::hw_config_t hw_config = {.nof_buffer_tx_max_length = 1,
+                                                   .rx_prestream_ms = 0};
     dectnrp::radio::hw_config_t::sim_samp_rate_lte = (L == 1) ? false : true;
 
     // create dummy virtual space (required to initialize hw_simulator)
@@ -160,7 +161,7 @@ int generate_random_TX_packet_within_rdc_limits(std::string radio_device_class_s
 
     // define additional radio layer packet metadata
     const dectnrp::radio::buffer_tx_meta_t buffer_tx_meta = {
-        .tx_order_id = 0, .tx_order_id_expect_next = -1, .tx_time_64 = 0, .busy_wait_us = 0};
+        .tx_order_id = 0, .tx_time_64 = 0, .busy_wait_us = 0};
 
     const uint32_t N_packets = 2;
 
@@ -208,7 +209,8 @@ int generate_random_TX_packet_within_rdc_limits(std::string radio_device_class_s
             const dectnrp::phy::tx_descriptor_t tx_descriptor(
                 *hp_tx, codebook_index, tx_meta, buffer_tx_meta);
 
-            auto* buffer_tx = hw->buffer_tx_pool->get_buffer_tx_to_fill();
+            auto* buffer_tx = hw->buffer_tx_pool->get_buffer_tx_to_fill(
+                tx->get_N_samples_buffer_tx(hp_tx->get_packet_sizes()));
 
             dectnrp_assert(buffer_tx != nullptr, "buffer unavailable");
 
@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <utility>
 
 extern "C" {
 #include "srsran/phy/utils/vector.h"
@@ -46,9 +47,14 @@ static std::atomic<uint32_t> json_file_cnt{0};
 
 namespace dectnrp::phy {
 
+/// number of polls before a lane waiting for other lanes is put to sleep
+static constexpr uint32_t lane_spin_max{1024};
+
 tx_t::tx_t(const sp3::packet_sizes_t maximum_packet_sizes_,
            const uint32_t os_min_,
-           resampler_param_t resampler_param_)
+           resampler_param_t resampler_param_,
+           const std::vector<common::threads_core_prio_config_t>& lane_helper_config_vec_,
+           const uint32_t N_TX_per_lane_)
     : tx_rx_t(maximum_packet_sizes_, os_min_, resampler_param_) {
     // srsran does not include 1024-QAM, unreasonable anyway, maximum MCS index is 9 (256-QAM at
     // R=5/6)
@@ -87,14 +93,33 @@ tx_t::tx_t(const sp3::packet_sizes_t maximum_packet_sizes_,
     const uint32_t N_b_DFT_os_min =
         dect_samp_rate_oversampled_max / (constants::subcarrier_spacing_min_u_b * u_max);
 
-    resampler = std::make_unique<resampler_t>(
-        maximum_packet_sizes.tm_mode.N_TX,
-        resampler_param.L,
-        resampler_param.M,
-        resampler_param_t::f_pass_norm[resampler_param_t::user_t::TX][os_min],
-        resampler_param_t::f_stop_norm[resampler_param_t::user_t::TX][os_min],
-        resampler_param_t::PASSBAND_RIPPLE_DONT_CARE,
-        resampler_param_t::f_stop_att_dB[resampler_param_t::user_t::TX][os_min]);
+    const uint32_t N_TX_max = maximum_packet_sizes.tm_mode.N_TX;
+
+    const uint32_t N_TX_per_lane =
+        N_TX_per_lane_ > 0 ? N_TX_per_lane_ : get_N_TX_per_lane(N_TX_max);
+
+    dectnrp_assert(N_TX_per_lane <= N_TX_max, "more antennas per lane than antennas");
+
+    for (uint32_t ant_first = 0; ant_first < N_TX_max; ant_first += N_TX_per_lane) {
+        auto& lane = lane_vec.emplace_back(std::make_unique<lane_t>());
+
+        lane->tx = this;
+        lane->ant_first = ant_first;
+        lane->N_TX_max = std::min(N_TX_per_lane, N_TX_max - ant_first);
+        lane->N_TX = 0;
+        lane->resampler = std::make_unique<resampler_t>(
+            lane->N_TX_max,
+            resampler_param.L,
+            resampler_param.M,
+            resampler_param_t::f_pass_norm[resampler_param_t::user_t::TX][os_min],
+            resampler_param_t::f_stop_norm[resampler_param_t::user_t::TX][os_min],
+            resampler_param_t::PASSBAND_RIPPLE_DONT_CARE,
+            resampler_param_t::f_stop_att_dB[resampler_param_t::user_t::TX][os_min]);
+        lane->N_new_output_samples = 0;
+    }
+
+    // all resamplers are identical
+    const auto& resampler = lane_vec[0]->resampler;
 
     /* The resampler must be callable for every single OFDM symbol. Therefore, it cannot require
      * more than the minimum number of samples per OFDM symbol for one call.
@@ -116,6 +141,7 @@ tx_t::tx_t(const sp3::packet_sizes_t maximum_packet_sizes_,
 
     for (uint32_t i = 0; i < maximum_packet_sizes.tm_mode.N_TX; ++i) {
         antenna_mapper_stage.push_back(srsran_vec_cf_malloc(N_b_DFT_os_max));
+        antenna_mapper_stage_lanes.push_back(srsran_vec_cf_malloc(N_b_DFT_os_max));
     }
 
     // see 6.3.6 in part 3
@@ -133,10 +159,48 @@ tx_t::tx_t(const sp3::packet_sizes_t maximum_packet_sizes_,
     }
 
     antenna_ports.resize(maximum_packet_sizes.tm_mode.N_TX);
-    antenna_ports_now.resize(maximum_packet_sizes.tm_mode.N_TX);
+
+    for (auto& lane : lane_vec) {
+        for (uint32_t i = 0; i < lane->N_TX_max; ++i) {
+            lane->ifft_cp_stage.push_back(ifft_cp_stage[lane->ant_first + i]);
+        }
+        lane->antenna_ports_now.reserve(lane->N_TX_max);
+    }
+
+    dectnrp_assert(lane_helper_config_vec_.empty() ||
+                       lane_helper_config_vec_.size() == lane_vec.size() - 1,
+                   "number of helper thread configurations {} does not match number of lanes {}",
+                   lane_helper_config_vec_.size(),
+                   lane_vec.size());
+
+    // lane 0 is processed by the thread calling generate_tx_packet()
+    lane_keep_running.store(true, std::memory_order_release);
+    for (uint32_t i = 1; i < lane_vec.size(); ++i) {
+        const common::threads_core_prio_config_t lane_helper_config =
+            lane_helper_config_vec_.empty() ? common::threads_core_prio_config_t()
+                                            : lane_helper_config_vec_[i - 1];
+
+        if (!common::threads_new_rt_mask_custom(
+                &lane_vec[i]->thread, &lane_spawn, lane_vec[i].get(), lane_helper_config)) {
+            dectnrp_assert_failure("TX unable to start lane helper thread");
+        }
+    }
+
+#ifdef PHY_TX_WAVEFORM_CACHE
+    tx_cache = std::make_unique<tx_cache_t>(PHY_TX_WAVEFORM_CACHE);
+#endif
 }
 
 tx_t::~tx_t() {
+    // a changed generation without keep_running makes helper threads leave their loop
+    lane_keep_running.store(false, std::memory_order_release);
+    lane_generation.fetch_add(1, std::memory_order_release);
+    lane_generation.notify_all();
+
+    for (uint32_t i = 1; i < lane_vec.size(); ++i) {
+        pthread_join(lane_vec[i]->thread, nullptr);
+    }
+
     for (auto& elem : srsran_modem_table) {
         srsran_modem_table_free(&elem);
     }
@@ -157,6 +221,10 @@ tx_t::~tx_t() {
         free(elem);
     }
 
+    for (auto& elem : antenna_mapper_stage_lanes) {
+        free(elem);
+    }
+
     for (auto& elem : ifft_cp_stage) {
         free(elem);
     }
@@ -172,6 +240,12 @@ void tx_t::generate_tx_packet(const tx_descriptor_t& tx_descriptor_,
     hb_tb = tx_descriptor_.hp_tx.get_hb_tb();
     buffer_tx = &buffer_tx_;
 
+#ifdef PHY_TX_WAVEFORM_CACHE
+    if (tx_meta->cacheable && run_waveform_cache_lookup()) {
+        return;
+    }
+#endif
+
     run_packet_dimensions();
 
     // set FEC configuration
@@ -190,10 +264,12 @@ void tx_t::generate_tx_packet(const tx_descriptor_t& tx_descriptor_,
     // antenna_ports points to front of all antennas
     buffer_tx->get_ant_streams(antenna_ports, N_samples_transmit_os_rs);
 
-    // antenna_ports_now points to current samples of the antennas we use
-    antenna_ports_now.resize(packet_sizes->tm_mode.N_TX);
-    for (uint32_t i = 0; i < packet_sizes->tm_mode.N_TX; ++i) {
-        antenna_ports_now[i] = antenna_ports[i];
+    // antenna_ports_now of every lane points to current samples of the antennas we use
+    for (auto& lane : lane_vec) {
+        lane->antenna_ports_now.resize(lane->N_TX);
+        for (uint32_t i = 0; i < lane->N_TX; ++i) {
+            lane->antenna_ports_now[i] = antenna_ports[lane->ant_first + i];
+        }
     }
 
     fec->segmentate_and_pick_scrambling_sequence(fec_cfg);
@@ -213,64 +289,34 @@ void tx_t::generate_tx_packet(const tx_descriptor_t& tx_descriptor_,
     // create 98 complex QPSK symbols
     run_pcc_symbol_mapper_and_flipper();
 
-    // flush for STF
-    run_zero_stages();
-
-    // load correct STF and copy into first transmit stream
-    run_stf();
-
-    // for STF, only the first transmit stream is non zero, therefore 1
-    run_beamforming(1);
-
-    // STF has a longer CP and a different scaling than any of the other OFDM symbols
-    run_ifft_cp_scale(N_samples_STF_CP_only_os, final_scale_STF);
-
-    // proposed in 2023 to improve performance in low SNR and high CFO regimes
-    sp3::stf_t::apply_cover_sequence(
-        ifft_cp_stage,
-        ifft_cp_stage,
-        tm_mode.N_TX,
-        packet_sizes->psdef.u,
-        constants::N_samples_stf_pattern * packet_sizes->psdef.b * N_b_DFT_os / N_b_DFT);
-
-    // length of STF CP must be known to resample the right amount of samples
-    run_resampling_and_freq_shift(N_samples_STF_CP_only_os);
-
-#ifdef PHY_TX_BACKPRESSURED_OR_PACKET_IS_ALWAYS_COMPLETE
-    // notify radio layer of how many samples are now valid
-    buffer_tx->set_tx_length_samples_cnt(index_sample_transmit_os_rs);
-#endif
-
-    // OFDM symbol by symbol loop excluding STF and GI
-    for (ofdm_symb_idx = 1; ofdm_symb_idx <= packet_sizes->N_DF_symb; ++ofdm_symb_idx) {
-        run_zero_stages();
-
-        // assume one spatial stream for PCC, apply transmit diversity coding and copy into transmit
-        // streams
-        if (pcc.is_symbol_index(ofdm_symb_idx)) {
-            run_pcc();
-        }
+    // STF is OFDM symbol index 0, mapped and beamformed before the loop
+    ofdm_symb_idx = 0;
+    run_frequency_domain();
 
-        // copy DRS symbols into transmit streams
-        if (drs.is_symbol_index(ofdm_symb_idx)) {
-            run_drs();
+    /* OFDM symbol by symbol loop including STF and excluding GI. While the lanes convert symbol
+     * symb_idx to time domain, the frequency domain of the next symbol is generated, which
+     * includes running the FEC codeblock for codeblock.
+     */
+    for (uint32_t symb_idx = 0; symb_idx <= packet_sizes->N_DF_symb; ++symb_idx) {
+        // stages of the current symbol are handed over to the lanes
+        std::swap(antenna_mapper_stage, antenna_mapper_stage_lanes);
+
+        // STF has a longer CP and a different scaling than any of the other OFDM symbols
+        if (symb_idx == 0) {
+            run_lanes_dispatch(lane_job_t{N_samples_STF_CP_only_os, final_scale_STF, true, false});
+        } else {
+            run_lanes_dispatch(lane_job_t{N_b_CP_os, final_scale, false, false});
         }
 
-        // If transmit diversity coding is used, we have only one spatial stream. Apply transmit
-        // diversity coding and copy into transmit streams. For any other mode, apply stream
-        // demultiplexing (trivial if SISO) and copy spatial streams directly into transmit streams.
-        if (pdc.is_symbol_index(ofdm_symb_idx)) {
-            run_pdc();
+        if (symb_idx < packet_sizes->N_DF_symb) {
+            ofdm_symb_idx = symb_idx + 1;
+            run_frequency_domain();
         }
 
-        // transmit streams are filled with PCC, DRS and PDC, so now beamform entire OFDM symbol
-        run_beamforming(tm_mode.N_TS);
-
-        // scale in frequency domain, execute IFFT and insert CP
-        run_ifft_cp_scale(N_b_CP_os, final_scale);
+        // scale in frequency domain, execute IFFT, insert CP, resample and frequency shift
+        run_lanes_join();
 
-        // resample from DECT NR+ sample rate to hardware sample rate and write into output buffer
-        run_resampling_and_freq_shift(N_b_CP_os);
+        run_back_end_advance();
 
 #ifdef PHY_TX_BACKPRESSURED_OR_PACKET_IS_ALWAYS_COMPLETE
         // notify radio layer of how many samples are now valid
@@ -288,6 +334,15 @@ void tx_t::generate_tx_packet(const tx_descriptor_t& tx_descriptor_,
     write_all_data_to_json();
 #endif
 
+#ifdef PHY_TX_WAVEFORM_CACHE
+    /* Key was set during lookup. Samples must be copied before the final sample count is
+     * published, afterwards the radio layer may transmit and recycle buffer_tx at any time.
+     */
+    if (tx_meta->cacheable) {
+        tx_cache->insert(antenna_ports, tm_mode.N_TX, N_samples_transmit_os_rs);
+    }
+#endif
+
     // tell tx buffer that all samples were written
     buffer_tx->set_tx_length_samples_cnt(N_samples_transmit_os_rs);
 
@@ -386,6 +441,9 @@ void tx_t::write_all_data_to_json() const {
     j_packet_data["resampling"]["L"] = resampler_param.L;
     j_packet_data["resampling"]["M"] = resampler_param.M;
 
+    // all lanes use identical resamplers
+    const auto& resampler = lane_vec[0]->resampler;
+
     j_packet_data["resampling"]["f_pass_norm"] = resampler->f_pass_norm;
     j_packet_data["resampling"]["f_stop_norm"] = resampler->f_stop_norm;
     j_packet_data["resampling"]["passband_ripple_dB"] = resampler->passband_ripple_dB;
@@ -426,6 +484,40 @@ void tx_t::write_all_data_to_json() const {
 }
 #endif
 
+uint32_t tx_t::get_N_samples_buffer_tx(const sp3::packet_sizes_t& packet_sizes_) const {
+    // same dimensions as in run_packet_dimensions() and run_meta_dependencies()
+    const uint32_t N_b_DFT_os_ =
+        dect_samp_rate_oversampled_max / packet_sizes_.numerology.delta_u_f;
+
+    const uint32_t N_samples_packet_no_GI_os_ =
+        packet_sizes_.N_samples_packet_no_GI * N_b_DFT_os_ / packet_sizes_.numerology.N_b_DFT;
+
+    const uint32_t N_samples_packet_os_ =
+        packet_sizes_.N_samples_packet * N_b_DFT_os_ / packet_sizes_.numerology.N_b_DFT;
+
+    const uint32_t N_samples_packet_os_rs_ =
+        (N_samples_packet_os_ / resampler_param.M) * resampler_param.L;
+
+    // final samples of the resampler can be written beyond the end of the packet without GI
+    return std::max(N_samples_packet_os_rs_,
+                    lane_vec[0]->resampler->get_N_samples_after_resampling(
+                        N_samples_packet_no_GI_os_));
+}
+
+uint32_t tx_t::get_N_TX_per_lane(const uint32_t N_TX_max) {
+#ifdef PHY_TX_ANTENNA_LANES_MIN_N_TX
+    if (N_TX_max >= PHY_TX_ANTENNA_LANES_MIN_N_TX) {
+        return PHY_TX_ANTENNA_LANE_N_TX;
+    }
+#endif
+
+    return N_TX_max;
+}
+
+uint32_t tx_t::get_nof_lanes(const uint32_t N_TX_max) {
+    return common::adt::ceil_divide_integer(N_TX_max, get_N_TX_per_lane(N_TX_max));
+}
+
 void tx_t::run_packet_dimensions() {
     dectnrp_assert(packet_sizes->psdef.Z == maximum_packet_sizes.psdef.Z,
                    "Z not the same as in RDC");
@@ -528,7 +620,8 @@ void tx_t::run_meta_dependencies() {
         N_samples_packet_no_GI_os * resampler_param.L, resampler_param.M);
 
     dectnrp_assert(N_samples_packet_no_GI_os_rs <=
-                       resampler->get_N_samples_after_resampling(N_samples_packet_no_GI_os),
+                       lane_vec[0]->resampler->get_N_samples_after_resampling(
+                           N_samples_packet_no_GI_os),
                    "resampler creates less samples than required for packet without GI");
 
     // packet length with GI after oversampling
@@ -565,7 +658,7 @@ void tx_t::run_meta_dependencies() {
     dectnrp_assert(N_samples_transmit_os_rs <= N_samples_packet_os_rs,
                    "transmission length too long");
 
-    dectnrp_assert(N_samples_packet_os_rs <= buffer_tx->ant_streams_length_samples,
+    dectnrp_assert(N_samples_packet_os_rs <= buffer_tx->get_ant_streams_length_samples(),
                    "packet length with GI too long");
 
     dectnrp_assert(tm_mode.N_TX <= buffer_tx->nof_antennas, "nof antennas larger than buffer_tx");
@@ -593,10 +686,20 @@ void tx_t::run_meta_dependencies() {
     final_scale_STF = 1.0f / std::sqrt(float(N_b_OCC / 4)) * scale_common;
     final_scale = 1.0f / std::sqrt(float(N_b_OCC)) * scale_common;
 
-    resampler->reset();
+    // every lane starts with the same state, lanes without antennas in use stay idle
+    N_lanes_active = 0;
+    for (auto& lane : lane_vec) {
+        lane->N_TX = tm_mode.N_TX > lane->ant_first
+                         ? std::min(tm_mode.N_TX - lane->ant_first, lane->N_TX_max)
+                         : 0;
+
+        N_lanes_active += (lane->N_TX > 0) ? 1 : 0;
 
-    mixer.set_phase(tx_meta->iq_phase_rad);
-    mixer.set_phase_increment(tx_meta->iq_phase_increment_s2s_post_resampling_rad);
+        lane->resampler->reset();
+
+        lane->mixer.set_phase(tx_meta->iq_phase_rad);
+        lane->mixer.set_phase_increment(tx_meta->iq_phase_increment_s2s_post_resampling_rad);
+    }
 }
 
 void tx_t::run_pcc_symbol_mapper_and_flipper() {
@@ -677,11 +780,11 @@ void tx_t::run_pcc_symbol_mapper_and_flipper() {
 }
 
 void tx_t::run_residual_resampling() {
-    // resample final samples
-    uint32_t N_new_output_samples = resampler->resample_final_samples(antenna_ports_now);
+    // resample final samples and apply frequency shift
+    run_lanes_dispatch(lane_job_t{0, 0.0f, false, true});
+    run_lanes_join();
 
-    // apply frequency shift
-    mixer.mix_phase_continuous(antenna_ports_now, antenna_ports_now, N_new_output_samples);
+    const uint32_t N_new_output_samples = lane_vec[0]->N_new_output_samples;
 
     // zero same amount of samples in unused antenna streams
     for (uint32_t i = tm_mode.N_TX; i < antenna_ports.size(); ++i) {
@@ -692,9 +795,9 @@ void tx_t::run_residual_resampling() {
         N_samples_packet_no_GI_os_rs <= index_sample_transmit_os_rs + N_new_output_samples,
         "not enough samples resampled");
 
-    dectnrp_assert(
-        index_sample_transmit_os_rs + N_new_output_samples <= buffer_tx->ant_streams_length_samples,
-        "too many samples resampled");
+    dectnrp_assert(index_sample_transmit_os_rs + N_new_output_samples <=
+                       buffer_tx->get_ant_streams_length_samples(),
+                   "too many samples resampled");
 
     /* At this point, we have resampled the final samples of the resampler and written them to the
      * output buffer. We also made sure we wrote enought samples. We can savely overwrite the value
@@ -713,6 +816,29 @@ void tx_t::run_GI() {
     index_sample_transmit_os_rs += N_samples_transmit_os_rs - N_samples_packet_no_GI_os_rs;
 }
 
+#ifdef PHY_TX_WAVEFORM_CACHE
+bool tx_t::run_waveform_cache_lookup() {
+    tx_cache->set_key(*tx_descriptor);
+
+    const auto* entry = tx_cache->find();
+
+    if (entry == nullptr) {
+        return false;
+    }
+
+    buffer_tx->get_ant_streams(antenna_ports, entry->N_samples);
+
+    for (uint32_t i = 0; i < entry->ant_streams.size(); ++i) {
+        radio::cf32_copy(antenna_ports[i], entry->ant_streams[i].data(), entry->N_samples);
+    }
+
+    buffer_tx->set_tx_length_samples_cnt(entry->N_samples);
+    buffer_tx->set_transmittable(tx_descriptor->buffer_tx_meta);
+
+    return true;
+}
+#endif
+
 void tx_t::run_zero_stages() {
     // zero only transmit streams in use
     for (uint32_t i = 0; i < tm_mode.N_TS; ++i) {
@@ -859,27 +985,131 @@ void tx_t::run_beamforming(const uint32_t N_TS_non_zero) {
     }
 }
 
-void tx_t::run_ifft_cp_scale(const uint32_t N_samples_in_CP_os, float scale) {
+void tx_t::run_frequency_domain() {
+    run_zero_stages();
+
+    if (ofdm_symb_idx == 0) {
+        // load correct STF and copy into first transmit stream
+        run_stf();
+
+        // for STF, only the first transmit stream is non zero, therefore 1
+        run_beamforming(1);
+
+        return;
+    }
+
+    // assume one spatial stream for PCC, apply transmit diversity coding and copy into transmit
+    // streams
+    if (pcc.is_symbol_index(ofdm_symb_idx)) {
+        run_pcc();
+    }
+
+    // copy DRS symbols into transmit streams
+    if (drs.is_symbol_index(ofdm_symb_idx)) {
+        run_drs();
+    }
+
+    // If transmit diversity coding is used, we have only one spatial stream. Apply transmit
+    // diversity coding and copy into transmit streams. For any other mode, apply stream
+    // demultiplexing (trivial if SISO) and copy spatial streams directly into transmit streams.
+    if (pdc.is_symbol_index(ofdm_symb_idx)) {
+        run_pdc();
+    }
+
+    // transmit streams are filled with PCC, DRS and PDC, so now beamform entire OFDM symbol
+    run_beamforming(tm_mode.N_TS);
+}
+
+void tx_t::run_lanes_dispatch(const lane_job_t lane_job_) {
+    lane_job = lane_job_;
+
+    // a single lane is processed entirely in run_lanes_join()
+    if (N_lanes_active < 2) {
+        return;
+    }
+
+    // helper threads of idle lanes also acknowledge, so none can lag behind into the next packet
+    lane_pending.store(static_cast<uint32_t>(lane_vec.size()) - 1, std::memory_order_relaxed);
+    lane_generation.fetch_add(1, std::memory_order_release);
+    lane_generation.notify_all();
+}
+
+void tx_t::run_lanes_join() {
+    run_lane(*lane_vec[0]);
+
+    if (N_lanes_active < 2) {
+        return;
+    }
+
+    // lanes have the same load, so the remaining ones are typically about to finish
+    uint32_t pending = lane_pending.load(std::memory_order_acquire);
+    for (uint32_t i = 0; pending > 0 && i < lane_spin_max; ++i) {
+        pending = lane_pending.load(std::memory_order_acquire);
+    }
+
+    while (pending > 0) {
+        lane_pending.wait(pending, std::memory_order_acquire);
+        pending = lane_pending.load(std::memory_order_acquire);
+    }
+}
+
+void tx_t::run_back_end_advance() {
+    const uint32_t N_new_output_samples = lane_vec[0]->N_new_output_samples;
+
+    for (uint32_t i = 1; i < N_lanes_active; ++i) {
+        dectnrp_assert(lane_vec[i]->N_new_output_samples == N_new_output_samples,
+                       "lanes resampled different number of samples");
+    }
+
+    // zero same amount of samples on the upper antenna ports that we are not using
+    for (uint32_t i = tm_mode.N_TX; i < antenna_ports.size(); ++i) {
+        srsran_vec_cf_zero(&antenna_ports[i][index_sample_transmit_os_rs], N_new_output_samples);
+    }
+
+    index_sample_no_GI_os += lane_job.N_samples_in_CP_os + N_b_DFT_os;
+    index_sample_transmit_os_rs += N_new_output_samples;
+}
+
+void tx_t::run_lane(lane_t& lane) {
+    if (lane_job.residual) {
+        run_residual_resampling(lane);
+        return;
+    }
+
+    // scale in frequency domain, execute IFFT and insert CP
+    run_ifft_cp_scale(lane);
+
+    // resample from DECT NR+ sample rate to hardware sample rate and write into output buffer
+    run_resampling_and_freq_shift(lane);
+}
+
+void tx_t::run_ifft_cp_scale(lane_t& lane) {
+    const uint32_t N_samples_in_CP_os = lane_job.N_samples_in_CP_os;
+    const float scale = lane_job.scale;
+
+    const uint32_t ant_end = lane.ant_first + lane.N_TX;
+
     // scale in frequency domain so we don't have to scale the cyclic prefix in time domain
-    for (uint32_t i = 0; i < tm_mode.N_TX; ++i) {
-        srsran_vec_sc_prod_cfc_simd(
-            antenna_mapper_stage[i], scale, antenna_mapper_stage[i], N_b_OCC / 2 + 1);
-        srsran_vec_sc_prod_cfc_simd(&antenna_mapper_stage[i][N_subc_offset_lower_half_os],
+    for (uint32_t i = lane.ant_first; i < ant_end; ++i) {
+        cf_t* stage = antenna_mapper_stage_lanes[i];
+
+        srsran_vec_sc_prod_cfc_simd(stage, scale, stage, N_b_OCC / 2 + 1);
+        srsran_vec_sc_prod_cfc_simd(&stage[N_subc_offset_lower_half_os],
                                     scale,
-                                    &antenna_mapper_stage[i][N_subc_offset_lower_half_os],
+                                    &stage[N_subc_offset_lower_half_os],
                                     N_b_OCC / 2);
     }
 
     // transform antenna stream into time domain and add cyclic prefix
-    for (uint32_t i = 0; i < tm_mode.N_TX; ++i) {
+    for (uint32_t i = lane.ant_first; i < ant_end; ++i) {
         dft::single_symbol_tx_ofdm_zero_copy(ofdm_vec[ofdm_vec_idx_effective],
-                                             antenna_mapper_stage[i],
+                                             antenna_mapper_stage_lanes[i],
                                              ifft_cp_stage[i],
                                              N_samples_in_CP_os);
     }
 
 #ifdef PHY_TX_OFDM_WINDOWING
-    for (uint32_t i = 0; i < tm_mode.N_TX; ++i) {
+    for (uint32_t i = lane.ant_first; i < ant_end; ++i) {
         // If index_sample_no_GI_os == 0, we are at the first OFDM symbol and we don't apply
         // windowing to the cyclic prefix.
         if (index_sample_no_GI_os > 0) {
@@ -907,29 +1137,78 @@ void tx_t::run_ifft_cp_scale(const uint32_t N_samples_in_CP_os, float scale) {
     }
 #endif
 
-    index_sample_no_GI_os += N_samples_in_CP_os + N_b_DFT_os;
+    if (lane_job.stf) {
+        // proposed in 2023 to improve performance in low SNR and high CFO regimes
+        for (uint32_t i = lane.ant_first; i < ant_end; ++i) {
+            sp3::stf_t::apply_cover_sequence(
+                ifft_cp_stage[i],
+                ifft_cp_stage[i],
+                packet_sizes->psdef.u,
+                constants::N_samples_stf_pattern * packet_sizes->psdef.b * N_b_DFT_os / N_b_DFT);
+        }
+    }
 }
 
-void tx_t::run_resampling_and_freq_shift(const uint32_t N_samples_in_CP_os) {
-    // resample only the lower antenna ports we are using
-    uint32_t N_new_output_samples =
-        resampler->resample(std::vector<const cf_t*>(ifft_cp_stage.begin(), ifft_cp_stage.end()),
-                            antenna_ports_now,
-                            N_samples_in_CP_os + N_b_DFT_os);
+void tx_t::run_resampling_and_freq_shift(lane_t& lane) {
+    // resample only the lower antenna ports of this lane we are using
+    lane.N_new_output_samples = lane.resampler->resample(lane.ifft_cp_stage,
+                                                         lane.antenna_ports_now,
+                                                         lane_job.N_samples_in_CP_os + N_b_DFT_os);
 
     // apply frequency shift
-    mixer.mix_phase_continuous(antenna_ports_now, antenna_ports_now, N_new_output_samples);
+    lane.mixer.mix_phase_continuous(
+        lane.antenna_ports_now, lane.antenna_ports_now, lane.N_new_output_samples);
 
-    // zero same amount of samples on the upper antenna ports that we are not using
-    for (uint32_t i = tm_mode.N_TX; i < antenna_ports.size(); ++i) {
-        srsran_vec_cf_zero(&antenna_ports[i][index_sample_transmit_os_rs], N_new_output_samples);
+    // advance to current sample index
+    for (auto& elem : lane.antenna_ports_now) {
+        elem += lane.N_new_output_samples;
     }
+}
 
-    index_sample_transmit_os_rs += N_new_output_samples;
+void tx_t::run_residual_resampling(lane_t& lane) {
+    // resample final samples
+    lane.N_new_output_samples = lane.resampler->resample_final_samples(lane.antenna_ports_now);
 
-    // create vector pointing to current sample index
-    for (uint32_t i = 0; i < tm_mode.N_TX; ++i) {
-        antenna_ports_now[i] = &antenna_ports[i][index_sample_transmit_os_rs];
+    // apply frequency shift
+    lane.mixer.mix_phase_continuous(
+        lane.antenna_ports_now, lane.antenna_ports_now, lane.N_new_output_samples);
+}
+
+void* tx_t::lane_spawn(void* lane) {
+    auto& lane_ = *reinterpret_cast<lane_t*>(lane);
+    lane_.tx->lane_work(lane_);
+    return nullptr;
+}
+
+void tx_t::lane_work(lane_t& lane) {
+    // not loaded, as the first job may have been dispatched before this thread started
+    uint32_t generation = 0;
+
+    while (true) {
+        // the next OFDM symbol typically follows within a few microseconds
+        uint32_t generation_now = lane_generation.load(std::memory_order_acquire);
+        for (uint32_t i = 0; generation_now == generation && i < lane_spin_max; ++i) {
+            generation_now = lane_generation.load(std::memory_order_acquire);
+        }
+
+        if (generation_now == generation) {
+            lane_generation.wait(generation, std::memory_order_acquire);
+            continue;
+        }
+
+        generation = generation_now;
+
+        if (!lane_keep_running.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        if (lane.N_TX > 0) {
+            run_lane(lane);
+        }
+
+        if (lane_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            lane_pending.notify_one();
+        }
     }
 }
 
@@ -1049,13 +1328,21 @@ void tx_t::run_pdc() {
     // for a non transmit diversity mode, we apply spatial demultiplexing and write directly into
     // the corresponding transmit streams
     if (!transmit_diversity_mode) {
-        // go over each subcarrier
         uint32_t cnt = 0;
-        for (uint32_t i = 0; i < k_i_one_symbol_size; ++i) {
-            // We migh have to write multiple transmit streams per subcarrier.
-            // Can this be sped up with an SIMD wrapper?
-            for (uint32_t j = 0; j < tm_mode.N_SS; ++j) {
-                transmit_streams_stage[j][k_i_one_symbol[i]] = pdc_cmplx_symbols[cnt++];
+        if (tm_mode.N_SS == 1) {
+            // with a single spatial stream, complex symbols are copied run by run
+            for (const auto& run : pdc.get_k_i_runs_one_symbol()) {
+                srsran_vec_cf_copy(
+                    &transmit_streams_stage[0][run.start], &pdc_cmplx_symbols[cnt], run.length);
+                cnt += run.length;
+            }
+        } else {
+            // go over each subcarrier
+            for (uint32_t i = 0; i < k_i_one_symbol_size; ++i) {
+                // we have to write multiple transmit streams per subcarrier
+                for (uint32_t j = 0; j < tm_mode.N_SS; ++j) {
+                    transmit_streams_stage[j][k_i_one_symbol[i]] = pdc_cmplx_symbols[cnt++];
+                }
             }
         }
 
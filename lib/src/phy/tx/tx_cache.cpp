@@ -0,0 +1,130 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/phy/tx/tx_cache.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/constants.hpp"
+
+namespace dectnrp::phy {
+
+tx_cache_t::tx_cache_t(const uint32_t nof_entries_) {
+    dectnrp_assert(nof_entries_ > 0, "cache must have at least one entry");
+
+    entries.resize(nof_entries_);
+}
+
+void tx_cache_t::set_key(const tx_descriptor_t& tx_descriptor) {
+    auto& hp_tx = tx_descriptor.hp_tx;
+    const auto& packet_sizes = hp_tx.get_packet_sizes();
+    const auto& psdef = packet_sizes.psdef;
+    const auto& tx_meta = tx_descriptor.tx_meta;
+
+    key.clear();
+
+    append_to_key(psdef.u);
+    append_to_key(psdef.b);
+    append_to_key(psdef.PacketLengthType);
+    append_to_key(psdef.PacketLength);
+    append_to_key(psdef.tm_mode_index);
+    append_to_key(psdef.mcs_index);
+    append_to_key(psdef.Z);
+
+    append_to_key(hp_tx.get_PLCF_type());
+    append_to_key(hp_tx.get_network_id());
+    append_to_key(hp_tx.get_rv());
+    append_to_key(tx_descriptor.codebook_index);
+
+    append_to_key(static_cast<uint32_t>(tx_meta.optimal_scaling_DAC));
+    append_to_key(tx_meta.DAC_scale);
+    append_to_key(tx_meta.iq_phase_rad);
+    append_to_key(tx_meta.iq_phase_increment_s2s_post_resampling_rad);
+    append_to_key(tx_meta.GI_percentage);
+
+    append_to_key(hp_tx.get_a_plcf(),
+                  hp_tx.get_PLCF_type() == 1 ? constants::plcf_type_1_byte
+                                             : constants::plcf_type_2_byte);
+    append_to_key(hp_tx.get_a_tb(), packet_sizes.N_TB_byte);
+
+    // FNV-1a, only used to quickly reject entries before comparing the full key
+    key_hash = 14695981039346656037ULL;
+    for (const auto elem : key) {
+        key_hash = (key_hash ^ elem) * 1099511628211ULL;
+    }
+}
+
+const tx_cache_t::entry_t* tx_cache_t::find() {
+    ++use_cnt;
+
+    for (auto& entry : entries) {
+        if (entry.last_use < 0 || entry.key_hash != key_hash || entry.key != key) {
+            continue;
+        }
+
+        entry.last_use = use_cnt;
+
+        return &entry;
+    }
+
+    return nullptr;
+}
+
+void tx_cache_t::insert(const std::vector<radio::cf32_t*>& ant_streams,
+                        const uint32_t N_TX,
+                        const uint32_t N_samples) {
+    dectnrp_assert(N_TX <= ant_streams.size(), "more antennas than antenna streams");
+
+    // unused entries have a negative last_use and are therefore picked first
+    auto& entry = *std::min_element(entries.begin(),
+                                    entries.end(),
+                                    [](const entry_t& lhs, const entry_t& rhs) {
+                                        return lhs.last_use < rhs.last_use;
+                                    });
+
+    entry.key = key;
+    entry.key_hash = key_hash;
+    entry.N_samples = N_samples;
+    entry.ant_streams.resize(N_TX);
+
+    for (uint32_t i = 0; i < N_TX; ++i) {
+        entry.ant_streams[i].resize(N_samples);
+        radio::cf32_copy(entry.ant_streams[i].data(), ant_streams[i], N_samples);
+    }
+
+    entry.last_use = use_cnt;
+}
+
+void tx_cache_t::append_to_key(const uint8_t* src, const uint32_t N_byte) {
+    key.insert(key.end(), src, src + N_byte);
+}
+
+void tx_cache_t::append_to_key(const uint32_t value) {
+    uint8_t tmp[sizeof(value)];
+    std::memcpy(tmp, &value, sizeof(value));
+    append_to_key(tmp, sizeof(value));
+}
+
+void tx_cache_t::append_to_key(const float value) { append_to_key(std::bit_cast<uint32_t>(value)); }
+
+}  // namespace dectnrp::phy
@@ -23,6 +23,7 @@
 #include <string>
 
 #include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/prog/metrics.hpp"
 #include "dectnrp/common/thread/threads.hpp"
 #include "dectnrp/constants.hpp"
 #include "dectnrp/phy/rx/sync/sync_param.hpp"
@@ -39,8 +40,37 @@ worker_pool_t::worker_pool_t(const worker_pool_config_t& worker_pool_config_,
 
     job_queue = std::make_unique<job_queue_t>(id, worker_pool_config.nof_jobs);
 
-    worker_config_t worker_config(
-        0, keep_running, hw_, *job_queue.get(), irregular_queue, worker_pool_config);
+#ifdef PHY_POOL_ELASTIC
+    if (worker_pool_config.threads_core_prio_config_tx_rx_vec.size() > 1) {
+        // a job should be processed within two chunks, and below one chunk there is spare capacity
+        const int64_t chunk_length_us =
+            static_cast<int64_t>(worker_pool_config.rx_chunk_length_u8subslot) *
+            int64_t{1000000} / static_cast<int64_t>(constants::u8_subslots_per_sec);
+
+        elastic = std::make_unique<elastic_t>(
+            id,
+            worker_pool_config.threads_core_prio_config_tx_rx_vec.size(),
+            chunk_length_us * 2,
+            chunk_length_us,
+            ELASTIC_HOLD_MS);
+
+        job_queue->set_elastic(elastic.get());
+
+        metrics::register_gauge(
+            "phy_worker_tx_rx_active",
+            "active TX/RX workers",
+            metrics::labels_t{{"pool", std::to_string(id)}},
+            [elastic_ = elastic.get()]() { return elastic_->get_nof_workers_active(); });
+    }
+#endif
+
+    worker_config_t worker_config(0,
+                                  keep_running,
+                                  hw_,
+                                  *job_queue.get(),
+                                  irregular_queue,
+                                  worker_pool_config,
+                                  elastic.get());
 
 #ifdef PHY_JSON_SWITCH_IMPLEMENT_ANY_JSON_FUNCTIONALITY
     if (worker_pool_config.json_export_length > 0) {
@@ -169,6 +199,10 @@ void worker_pool_t::start_threads_and_get_ready_to_process_iq_samples() {
 
     log_lines(job_queue->report_start());
 
+    if (elastic.get() != nullptr) {
+        log_lines(elastic->report_start());
+    }
+
 #ifdef PHY_JSON_SWITCH_IMPLEMENT_ANY_JSON_FUNCTIONALITY
     if (json_export.get() != nullptr) {
         log_lines(json_export->report_start());
@@ -196,6 +230,11 @@ void worker_pool_t::work_stop() {
         log_line(std::string("Thread Worker TX/RX " + std::to_string(elem->id)));
     }
 
+    // parked consumers must leave their loops as well
+    if (elastic.get() != nullptr) {
+        elastic->unpark_all();
+    }
+
     // stop job consumers second
     for (auto& elem : worker_tx_rx_vec) {
         pthread_join(elem->work_thread, NULL);
@@ -204,6 +243,10 @@ void worker_pool_t::work_stop() {
 
     log_lines(job_queue->report_stop());
 
+    if (elastic.get() != nullptr) {
+        log_lines(elastic->report_stop());
+    }
+
 #ifdef PHY_JSON_SWITCH_IMPLEMENT_ANY_JSON_FUNCTIONALITY
     if (json_export.get() != nullptr) {
         log_lines(json_export->report_stop());
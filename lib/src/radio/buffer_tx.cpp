@@ -22,34 +22,19 @@
 
 #include "dectnrp/common/prog/assert.hpp"
 #include "dectnrp/common/thread/watch.hpp"
+#include "dectnrp/radio/buffer_tx_pool.hpp"
 #include "dectnrp/radio/complex.hpp"
 
 namespace dectnrp::radio {
 
 buffer_tx_t::buffer_tx_t(const uint32_t id_,
                          const uint32_t nof_antennas_,
-                         const uint32_t ant_streams_length_samples_
-#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
-                         ,
-                         std::mutex& tx_new_packet_mutex_,
-                         std::condition_variable& tx_new_packet_cv_,
-                         uint32_t& tx_new_packet_cnt_
-#endif
-                         )
+                         buffer_tx_pool_t& buffer_tx_pool_)
     : id(id_),
       nof_antennas(nof_antennas_),
-      ant_streams_length_samples(ant_streams_length_samples_)
-#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
-      ,
-      tx_new_packet_mutex(tx_new_packet_mutex_),
-      tx_new_packet_cv(tx_new_packet_cv_),
-      tx_new_packet_cnt(tx_new_packet_cnt_)
-#endif
-
-{
-    for (uint32_t i = 0; i < nof_antennas; ++i) {
-        ant_streams.push_back(cf32_malloc(ant_streams_length_samples));
-    }
+      buffer_tx_pool(buffer_tx_pool_) {
+    // pointers are set when a region of the arena is allocated
+    ant_streams.resize(nof_antennas, nullptr);
 
     dectnrp_assert(!is_outer_locked(), "incorrect lock state");
     dectnrp_assert(!is_inner_locked(), "incorrect lock state");
@@ -61,12 +46,6 @@ buffer_tx_t::buffer_tx_t(const uint32_t id_,
     dectnrp_assert(buffer_tx_meta.tx_time_64 = -1, "incorrect lock state");
 }
 
-buffer_tx_t::~buffer_tx_t() {
-    for (auto& elem : ant_streams) {
-        free(elem);
-    }
-}
-
 void buffer_tx_t::get_ant_streams(std::vector<cf32_t*>& ant_streams_,
                                   const uint32_t tx_length_samples_) {
     dectnrp_assert(is_outer_locked_inner_unlocked(), "incorrect lock state");
@@ -89,15 +68,8 @@ void buffer_tx_t::set_transmittable(const struct buffer_tx_meta_t buffer_tx_meta
 
     lock_inner();
 
-#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
-    // make sure TX thread is notified of this new packet and woken up at least once
-    {
-        std::unique_lock<std::mutex> lk(tx_new_packet_mutex);
-        ++tx_new_packet_cnt;
-    }
-
-    tx_new_packet_cv.notify_all();
-#endif
+    // insert into the time-ordered queue of the TX thread
+    buffer_tx_pool.push_transmittable(id);
 }
 
 void buffer_tx_t::set_tx_length_samples_cnt(const uint32_t tx_length_samples_cnt_) {
@@ -156,15 +128,9 @@ void buffer_tx_t::set_transmitted_or_abort() {
     dectnrp_assert(is_outer_locked_inner_locked(), "incorrect lock state");
 
     reset();
+    buffer_tx_pool.release_region(*this);
     unlock_inner();
     unlock_outer();
-
-#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
-    {
-        std::unique_lock<std::mutex> lk(tx_new_packet_mutex);
-        tx_new_packet_cnt--;
-    }
-#endif
 }
 
 void buffer_tx_t::reset() {
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/radio/buffer_tx_arena.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+
+#include "dectnrp/common/prog/assert.hpp"
+
+namespace dectnrp::radio {
+
+buffer_tx_arena_t::buffer_tx_arena_t(const uint32_t nof_antennas_,
+                                     const uint32_t slot_length_samples_,
+                                     const uint32_t nof_slots_,
+                                     const uint32_t nof_regions_max_)
+    : nof_antennas(nof_antennas_),
+      slot_length_samples(round_to_unit(slot_length_samples_)),
+      nof_slots(nof_slots_),
+      length_samples(get_length_samples(slot_length_samples, nof_slots)) {
+    dectnrp_assert(0 < nof_regions_max_, "no regions");
+
+    for (uint32_t i = 0; i < nof_antennas; ++i) {
+        ant_streams.push_back(cf32_malloc(length_samples));
+    }
+
+    // initially, every slot is one free region
+    free_regions.reserve(nof_regions_max_ + nof_slots);
+    for (uint32_t slot_idx = 0; slot_idx < nof_slots; ++slot_idx) {
+        free_regions.push_back(
+            region_t{.offset = slot_idx * slot_length_samples, .length = slot_length_samples});
+    }
+}
+
+buffer_tx_arena_t::~buffer_tx_arena_t() {
+    for (auto& elem : ant_streams) {
+        free(elem);
+    }
+}
+
+std::optional<uint32_t> buffer_tx_arena_t::allocate(const uint32_t length_samples_) {
+    dectnrp_assert(0 < length_samples_, "region empty");
+    dectnrp_assert(length_samples_ <= slot_length_samples, "region longer than slot");
+
+    const uint32_t length = round_to_unit(length_samples_);
+
+    std::unique_lock<std::mutex> lk(arena_mutex);
+
+    // first-fit
+    const auto it = std::find_if(free_regions.begin(),
+                                 free_regions.end(),
+                                 [length](const region_t& elem) { return length <= elem.length; });
+
+    if (it == free_regions.end()) {
+        return std::nullopt;
+    }
+
+    // take the region from the front of the free region
+    const uint32_t offset = it->offset;
+
+    it->offset += length;
+    it->length -= length;
+
+    if (it->length == 0) {
+        free_regions.erase(it);
+    }
+
+    used_samples += length;
+
+    return offset;
+}
+
+void buffer_tx_arena_t::release(const uint32_t offset, const uint32_t length_samples_) {
+    const uint32_t length = round_to_unit(length_samples_);
+
+    dectnrp_assert(offset % unit_samples == 0, "offset not aligned");
+    dectnrp_assert(offset + length <= length_samples, "region out of bound");
+
+    std::unique_lock<std::mutex> lk(arena_mutex);
+
+    dectnrp_assert(length <= used_samples, "releasing more than allocated");
+
+    // first free region behind the released region
+    auto next = std::lower_bound(
+        free_regions.begin(), free_regions.end(), offset, [](const region_t& elem, uint32_t val) {
+            return elem.offset < val;
+        });
+
+    dectnrp_assert(next == free_regions.end() || offset + length <= next->offset,
+                   "released region overlaps with free region");
+
+    const bool merge_next = next != free_regions.end() && offset + length == next->offset &&
+                            !is_slot_boundary(next->offset);
+
+    if (next != free_regions.begin()) {
+        auto prev = std::prev(next);
+
+        dectnrp_assert(prev->offset + prev->length <= offset,
+                       "released region overlaps with free region");
+
+        if (prev->offset + prev->length == offset && !is_slot_boundary(offset)) {
+            prev->length += length;
+
+            if (merge_next) {
+                prev->length += next->length;
+                free_regions.erase(next);
+            }
+
+            used_samples -= length;
+            return;
+        }
+    }
+
+    if (merge_next) {
+        next->offset = offset;
+        next->length += length;
+    } else {
+        dectnrp_assert(free_regions.size() < free_regions.capacity(), "too many free regions");
+        free_regions.insert(next, region_t{.offset = offset, .length = length});
+    }
+
+    used_samples -= length;
+}
+
+uint32_t buffer_tx_arena_t::get_length_samples(const uint32_t slot_length_samples_,
+                                               const uint32_t nof_slots_) {
+    dectnrp_assert(0 < slot_length_samples_, "slot empty");
+    dectnrp_assert(0 < nof_slots_, "no slots");
+    dectnrp_assert(static_cast<uint64_t>(slot_length_samples_) * nof_slots_ <=
+                       std::numeric_limits<uint32_t>::max(),
+                   "arena too large");
+
+    return slot_length_samples_ * nof_slots_;
+}
+
+uint32_t buffer_tx_arena_t::get_used_samples() const {
+    std::unique_lock<std::mutex> lk(arena_mutex);
+    return used_samples;
+}
+
+}  // namespace dectnrp::radio
@@ -20,124 +20,201 @@
 
 #include "dectnrp/radio/buffer_tx_pool.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <vector>
 
+#include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/prog/metrics.hpp"
 #include "dectnrp/common/thread/watch.hpp"
 
 namespace dectnrp::radio {
 
 buffer_tx_pool_t::buffer_tx_pool_t(const uint32_t id_,
                                    const uint32_t nof_antennas_,
-                                   const uint32_t nof_buffer_tx_,
-                                   const uint32_t ant_streams_length_samples_)
+                                   const uint32_t nof_buffer_tx_max_length_,
+                                   const uint32_t ant_streams_length_samples_max_)
     : id(id_),
       nof_antennas(nof_antennas_),
-      nof_buffer_tx(nof_buffer_tx_),
-      ant_streams_length_samples(ant_streams_length_samples_) {
+      nof_buffer_tx(get_nof_buffer_tx(nof_buffer_tx_max_length_)),
+      ant_streams_length_samples_max(ant_streams_length_samples_max_),
+      buffer_tx_arena(nof_antennas_,
+                      ant_streams_length_samples_max_,
+                      nof_buffer_tx_max_length_,
+                      nof_buffer_tx) {
     for (uint32_t buffer_id = 0; buffer_id < nof_buffer_tx; ++buffer_id) {
-        buffer_tx_vec.push_back(std::make_unique<buffer_tx_t>(buffer_id,
-                                                              nof_antennas,
-                                                              ant_streams_length_samples
-#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
-                                                              ,
-                                                              tx_new_packet_mutex,
-                                                              tx_new_packet_cv,
-                                                              tx_new_packet_cnt
-#endif
-                                                              ));
+        buffer_tx_vec.push_back(std::make_unique<buffer_tx_t>(buffer_id, nof_antennas, *this));
     }
 
-#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
-    tx_new_packet_cnt = 0;
-#endif
+    // every buffer is in the heap at most once
+    dispatch_heap.reserve(nof_buffer_tx);
+    transmittable_ns.resize(nof_buffer_tx, 0);
+
+    const metrics::labels_t labels{{"hw", std::to_string(id)}};
+
+    metrics::register_counter("radio_tx_late",
+                              "TX buffers dispatched after their transmission time, not sent",
+                              labels,
+                              dispatch_stats.late);
+    metrics::register_counter("radio_tx_dropped",
+                              "TX buffers overlapping with the previous packet, not sent",
+                              labels,
+                              dispatch_stats.dropped);
+    metrics::register_histogram("radio_tx_slack_us",
+                                "time between TX buffer becoming transmittable and transmission",
+                                labels,
+                                dispatch_stats.slack_us);
+    metrics::register_counter("radio_tx_no_buffer",
+                              "TX buffer requests failed as all buffers were in use",
+                              labels,
+                              fill_stats.no_buffer_tx);
+    metrics::register_counter("radio_tx_no_region",
+                              "TX buffer requests failed as the sample arena was full",
+                              labels,
+                              fill_stats.no_region);
+
+    metrics::register_gauge("radio_tx_arena_used_samples",
+                            "samples per antenna allocated in the TX sample arena",
+                            labels,
+                            [this]() { return buffer_tx_arena.get_used_samples(); });
+
+    metrics::register_gauge("radio_buffer_tx_in_use",
+                            "TX buffers being filled or awaiting transmission",
+                            labels,
+                            [this]() {
+                                return std::count_if(buffer_tx_vec.begin(),
+                                                     buffer_tx_vec.end(),
+                                                     [](const auto& elem) {
+                                                         return elem->is_outer_locked();
+                                                     });
+                            });
 };
 
-buffer_tx_t* buffer_tx_pool_t::get_buffer_tx_to_fill() {
+uint32_t buffer_tx_pool_t::get_nof_buffer_tx(const uint32_t nof_buffer_tx_max_length_) {
+    dectnrp_assert(0 < nof_buffer_tx_max_length_, "no buffers");
+    dectnrp_assert(nof_buffer_tx_max_length_ <=
+                       std::numeric_limits<uint32_t>::max() /
+                           RADIO_BUFFER_TX_POOL_NOF_BUFFER_TX_PER_MAX_LENGTH,
+                   "too many buffers");
+
+    return nof_buffer_tx_max_length_ * RADIO_BUFFER_TX_POOL_NOF_BUFFER_TX_PER_MAX_LENGTH;
+}
+
+buffer_tx_t* buffer_tx_pool_t::get_buffer_tx_to_fill(const uint32_t ant_streams_length_samples_) {
+    dectnrp_assert(ant_streams_length_samples_ <= ant_streams_length_samples_max,
+                   "TX length longer than maximum packet length");
+
     // go over each buffer once ...
     for (uint32_t i = 0; i < nof_buffer_tx; ++i) {
         // ... and check if it is lockable
-        if (buffer_tx_vec[i]->try_lock_outer()) {
-            // if so, return a pointer to that exact buffer
-            return buffer_tx_vec[i].get();
+        if (!buffer_tx_vec[i]->try_lock_outer()) {
+            continue;
         }
-    }
 
-    // ideally, this point is never reached as there always is a free buffer
-    return nullptr;
-}
+        buffer_tx_t& buffer_tx = *buffer_tx_vec[i].get();
 
-int32_t buffer_tx_pool_t::get_specific_tx_order_id_if_available(
-    const int64_t tx_order_id_target) const {
-    // go over each buffer ...
-    for (uint32_t i = 0; i < nof_buffer_tx; ++i) {
-        // ... and check whether it is transmittable ...
-        if (buffer_tx_vec[i]->is_inner_locked()) {
-            // ... and, if so, whether it has the tx order id we are looking for
-            if (buffer_tx_vec[i]->buffer_tx_meta.tx_order_id == tx_order_id_target) {
-                // return the index of the buffer
-                return i;
-            }
+        // the buffer is ours, now try to find memory for its samples
+        const auto offset = buffer_tx_arena.allocate(ant_streams_length_samples_);
+
+        if (!offset.has_value()) {
+            buffer_tx.unlock_outer();
+            ++fill_stats.no_region;
+            return nullptr;
+        }
+
+        for (uint32_t ant_idx = 0; ant_idx < nof_antennas; ++ant_idx) {
+            buffer_tx.ant_streams[ant_idx] =
+                buffer_tx_arena.get_ant_stream(ant_idx, offset.value());
         }
+
+        buffer_tx.arena_offset = offset.value();
+        buffer_tx.ant_streams_length_samples = ant_streams_length_samples_;
+
+        return &buffer_tx;
     }
 
-    // buffer not found
-    return -1;
+    // ideally, this point is never reached as there always is a free buffer
+    ++fill_stats.no_buffer_tx;
+    return nullptr;
 }
 
-int32_t buffer_tx_pool_t::wait_for_specific_tx_order_id_to(const int64_t tx_order_id_target,
-                                                           const uint32_t timeout_ms) const {
-#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
-    // initial search
-    int32_t ret = get_specific_tx_order_id_if_available(tx_order_id_target);
+void buffer_tx_pool_t::release_region(buffer_tx_t& buffer_tx) {
+    buffer_tx_arena.release(buffer_tx.arena_offset, buffer_tx.ant_streams_length_samples);
 
-    if (ret >= 0) {
-        return ret;
-    }
+    buffer_tx.arena_offset = 0;
+    buffer_tx.ant_streams_length_samples = 0;
+}
 
+void buffer_tx_pool_t::push_transmittable(const uint32_t idx) {
     {
         std::unique_lock<std::mutex> lk(tx_new_packet_mutex);
 
-        /* At this point, we locked the mutex and no other thread can increment tx_new_packet_cnt.
-         * We have not yet checked any of the TX buffers, so we set the reference value to zero.
-         */
-        uint32_t tx_new_packet_cnt_ref = 0;
-
-        /* The following loop can only be left if either ...
-         * 1) The right buffer_tx was found, i.e. ret >= 0.
-         * 2) The condition variable timed out.
-         */
-        while (ret < 0) {
-            while (tx_new_packet_cnt == tx_new_packet_cnt_ref) {
-                // implicitly unlock the mutex and wait for a condition variable
-                auto res = tx_new_packet_cv.wait_for(lk, std::chrono::milliseconds(timeout_ms));
-
-                // cv timed out, leave function without job and by that remove the lock on the mutex
-                if (res == std::cv_status::timeout) {
-                    return -1;
-                }
-            }
+        dectnrp_assert(dispatch_heap.size() < nof_buffer_tx, "more entries than buffers");
 
-            // we have the lock on the mutex, check if correct buffer_tx is available
-            ret = get_specific_tx_order_id_if_available(tx_order_id_target);
+        const auto& buffer_tx_meta = buffer_tx_vec[idx]->buffer_tx_meta;
 
-            // save amount of oldest packets already checked
-            tx_new_packet_cnt_ref = tx_new_packet_cnt;
-        }
+        dispatch_heap.push_back(dispatch_entry_t{.tx_time_64 = buffer_tx_meta.tx_time_64,
+                                                 .tx_order_id = buffer_tx_meta.tx_order_id,
+                                                 .idx = idx});
+        std::push_heap(dispatch_heap.begin(), dispatch_heap.end());
+
+        transmittable_ns[idx] =
+            common::watch_t::get_elapsed_since_epoch<int64_t, common::nano, common::steady_clock>();
     }
 
-    return ret;
+#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
+    // make sure TX thread is notified of this new packet and woken up at least once
+    tx_new_packet_cv.notify_all();
+#endif
+}
+
+bool buffer_tx_pool_t::wait_for_transmittable_to(const uint32_t timeout_ms) const {
+#ifdef RADIO_BUFFER_TX_CONDITION_VARIABLE_OR_BUSY_WAITING
+    std::unique_lock<std::mutex> lk(tx_new_packet_mutex);
 
+    // implicitly unlock the mutex and wait for a condition variable
+    return tx_new_packet_cv.wait_for(
+        lk, std::chrono::milliseconds(timeout_ms), [this]() { return !dispatch_heap.empty(); });
 #else
+    common::watch_t watch;
 
-    return wait_for_specific_tx_order_id_busy_to(tx_order_id_target, timeout_ms * 1000);
+    while (!watch.is_elapsed<common::milli>(timeout_ms)) {
+        {
+            std::unique_lock<std::mutex> lk(tx_new_packet_mutex);
+            if (!dispatch_heap.empty()) {
+                return true;
+            }
+        }
+
+        // limit calls to mutex
+        common::watch_t::busywait_us();
+    }
 
+    return false;
 #endif
 }
 
-int32_t buffer_tx_pool_t::wait_for_specific_tx_order_id_busy_to(const int64_t tx_order_id_target,
-                                                                const uint32_t timeout_us) const {
+int32_t buffer_tx_pool_t::pop_earliest_before(const int64_t tx_time_limit_64) {
+    std::unique_lock<std::mutex> lk(tx_new_packet_mutex);
+
+    if (dispatch_heap.empty() || dispatch_heap.front().tx_time_64 >= tx_time_limit_64) {
+        return -1;
+    }
+
+    std::pop_heap(dispatch_heap.begin(), dispatch_heap.end());
+    const uint32_t idx = dispatch_heap.back().idx;
+    dispatch_heap.pop_back();
+
+    dectnrp_assert(buffer_tx_vec[idx]->is_inner_locked(), "buffer not transmittable");
+
+    return static_cast<int32_t>(idx);
+}
+
+int32_t buffer_tx_pool_t::pop_earliest_before_busy_to(const int64_t tx_time_limit_64,
+                                                      const uint32_t timeout_us) {
     // initial search
-    int32_t ret = get_specific_tx_order_id_if_available(tx_order_id_target);
+    int32_t ret = pop_earliest_before(tx_time_limit_64);
 
     if (ret >= 0) {
         return ret;
@@ -146,10 +223,10 @@ int32_t buffer_tx_pool_t::wait_for_specific_tx_order_id_busy_to(const int64_t tx
     common::watch_t watch;
 
     while (ret < 0) {
-        // limit calls to atomic
+        // limit calls to mutex
         common::watch_t::busywait_us();
 
-        ret = get_specific_tx_order_id_if_available(tx_order_id_target);
+        ret = pop_earliest_before(tx_time_limit_64);
 
         // timeout after some microseconds
         if (watch.is_elapsed<common::micro>(timeout_us)) {
@@ -160,6 +237,50 @@ int32_t buffer_tx_pool_t::wait_for_specific_tx_order_id_busy_to(const int64_t tx
     return ret;
 }
 
+int32_t buffer_tx_pool_t::skip_overlapping(int32_t idx,
+                                           const int64_t tx_time_limit_64,
+                                           const int64_t tx_time_end_64,
+                                           std::vector<uint32_t>& overlapping) {
+    while (idx >= 0 && buffer_tx_vec[idx]->buffer_tx_meta.tx_time_64 < tx_time_end_64) {
+        overlapping.push_back(static_cast<uint32_t>(idx));
+        idx = pop_earliest_before(tx_time_limit_64);
+    }
+
+    return idx;
+}
+
+void buffer_tx_pool_t::abort_dispatched(const uint32_t idx, const bool late) {
+    // PHY releases the buffer to us only once, so it must finish writing before we reset it
+    buffer_tx_vec[idx]->wait_for_samples_busy_nto(
+        buffer_tx_vec[idx]->tx_length_samples.load(std::memory_order_acquire));
+
+    buffer_tx_vec[idx]->set_transmitted_or_abort();
+
+    if (late) {
+        ++dispatch_stats.late;
+    } else {
+        ++dispatch_stats.dropped;
+    }
+}
+
+void buffer_tx_pool_t::observe_slack(const uint32_t idx,
+                                     const int64_t slack_samples,
+                                     const uint32_t samp_rate) {
+    const int64_t now_ns =
+        common::watch_t::get_elapsed_since_epoch<int64_t, common::nano, common::steady_clock>();
+
+    int64_t waited_ns = 0;
+
+    {
+        std::unique_lock<std::mutex> lk(tx_new_packet_mutex);
+        waited_ns = now_ns - transmittable_ns[idx];
+    }
+
+    // slack at dispatch plus the time the buffer was waiting in the heap
+    dispatch_stats.slack_us.observe(
+        slack_samples * int64_t{1000000} / static_cast<int64_t>(samp_rate) + waited_ns / 1000);
+}
+
 std::vector<buffer_tx_t*> buffer_tx_pool_t::get_buffer_tx_vec() const {
     std::vector<buffer_tx_t*> ret;
 
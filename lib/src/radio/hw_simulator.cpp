@@ -20,6 +20,7 @@
 
 #include "dectnrp/radio/hw_simulator.hpp"
 
+#include <limits>
 #include <utility>
 
 #include "dectnrp/common/prog/assert.hpp"
@@ -103,7 +104,7 @@ void hw_simulator_t::set_samp_rate(const uint32_t samp_rate_in) {
 
 void hw_simulator_t::initialize_buffer_tx_pool(const uint32_t ant_streams_length_samples_max) {
     buffer_tx_pool = std::make_unique<buffer_tx_pool_t>(
-        id, nof_antennas, hw_config.nof_buffer_tx, ant_streams_length_samples_max);
+        id, nof_antennas, hw_config.nof_buffer_tx_max_length, ant_streams_length_samples_max);
 }
 
 void hw_simulator_t::initialize_buffer_rx(const uint32_t ant_streams_length_samples) {
@@ -297,10 +298,10 @@ void hw_simulator_t::set_rx_snr_in_net_bandwidth_norm_dB(
 }
 
 void hw_simulator_t::set_all_buffers_as_transmitted() {
-    for (auto& elem : buffer_tx_pool->buffer_tx_vec) {
-        if (elem->is_inner_locked()) {
-            elem->set_transmitted_or_abort();
-        }
+    // every transmittable buffer is also in the dispatch heap, so both must be cleared
+    int32_t idx = -1;
+    while ((idx = buffer_tx_pool->pop_earliest_before(std::numeric_limits<int64_t>::max())) >= 0) {
+        buffer_tx_pool->buffer_tx_vec[idx]->set_transmitted_or_abort();
     }
 }
 
@@ -316,6 +317,8 @@ void hw_simulator_t::work_stop() {
     str.append(" Sample Rate Target " + std::to_string(static_cast<double>(samp_rate)));
     str.append(" TX Samples sent " + std::to_string(tx_stats.samples_sent));
     str.append(" TX Sample Rate Is " + std::to_string(tx_stats.samp_rate_is));
+    str.append(" TX Late " + std::to_string(buffer_tx_pool->dispatch_stats.late.get()));
+    str.append(" TX Dropped " + std::to_string(buffer_tx_pool->dispatch_stats.dropped.get()));
     str.append(" RX Samples received " + std::to_string(rx_stats.samples_received));
     str.append(" RX Sample Rate Is " + std::to_string(rx_stats.samp_rate_is));
     log_line(str);
@@ -341,12 +344,13 @@ void* hw_simulator_t::work_tx(void* hw_simulator) {
     vspace.hw_register_tx(vspptx);
     vspace.wait_for_all_rx_registered_and_inits_done_nto();
 
-    // reset TX counter
-    uint64_t tx_order_id_expected = 0;
-
     // working copy
     std::vector<void*> ant_streams(calling_instance->nof_antennas);
 
+    // packets overlapping with the packet just sent
+    std::vector<uint32_t> overlapping_buffer_tx;
+    overlapping_buffer_tx.reserve(buffer_tx_pool.nof_buffer_tx);
+
     // get latest time
     const int64_t now_start_64 = calling_instance->buffer_rx->get_rx_time_passed();
     int64_t now_64 = now_start_64;
@@ -360,11 +364,25 @@ void* hw_simulator_t::work_tx(void* hw_simulator) {
     common::watch_t watch;
 
     while (keep_running.load(std::memory_order_acquire)) {
-        // check if the currently expected TX buffer is ready
+        /* Check if a TX buffer starts within the next spp. Buffers are dispatched by transmission
+         * time, so a buffer becoming transmittable later can still overtake if it starts earlier.
+         */
         int32_t buffer_tx_idx =
-            buffer_tx_pool.get_specific_tx_order_id_if_available(tx_order_id_expected);
+            buffer_tx_pool.pop_earliest_before(now_64 + static_cast<int64_t>(spp_size));
+
+        // transmission time has passed, buffer is not sent
+        if (buffer_tx_idx >= 0 &&
+            buffer_tx_vec[buffer_tx_idx]->buffer_tx_meta.tx_time_64 < now_64) {
+            buffer_tx_pool.abort_dispatched(buffer_tx_idx, true);
+            continue;
+        }
 
         if (buffer_tx_idx >= 0) {
+            buffer_tx_pool.observe_slack(
+                buffer_tx_idx,
+                buffer_tx_vec[buffer_tx_idx]->buffer_tx_meta.tx_time_64 - now_64,
+                calling_instance->samp_rate);
+
             /* At this point, we know that a packet can be transmitted. We now keep transmitting
              * zeros until the packets starts, and then we transmit the actual samples. This process
              * cannot be interrupted and we always wait for the virtual space with no timeout (nto).
@@ -380,7 +398,7 @@ void* hw_simulator_t::work_tx(void* hw_simulator) {
             int64_t tx_time_64 = buffer_tx_vec[buffer_tx_idx]->buffer_tx_meta.tx_time_64;
 
             dectnrp_assert(tx_time_64 >= now_64,
-                           "transmission time of expected packet earlier than current time");
+                           "transmission time of earliest packet earlier than current time");
 
             // how many zero samples must be transmitted before the first sample of the packet?
             const int64_t time2tx = tx_time_64 - now_64;
@@ -482,25 +500,30 @@ void* hw_simulator_t::work_tx(void* hw_simulator) {
                         "End of packet.   id={} tx_time_64={}", calling_instance->id, tx_time_64);
 #endif
 
-                    // this buffer is as good as sent ...
-                    if (buffer_tx_vec[buffer_tx_idx]->buffer_tx_meta.tx_order_id_expect_next < 0) {
-                        // ... so either increase ID counter for next packet by one ...
-                        ++tx_order_id_expected;
-                    } else {
-                        // ... or overwrite if firmware wants to change the order
-                        tx_order_id_expected =
-                            buffer_tx_vec[buffer_tx_idx]->buffer_tx_meta.tx_order_id_expect_next;
-                    }
-
                     ++calling_instance->tx_stats.buffer_tx_sent;
 
                     /* Check whether packet ends somewhere in the center of the spp. If so, another
                      * transmission could be started in the current spp.
                      */
                     if (spp_offset + tx_length_samples_this_spp < spp_size) {
-                        // check if the currently expected TX buffer is ready
-                        buffer_tx_idx = buffer_tx_pool.get_specific_tx_order_id_if_available(
-                            tx_order_id_expected);
+                        // end of the packet just sent
+                        const int64_t tx_time_end_64 =
+                            now_64 + static_cast<int64_t>(spp_offset + tx_length_samples_this_spp);
+
+                        // check if a TX buffer starts in the current spp
+                        const int64_t tx_time_limit_64 = now_64 + static_cast<int64_t>(spp_size);
+
+                        buffer_tx_idx = buffer_tx_pool.pop_earliest_before(tx_time_limit_64);
+
+                        // packets overlapping with the packet just sent are not sent
+                        buffer_tx_idx = buffer_tx_pool.skip_overlapping(
+                            buffer_tx_idx, tx_time_limit_64, tx_time_end_64, overlapping_buffer_tx);
+
+                        for (const auto idx : overlapping_buffer_tx) {
+                            buffer_tx_pool.abort_dispatched(idx, false);
+                        }
+
+                        overlapping_buffer_tx.clear();
 
                         if (buffer_tx_idx >= 0) {
                             // transmission length
@@ -513,12 +536,11 @@ void* hw_simulator_t::work_tx(void* hw_simulator) {
                             tx_time_64 = buffer_tx_vec[buffer_tx_idx]->buffer_tx_meta.tx_time_64;
 
                             dectnrp_assert(
-                                tx_time_64 >= now_64 + static_cast<int64_t>(
-                                                           spp_offset + tx_length_samples_this_spp),
-                                "transmission time of expected packet earlier than current time");
+                                tx_time_64 >= tx_time_end_64,
+                                "transmission time of earliest packet earlier than current time");
 
-                            // does the transmission start in the current spp?
-                            if (tx_time_64 < now_64 + static_cast<int64_t>(spp_size)) {
+                            // the transmission starts in the current spp
+                            {
                                 // reset counter
                                 tx_length_samples_cnt = 0;
 
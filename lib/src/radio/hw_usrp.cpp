@@ -206,7 +206,7 @@ void hw_usrp_t::set_samp_rate(const uint32_t samp_rate_in) {
 
 void hw_usrp_t::initialize_buffer_tx_pool(const uint32_t ant_streams_length_samples_max) {
     buffer_tx_pool = std::make_unique<buffer_tx_pool_t>(
-        id, nof_antennas, hw_config.nof_buffer_tx, ant_streams_length_samples_max);
+        id, nof_antennas, hw_config.nof_buffer_tx_max_length, ant_streams_length_samples_max);
 }
 
 void hw_usrp_t::initialize_buffer_rx(const uint32_t ant_streams_length_samples) {
@@ -634,6 +634,8 @@ void hw_usrp_t::work_stop() {
     std::string str("USRP");
     str.append(" TX Sent " + std::to_string(tx_stats.buffer_tx_sent));
     str.append(" TX Sent Consecutive " + std::to_string(tx_stats.buffer_tx_sent_consecutive));
+    str.append(" TX Late " + std::to_string(buffer_tx_pool->dispatch_stats.late.get()));
+    str.append(" TX Dropped " + std::to_string(buffer_tx_pool->dispatch_stats.dropped.get()));
     str.append(" RX Samples " + std::to_string(buffer_rx->time_as_sample_cnt_64));
     str.append(
         " RX System Runtime " +
@@ -835,16 +837,27 @@ void* hw_usrp_t::work_tx(void* hw_usrp) {
         static_cast<int64_t>(calling_instance->hw_config.tx_time_advance_samples);
 #endif
 
-    // each packet has a 64 bit number, we transmit them in exact order
-    int64_t tx_order_id_expected = 0;
+    // packets are dispatched in order of their transmission time once within this horizon
+    const int64_t dispatch_horizon_64 = static_cast<int64_t>(
+        calling_instance->get_samples_in_us(RADIO_BUFFER_TX_POOL_DISPATCH_HORIZON_US));
+
+    // packets overlapping with the packet on air, aborted once the burst has been sent
+    std::vector<uint32_t> overlapping_buffer_tx;
+    overlapping_buffer_tx.reserve(buffer_tx_pool.nof_buffer_tx);
 
     while (keep_running.load(std::memory_order_acquire)) {
-        // wait for specific packet to become available
-        int32_t next_buffer_tx = buffer_tx_pool.wait_for_specific_tx_order_id_to(
-            tx_order_id_expected, BUFFER_TX_WAIT_NON_CRITICAL_TIMEOUT_MS);
+        // wait for any packet to become available, this function can timeout
+        if (!buffer_tx_pool.wait_for_transmittable_to(BUFFER_TX_WAIT_NON_CRITICAL_TIMEOUT_MS)) {
+            continue;
+        }
+
+        const int64_t now_64 = calling_instance->buffer_rx->get_rx_time_passed();
+
+        // packet with the earliest transmission time, but only if it is due soon
+        int32_t next_buffer_tx = buffer_tx_pool.pop_earliest_before(now_64 + dispatch_horizon_64);
 
-        // since above function can timeout, we have to check its return value
         if (next_buffer_tx < 0) {
+            common::watch_t::sleep<common::micro>(BUFFER_TX_DISPATCH_POLL_US);
             continue;
         }
 
@@ -860,6 +873,15 @@ void* hw_usrp_t::work_tx(void* hw_usrp) {
 #endif
             ;
 
+        // a burst can only start in the future, otherwise UHD would send it late
+        if (tx_burst_start_time <= now_64) {
+            buffer_tx_pool.abort_dispatched(next_buffer_tx, true);
+            continue;
+        }
+
+        buffer_tx_pool.observe_slack(
+            next_buffer_tx, tx_burst_start_time - now_64, calling_instance->samp_rate);
+
         // construct the stream command for a burst transmission
         uhd::tx_metadata_t tx_md;
         tx_md.start_of_burst = true;
@@ -887,16 +909,6 @@ void* hw_usrp_t::work_tx(void* hw_usrp) {
         while (consecutive_transmission_on) {
             const uint32_t current_buffer_tx = next_buffer_tx;
 
-            // once the current buffer is sent, what will the next ID be?
-            if (buffer_tx_vec[current_buffer_tx]->buffer_tx_meta.tx_order_id_expect_next < 0) {
-                // either increase ID counter for next packet by one ...
-                ++tx_order_id_expected;
-            } else {
-                // ... or overwrite if firmware wants to change the order
-                tx_order_id_expected =
-                    buffer_tx_vec[current_buffer_tx]->buffer_tx_meta.tx_order_id_expect_next;
-            }
-
             ++tx_stats.buffer_tx_sent;
 
             // TX time with time advance
@@ -968,19 +980,36 @@ void* hw_usrp_t::work_tx(void* hw_usrp) {
              */
             if (usrp_tx_gap_samples >= 0) {
                 /* To gap consecutive packets, we must know whether there is a next packet with a
-                 * gap small enough. Thus, here we check for the packet with the correct value of
-                 * tx_order_id_expected. This can be done with a small busy-wait.
+                 * gap small enough. Thus, here we check for the earliest packet starting no later
+                 * than the maximum gap after the current one. This can be done with a small
+                 * busy-wait.
                  */
+                const int64_t tx_time_limit_64 = tx_time_ta_end_64 +
+                                                 static_cast<int64_t>(usrp_tx_gap_samples) + 1
+#ifdef RADIO_HW_IMPLEMENTS_TX_TIME_ADVANCE
+                                                 + tx_time_advance_samples
+#endif
+                    ;
+
                 if (buffer_tx_vec[current_buffer_tx]->buffer_tx_meta.busy_wait_us > 0) {
-                    next_buffer_tx = buffer_tx_pool.wait_for_specific_tx_order_id_busy_to(
-                        tx_order_id_expected,
+                    next_buffer_tx = buffer_tx_pool.pop_earliest_before_busy_to(
+                        tx_time_limit_64,
                         buffer_tx_vec[current_buffer_tx]->buffer_tx_meta.busy_wait_us);
                 } else {
-                    next_buffer_tx =
-                        buffer_tx_pool.get_specific_tx_order_id_if_available(tx_order_id_expected);
+                    next_buffer_tx = buffer_tx_pool.pop_earliest_before(tx_time_limit_64);
                 }
 
-                // packet available?
+                // packets starting before the current one ends cannot be sent
+                const int64_t tx_time_end_64 = tx_time_ta_end_64
+#ifdef RADIO_HW_IMPLEMENTS_TX_TIME_ADVANCE
+                                               + tx_time_advance_samples
+#endif
+                    ;
+
+                next_buffer_tx = buffer_tx_pool.skip_overlapping(
+                    next_buffer_tx, tx_time_limit_64, tx_time_end_64, overlapping_buffer_tx);
+
+                // packet available? its gap is small enough to transmit consecutively
                 if (next_buffer_tx >= 0) {
                     // TX time with time advance
                     const int64_t tx_time_ta_candidate_64 =
@@ -990,28 +1019,21 @@ void* hw_usrp_t::work_tx(void* hw_usrp) {
 #endif
                         ;
 
-                    dectnrp_assert(tx_time_ta_end_64 <= tx_time_ta_candidate_64,
-                                   "packet TX times are out of order {} {} {} {}",
+                    // gap between this buffer's final sample and the next buffer's first sample
+                    const int32_t usrp_tx_gap_candidate_samples =
+                        static_cast<int32_t>(tx_time_ta_candidate_64 - tx_time_ta_end_64);
+
+                    dectnrp_assert(0 <= usrp_tx_gap_candidate_samples &&
+                                       usrp_tx_gap_candidate_samples <= usrp_tx_gap_samples,
+                                   "gap out of range {} {} {} {}",
                                    current_buffer_tx,
                                    tx_time_ta_end_64,
                                    next_buffer_tx,
                                    tx_time_ta_candidate_64);
 
-                    // gap between this buffer's final sample and the next buffer's first sample
-                    const int32_t usrp_tx_gap_candidate_samples =
-                        static_cast<int32_t>(tx_time_ta_candidate_64 - tx_time_ta_end_64);
-
-                    // gap too large? burst ends here
-                    if (usrp_tx_gap_candidate_samples > usrp_tx_gap_samples) {
-                        tx_md.end_of_burst = true;
-                        consecutive_transmission_on = false;
-                    }
-                    // gap small enough? we transmit consecutively
-                    else {
-                        ++tx_stats.buffer_tx_sent_consecutive;
+                    ++tx_stats.buffer_tx_sent_consecutive;
 
-                        usrp_tx_gap_current_samples = usrp_tx_gap_candidate_samples;
-                    }
+                    usrp_tx_gap_current_samples = usrp_tx_gap_candidate_samples;
                 }
                 // no packet found, burst ends here
                 else {
@@ -1085,6 +1107,12 @@ void* hw_usrp_t::work_tx(void* hw_usrp) {
             buffer_tx_vec[current_buffer_tx]->set_transmitted_or_abort();
 
         }  // consecutive_transmission_on
+
+        // packets overlapping with this burst are released only now so the burst is not delayed
+        for (const uint32_t idx : overlapping_buffer_tx) {
+            buffer_tx_pool.abort_dispatched(idx, false);
+        }
+        overlapping_buffer_tx.clear();
     }  // burst time
 
     return nullptr;
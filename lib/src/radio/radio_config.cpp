@@ -38,7 +38,18 @@ radio_config_t::radio_config_t(const std::string directory)
             // hw_name determines which fields are required
             hw_config.hw_name = common::jsonparse::read_string(it, "hw_name");
 
-            hw_config.nof_buffer_tx = common::jsonparse::read_int(it, "nof_buffer_tx", 1, 16);
+            // older configuration files name the same TX sample memory budget nof_buffer_tx
+            if (it->contains("nof_buffer_tx")) {
+                dectnrp_assert(!it->contains("nof_buffer_tx_max_length"),
+                               "nof_buffer_tx was renamed to nof_buffer_tx_max_length, use only the "
+                               "latter");
+
+                hw_config.nof_buffer_tx_max_length =
+                    common::jsonparse::read_int(it, "nof_buffer_tx", 1, 16);
+            } else {
+                hw_config.nof_buffer_tx_max_length =
+                    common::jsonparse::read_int(it, "nof_buffer_tx_max_length", 1, 16);
+            }
 
             hw_config.turnaround_time_us =
                 common::jsonparse::read_int(it, "turnaround_time_us", 10, 5000);
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/radio/buffer_tx_arena.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "dectnrp/common/prog/print.hpp"
+
+using namespace dectnrp;
+
+static constexpr uint32_t unit{radio::buffer_tx_arena_t::unit_samples};
+static constexpr uint32_t slot_length{8 * unit};
+static constexpr uint32_t nof_slots{3};
+static constexpr uint32_t nof_regions_max{nof_slots * 8};
+
+/// released regions merge with the free region before, after, or both
+static bool test_merge() {
+    radio::buffer_tx_arena_t arena(2, slot_length, nof_slots, nof_regions_max);
+
+    const auto a = arena.allocate(unit);
+    const auto b = arena.allocate(unit);
+    const auto c = arena.allocate(unit);
+
+    if (a != 0 || b != unit || c != 2 * unit || arena.get_used_samples() != 3 * unit) {
+        dectnrp_print_wrn("incorrect first-fit offsets");
+        return true;
+    }
+
+    // neither neighbour is free, then a merges with the free region b behind it
+    arena.release(b.value(), unit);
+    arena.release(a.value(), unit);
+
+    auto d = arena.allocate(2 * unit);
+    if (d != 0) {
+        dectnrp_print_wrn("no merge with next free region");
+        return true;
+    }
+    arena.release(d.value(), 2 * unit);
+
+    // d and e take the places of a and b, then e merges with the free region d in front of it
+    d = arena.allocate(unit);
+    const auto e = arena.allocate(unit);
+    arena.release(d.value(), unit);
+    arena.release(e.value(), unit);
+
+    d = arena.allocate(2 * unit);
+    if (d != 0) {
+        dectnrp_print_wrn("no merge with previous free region");
+        return true;
+    }
+    arena.release(d.value(), 2 * unit);
+
+    // c is enclosed by free regions on both sides and merges with both
+    arena.release(c.value(), unit);
+
+    d = arena.allocate(slot_length);
+    if (d != 0) {
+        dectnrp_print_wrn("no merge with previous and next free region");
+        return true;
+    }
+    arena.release(d.value(), slot_length);
+
+    return arena.get_used_samples() != 0;
+}
+
+/// once every slot is taken, allocation fails until a region is released
+static bool test_exhaustion() {
+    radio::buffer_tx_arena_t arena(1, slot_length, nof_slots, nof_regions_max);
+
+    std::vector<uint32_t> offsets;
+    for (uint32_t i = 0; i < nof_slots; ++i) {
+        const auto offset = arena.allocate(slot_length);
+        if (!offset.has_value()) {
+            dectnrp_print_wrn("arena smaller than configured");
+            return true;
+        }
+        offsets.push_back(offset.value());
+    }
+
+    if (arena.allocate(1).has_value() || arena.get_used_samples() != arena.length_samples) {
+        dectnrp_print_wrn("allocation beyond arena");
+        return true;
+    }
+
+    arena.release(offsets[1], slot_length);
+
+    const auto offset = arena.allocate(slot_length - unit + 1);
+    if (offset != offsets[1] || arena.allocate(1).has_value()) {
+        dectnrp_print_wrn("released region not reused");
+        return true;
+    }
+
+    arena.release(offset.value(), slot_length - unit + 1);
+    arena.release(offsets[0], slot_length);
+    arena.release(offsets[2], slot_length);
+
+    return arena.get_used_samples() != 0;
+}
+
+/// with fewer regions than slots allocated, a region of maximum length is always available
+static bool test_max_length_guarantee() {
+    radio::buffer_tx_arena_t arena(1, slot_length, nof_slots, nof_regions_max);
+
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<uint32_t> length_dist(1, slot_length);
+
+    std::vector<std::pair<uint32_t, uint32_t>> allocated;
+
+    for (uint32_t i = 0; i < 100000; ++i) {
+        if (allocated.size() < nof_slots) {
+            const auto offset = arena.allocate(slot_length);
+            if (!offset.has_value()) {
+                dectnrp_print_wrn("no region of maximum length at iteration {}", i);
+                return true;
+            }
+            arena.release(offset.value(), slot_length);
+        }
+
+        const bool do_allocate =
+            allocated.empty() || (allocated.size() < nof_regions_max && gen() % 2 == 0);
+
+        if (do_allocate) {
+            const uint32_t length = length_dist(gen);
+            const auto offset = arena.allocate(length);
+            if (offset.has_value()) {
+                allocated.push_back({offset.value(), length});
+            }
+        } else {
+            const std::size_t idx = gen() % allocated.size();
+            arena.release(allocated[idx].first, allocated[idx].second);
+            allocated[idx] = allocated.back();
+            allocated.pop_back();
+        }
+    }
+
+    for (const auto& [offset, length] : allocated) {
+        arena.release(offset, length);
+    }
+
+    return arena.get_used_samples() != 0;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    bool any_error = false;
+
+    if (test_merge()) {
+        dectnrp_print_wrn("merge test failed");
+        any_error = true;
+    }
+
+    if (test_exhaustion()) {
+        dectnrp_print_wrn("exhaustion test failed");
+        any_error = true;
+    }
+
+    if (test_max_length_guarantee()) {
+        dectnrp_print_wrn("max length guarantee test failed");
+        any_error = true;
+    }
+
+    return any_error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,269 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/radio/buffer_tx_pool.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/radio/buffer_tx_meta.hpp"
+
+namespace dectnrp::radio {
+
+/// takes the role of the radio thread, which is the only consumer of transmittable buffers
+class buffer_tx_pool_test_t {
+    public:
+        static constexpr uint32_t nof_antennas{2};
+        static constexpr uint32_t length_samples{128};
+
+        explicit buffer_tx_pool_test_t(const uint32_t id)
+            : buffer_tx_pool(id, nof_antennas, 1, length_samples * 16) {}
+
+        /// fills a buffer as the PHY does and makes it transmittable
+        bool push(const int64_t tx_time_64, const int64_t tx_order_id) {
+            buffer_tx_t* buffer_tx = buffer_tx_pool.get_buffer_tx_to_fill(length_samples);
+
+            if (buffer_tx == nullptr) {
+                return false;
+            }
+
+            std::vector<cf32_t*> ant_streams(nof_antennas);
+            buffer_tx->get_ant_streams(ant_streams, length_samples);
+            buffer_tx->set_tx_length_samples_cnt(length_samples);
+            buffer_tx->set_transmittable(
+                buffer_tx_meta_t{.tx_order_id = tx_order_id, .tx_time_64 = tx_time_64});
+
+            return true;
+        }
+
+        int32_t pop(const int64_t tx_time_limit_64) {
+            return buffer_tx_pool.pop_earliest_before(tx_time_limit_64);
+        }
+
+        int32_t skip_overlapping(const int32_t idx,
+                                 const int64_t tx_time_limit_64,
+                                 const int64_t tx_time_end_64,
+                                 std::vector<uint32_t>& overlapping) {
+            return buffer_tx_pool.skip_overlapping(
+                idx, tx_time_limit_64, tx_time_end_64, overlapping);
+        }
+
+        int64_t get_tx_time(const int32_t idx) const {
+            return buffer_tx_pool.buffer_tx_vec[idx]->buffer_tx_meta.tx_time_64;
+        }
+
+        int64_t get_tx_order_id(const int32_t idx) const {
+            return buffer_tx_pool.buffer_tx_vec[idx]->buffer_tx_meta.tx_order_id;
+        }
+
+        void set_transmitted(const int32_t idx) {
+            buffer_tx_pool.buffer_tx_vec[idx]->set_transmitted_or_abort();
+        }
+
+        void abort(const int32_t idx, const bool late) {
+            buffer_tx_pool.abort_dispatched(idx, late);
+        }
+
+        int64_t get_late() const { return buffer_tx_pool.dispatch_stats.late.get(); }
+        int64_t get_dropped() const { return buffer_tx_pool.dispatch_stats.dropped.get(); }
+
+        /// true if every buffer and all of the arena can be used again
+        bool is_all_released() const {
+            for (const auto& elem : buffer_tx_pool.buffer_tx_vec) {
+                if (elem->is_outer_locked()) {
+                    return false;
+                }
+            }
+
+            return buffer_tx_pool.buffer_tx_arena.get_used_samples() == 0;
+        }
+
+        buffer_tx_pool_t buffer_tx_pool;
+};
+
+}  // namespace dectnrp::radio
+
+using namespace dectnrp;
+
+/// buffers become transmittable in any order, but are popped by tx_time_64 and then tx_order_id
+static bool test_pop_order() {
+    radio::buffer_tx_pool_test_t test(0);
+
+    const std::vector<std::pair<int64_t, int64_t>> pushed{
+        {500, 0}, {100, 3}, {300, 1}, {100, 1}, {700, 4}, {100, 2}, {200, 5}, {400, 6}};
+
+    for (const auto& [tx_time_64, tx_order_id] : pushed) {
+        if (!test.push(tx_time_64, tx_order_id)) {
+            dectnrp_print_wrn("no buffer available");
+            return true;
+        }
+    }
+
+    const std::vector<std::pair<int64_t, int64_t>> expected{
+        {100, 1}, {100, 2}, {100, 3}, {200, 5}, {300, 1}, {400, 6}, {500, 0}, {700, 4}};
+
+    // the limit is exclusive, so only the first five buffers can be dispatched
+    std::size_t cnt = 0;
+    for (const int64_t tx_time_limit_64 : {int64_t{301}, std::numeric_limits<int64_t>::max()}) {
+        int32_t idx = -1;
+        while ((idx = test.pop(tx_time_limit_64)) >= 0) {
+            if (cnt >= expected.size() || test.get_tx_time(idx) != expected[cnt].first ||
+                test.get_tx_order_id(idx) != expected[cnt].second) {
+                dectnrp_print_wrn("incorrect pop order at {}", cnt);
+                return true;
+            }
+
+            if (test.get_tx_time(idx) >= tx_time_limit_64) {
+                dectnrp_print_wrn("popped buffer beyond limit");
+                return true;
+            }
+
+            test.set_transmitted(idx);
+            ++cnt;
+        }
+
+        if (tx_time_limit_64 == 301 && cnt != 5) {
+            dectnrp_print_wrn("limit not respected");
+            return true;
+        }
+    }
+
+    return cnt != expected.size() || !test.is_all_released();
+}
+
+/// a buffer whose transmission time has passed is aborted and its buffer and region are released
+static bool test_late_abort() {
+    radio::buffer_tx_pool_test_t test(1);
+
+    test.push(1000, 0);
+    test.push(5000, 1);
+
+    const int64_t now_64 = 2000;
+
+    const int32_t idx = test.pop(now_64 + 100);
+
+    if (idx < 0 || test.get_tx_time(idx) >= now_64) {
+        return true;
+    }
+
+    test.abort(idx, true);
+
+    if (test.get_late() != 1 || test.get_dropped() != 0) {
+        return true;
+    }
+
+    // aborted buffer is not in the heap anymore, the next one is not due yet
+    if (test.pop(now_64 + 100) >= 0) {
+        return true;
+    }
+
+    const int32_t idx_next = test.pop(std::numeric_limits<int64_t>::max());
+
+    if (idx_next < 0 || test.get_tx_time(idx_next) != 5000) {
+        return true;
+    }
+
+    test.set_transmitted(idx_next);
+
+    return !test.is_all_released();
+}
+
+/// buffers starting before the end of the packet on air are skipped and dropped, later ones not
+static bool test_overlap_drop() {
+    radio::buffer_tx_pool_test_t test(2);
+
+    const int64_t tx_time_64 = 1000;
+    const int64_t tx_time_end_64 = tx_time_64 + radio::buffer_tx_pool_test_t::length_samples;
+    const int64_t tx_time_limit_64 = tx_time_end_64 + 100;
+
+    test.push(tx_time_64, 0);
+    test.push(tx_time_64 + 10, 1);
+    test.push(tx_time_end_64 - 1, 2);
+    test.push(tx_time_end_64, 3);
+    test.push(tx_time_limit_64, 4);
+
+    const int32_t idx = test.pop(tx_time_64 + 1);
+
+    if (idx < 0 || test.get_tx_time(idx) != tx_time_64) {
+        return true;
+    }
+
+    test.set_transmitted(idx);
+
+    std::vector<uint32_t> overlapping;
+
+    const int32_t idx_next = test.skip_overlapping(
+        test.pop(tx_time_limit_64), tx_time_limit_64, tx_time_end_64, overlapping);
+
+    if (idx_next < 0 || test.get_tx_time(idx_next) != tx_time_end_64) {
+        return true;
+    }
+
+    if (overlapping.size() != 2 || test.get_tx_time(overlapping[0]) != tx_time_64 + 10 ||
+        test.get_tx_time(overlapping[1]) != tx_time_end_64 - 1) {
+        return true;
+    }
+
+    for (const auto overlapping_idx : overlapping) {
+        test.abort(overlapping_idx, false);
+    }
+
+    test.set_transmitted(idx_next);
+
+    // buffer after the limit is neither popped nor skipped
+    if (test.skip_overlapping(-1, tx_time_limit_64, tx_time_end_64, overlapping) >= 0 ||
+        overlapping.size() != 2) {
+        return true;
+    }
+
+    const int32_t idx_last = test.pop(std::numeric_limits<int64_t>::max());
+
+    if (idx_last < 0 || test.get_tx_time(idx_last) != tx_time_limit_64) {
+        return true;
+    }
+
+    test.set_transmitted(idx_last);
+
+    return test.get_dropped() != 2 || test.get_late() != 0 || !test.is_all_released();
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    bool any_error = false;
+
+    if (test_pop_order()) {
+        dectnrp_print_wrn("pop order test failed");
+        any_error = true;
+    }
+
+    if (test_late_abort()) {
+        dectnrp_print_wrn("late abort test failed");
+        any_error = true;
+    }
+
+    if (test_overlap_drop()) {
+        dectnrp_print_wrn("overlap drop test failed");
+        any_error = true;
+    }
+
+    return any_error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,278 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/sections_part3/derivative/packet_sizes_lut.hpp"
+
+#include <algorithm>
+
+#include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/sections_part3/tm_mode.hpp"
+
+namespace dectnrp::sp3 {
+
+packet_sizes_lut_t::packet_sizes_lut_t(const packet_sizes_t& maximum_packet_sizes_)
+    : maximum_packet_sizes(maximum_packet_sizes_),
+      nof_mcs(maximum_packet_sizes_.psdef.mcs_index + 1) {
+    const auto& psdef_max = maximum_packet_sizes.psdef;
+
+    dectnrp_assert(get_u_idx(psdef_max.u) != idx_none, "u undefined");
+    dectnrp_assert(get_b_idx(psdef_max.b) != idx_none, "b undefined");
+
+    index_vec.resize(nof_u * nof_b * nof_PacketLengthType * nof_PacketLength * nof_tm_mode *
+                         nof_mcs,
+                     idx_none);
+
+    for (uint32_t u = 1; u <= psdef_max.u; u *= 2) {
+        for (const uint32_t b : {1U, 2U, 4U, 8U, 12U, 16U}) {
+            if (psdef_max.b < b) {
+                break;
+            }
+
+            for (uint32_t PacketLengthType = 0; PacketLengthType < nof_PacketLengthType;
+                 ++PacketLengthType) {
+                for (uint32_t PacketLength = 1; PacketLength <= nof_PacketLength; ++PacketLength) {
+                    for (uint32_t tm_mode_index = 0; tm_mode_index < nof_tm_mode;
+                         ++tm_mode_index) {
+                        if (maximum_packet_sizes.tm_mode.N_TX <
+                            tmmode::get_tm_mode(tm_mode_index).N_TX) {
+                            continue;
+                        }
+
+                        for (uint32_t mcs_index = 0; mcs_index < nof_mcs; ++mcs_index) {
+                            const packet_sizes_def_t psdef{.u = u,
+                                                           .b = b,
+                                                           .PacketLengthType = PacketLengthType,
+                                                           .PacketLength = PacketLength,
+                                                           .tm_mode_index = tm_mode_index,
+                                                           .mcs_index = mcs_index,
+                                                           .Z = psdef_max.Z};
+
+                            const auto q = sp3::get_packet_sizes(psdef);
+
+                            if (!q.has_value()) {
+                                continue;
+                            }
+
+                            // must fit into buffers allocated for the maximum packet sizes,
+                            // duration is proportional to N_samples_packet / (u * b)
+                            if (maximum_packet_sizes.N_TB_byte < q->N_TB_byte ||
+                                static_cast<uint64_t>(maximum_packet_sizes.N_samples_packet) * u *
+                                        b <
+                                    static_cast<uint64_t>(q->N_samples_packet) * psdef_max.u *
+                                        psdef_max.b) {
+                                continue;
+                            }
+
+                            index_vec[get_index(psdef)] =
+                                static_cast<uint32_t>(packet_sizes_vec.size());
+                            packet_sizes_vec.push_back(q.value());
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    dectnrp_assert(get_packet_sizes(psdef_max) != nullptr, "maximum packet sizes not in table");
+
+    // reverse index
+    reverse_vec.resize(nof_u * nof_b * nof_PacketLengthType * nof_tm_mode * nof_mcs);
+
+    for (uint32_t u = 1; u <= psdef_max.u; u *= 2) {
+        for (const uint32_t b : {1U, 2U, 4U, 8U, 12U, 16U}) {
+            if (psdef_max.b < b) {
+                break;
+            }
+
+            for (uint32_t PacketLengthType = 0; PacketLengthType < nof_PacketLengthType;
+                 ++PacketLengthType) {
+                for (uint32_t tm_mode_index = 0; tm_mode_index < nof_tm_mode; ++tm_mode_index) {
+                    for (uint32_t mcs_index_max = 0; mcs_index_max < nof_mcs; ++mcs_index_max) {
+                        auto& reverse = reverse_vec[get_index_reverse(get_u_idx(u),
+                                                                      get_b_idx(b),
+                                                                      PacketLengthType,
+                                                                      tm_mode_index,
+                                                                      mcs_index_max)];
+
+                        packet_sizes_def_t psdef{.u = u,
+                                                 .b = b,
+                                                 .PacketLengthType = PacketLengthType,
+                                                 .PacketLength = 1,
+                                                 .tm_mode_index = tm_mode_index,
+                                                 .mcs_index = 0,
+                                                 .Z = psdef_max.Z};
+
+                        uint32_t N_TB_byte_best = 0;
+
+                        for (; psdef.PacketLength <= nof_PacketLength; ++psdef.PacketLength) {
+                            uint32_t N_TB_byte = 0;
+
+                            for (psdef.mcs_index = 0; psdef.mcs_index <= mcs_index_max;
+                                 ++psdef.mcs_index) {
+                                const auto* packet_sizes = get_packet_sizes(psdef);
+
+                                if (packet_sizes != nullptr) {
+                                    N_TB_byte = std::max(N_TB_byte, packet_sizes->N_TB_byte);
+                                }
+                            }
+
+                            // longer packets are only listed if they carry more bytes
+                            if (N_TB_byte_best < N_TB_byte) {
+                                reverse.push_back(
+                                    reverse_entry_t{.N_TB_byte = N_TB_byte,
+                                                    .PacketLength = psdef.PacketLength});
+                                N_TB_byte_best = N_TB_byte;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+const packet_sizes_t* packet_sizes_lut_t::get_packet_sizes(const packet_sizes_def_t& psdef) const {
+    const uint32_t index = get_index(psdef);
+
+    if (index == idx_none || index_vec[index] == idx_none) {
+        return nullptr;
+    }
+
+    return &packet_sizes_vec[index_vec[index]];
+}
+
+const packet_sizes_t* packet_sizes_lut_t::get_packet_sizes_min(
+    const uint32_t N_TB_byte,
+    const uint32_t u,
+    const uint32_t b,
+    const uint32_t PacketLengthType,
+    const uint32_t tm_mode_index,
+    const uint32_t mcs_index_max) const {
+    const uint32_t u_idx = get_u_idx(u);
+    const uint32_t b_idx = get_b_idx(b);
+
+    if (u_idx == idx_none || b_idx == idx_none || nof_PacketLengthType <= PacketLengthType ||
+        nof_tm_mode <= tm_mode_index) {
+        return nullptr;
+    }
+
+    const uint32_t mcs_index_max_eff = std::min(mcs_index_max, nof_mcs - 1);
+
+    const auto& reverse = reverse_vec[get_index_reverse(
+        u_idx, b_idx, PacketLengthType, tm_mode_index, mcs_index_max_eff)];
+
+    // shortest packet carrying enough bytes with any of the allowed MCS
+    const auto it = std::lower_bound(
+        reverse.begin(), reverse.end(), N_TB_byte, [](const reverse_entry_t& elem, uint32_t val) {
+            return elem.N_TB_byte < val;
+        });
+
+    if (it == reverse.end()) {
+        return nullptr;
+    }
+
+    // most robust MCS for this packet length
+    packet_sizes_def_t psdef{.u = u,
+                             .b = b,
+                             .PacketLengthType = PacketLengthType,
+                             .PacketLength = it->PacketLength,
+                             .tm_mode_index = tm_mode_index,
+                             .mcs_index = 0,
+                             .Z = maximum_packet_sizes.psdef.Z};
+
+    for (; psdef.mcs_index <= mcs_index_max_eff; ++psdef.mcs_index) {
+        const packet_sizes_t* packet_sizes = get_packet_sizes(psdef);
+
+        if (packet_sizes != nullptr && N_TB_byte <= packet_sizes->N_TB_byte) {
+            return packet_sizes;
+        }
+    }
+
+    dectnrp_assert_failure("reverse index inconsistent");
+
+    return nullptr;
+}
+
+uint32_t packet_sizes_lut_t::get_u_idx(const uint32_t u) {
+    switch (u) {
+        case 1:
+            return 0;
+        case 2:
+            return 1;
+        case 4:
+            return 2;
+        case 8:
+            return 3;
+        default:
+            return idx_none;
+    }
+}
+
+uint32_t packet_sizes_lut_t::get_b_idx(const uint32_t b) {
+    switch (b) {
+        case 1:
+            return 0;
+        case 2:
+            return 1;
+        case 4:
+            return 2;
+        case 8:
+            return 3;
+        case 12:
+            return 4;
+        case 16:
+            return 5;
+        default:
+            return idx_none;
+    }
+}
+
+uint32_t packet_sizes_lut_t::get_index(const packet_sizes_def_t& psdef) const {
+    const uint32_t u_idx = get_u_idx(psdef.u);
+    const uint32_t b_idx = get_b_idx(psdef.b);
+
+    if (u_idx == idx_none || b_idx == idx_none || nof_PacketLengthType <= psdef.PacketLengthType ||
+        psdef.PacketLength == 0 || nof_PacketLength < psdef.PacketLength ||
+        nof_tm_mode <= psdef.tm_mode_index || nof_mcs <= psdef.mcs_index ||
+        psdef.Z != maximum_packet_sizes.psdef.Z) {
+        return idx_none;
+    }
+
+    return ((((u_idx * nof_b + b_idx) * nof_PacketLengthType + psdef.PacketLengthType) *
+                 nof_PacketLength +
+             psdef.PacketLength - 1) *
+                nof_tm_mode +
+            psdef.tm_mode_index) *
+               nof_mcs +
+           psdef.mcs_index;
+}
+
+uint32_t packet_sizes_lut_t::get_index_reverse(const uint32_t u_idx,
+                                               const uint32_t b_idx,
+                                               const uint32_t PacketLengthType,
+                                               const uint32_t tm_mode_index,
+                                               const uint32_t mcs_index_max) const {
+    return (((u_idx * nof_b + b_idx) * nof_PacketLengthType + PacketLengthType) * nof_tm_mode +
+            tm_mode_index) *
+               nof_mcs +
+           mcs_index_max;
+}
+
+}  // namespace dectnrp::sp3
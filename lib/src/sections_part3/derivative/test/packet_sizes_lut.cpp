@@ -0,0 +1,199 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/sections_part3/derivative/packet_sizes_lut.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "dectnrp/common/prog/print.hpp"
+#include "dectnrp/sections_part3/derivative/packet_sizes.hpp"
+#include "dectnrp/sections_part3/tm_mode.hpp"
+
+using namespace dectnrp;
+
+static constexpr uint32_t nof_PacketLengthType{2};
+static constexpr uint32_t nof_PacketLength{16};
+static constexpr uint32_t nof_tm_mode{12};
+
+/// same condition as in the constructor of packet_sizes_lut_t
+static bool is_within_maximum(const sp3::packet_sizes_t& q, const sp3::packet_sizes_t& q_max) {
+    return q.tm_mode.N_TX <= q_max.tm_mode.N_TX && q.N_TB_byte <= q_max.N_TB_byte &&
+           static_cast<uint64_t>(q.N_samples_packet) * q_max.psdef.u * q_max.psdef.b <=
+               static_cast<uint64_t>(q_max.N_samples_packet) * q.psdef.u * q.psdef.b;
+}
+
+static bool is_equal(const sp3::packet_sizes_t& lhs, const sp3::packet_sizes_t& rhs) {
+    return lhs.psdef.u == rhs.psdef.u && lhs.psdef.b == rhs.psdef.b &&
+           lhs.psdef.PacketLengthType == rhs.psdef.PacketLengthType &&
+           lhs.psdef.PacketLength == rhs.psdef.PacketLength &&
+           lhs.psdef.tm_mode_index == rhs.psdef.tm_mode_index &&
+           lhs.psdef.mcs_index == rhs.psdef.mcs_index && lhs.psdef.Z == rhs.psdef.Z &&
+           lhs.N_PACKET_symb == rhs.N_PACKET_symb && lhs.N_PDC_subc == rhs.N_PDC_subc &&
+           lhs.G == rhs.G && lhs.N_TB_bits == rhs.N_TB_bits && lhs.N_TB_byte == rhs.N_TB_byte &&
+           lhs.C == rhs.C && lhs.N_DRS_subc == rhs.N_DRS_subc &&
+           lhs.N_samples_packet == rhs.N_samples_packet;
+}
+
+static bool test_radio_device_class(const std::string& radio_device_class_string) {
+    const auto q_max = sp3::get_maximum_packet_sizes(radio_device_class_string);
+    const auto& psdef_max = q_max.psdef;
+
+    const sp3::packet_sizes_lut_t lut(q_max);
+
+    uint32_t nof_packet_sizes = 0;
+
+    for (uint32_t u = 1; u <= psdef_max.u; u *= 2) {
+        for (const uint32_t b : {1U, 2U, 4U, 8U, 12U, 16U}) {
+            if (psdef_max.b < b) {
+                break;
+            }
+
+            for (uint32_t PacketLengthType = 0; PacketLengthType < nof_PacketLengthType;
+                 ++PacketLengthType) {
+                for (uint32_t tm_mode_index = 0; tm_mode_index < nof_tm_mode; ++tm_mode_index) {
+                    // forward lookup must be identical to get_packet_sizes() within the maximum
+                    std::set<uint32_t> N_TB_byte_set;
+
+                    for (uint32_t PacketLength = 1; PacketLength <= nof_PacketLength;
+                         ++PacketLength) {
+                        for (uint32_t mcs_index = 0; mcs_index <= psdef_max.mcs_index;
+                             ++mcs_index) {
+                            const sp3::packet_sizes_def_t psdef{
+                                .u = u,
+                                .b = b,
+                                .PacketLengthType = PacketLengthType,
+                                .PacketLength = PacketLength,
+                                .tm_mode_index = tm_mode_index,
+                                .mcs_index = mcs_index,
+                                .Z = psdef_max.Z};
+
+                            const auto q = sp3::get_packet_sizes(psdef);
+                            const auto* q_lut = lut.get_packet_sizes(psdef);
+
+                            const bool expected = q.has_value() && is_within_maximum(*q, q_max);
+
+                            if (expected != (q_lut != nullptr) ||
+                                (expected && !is_equal(*q, *q_lut))) {
+                                dectnrp_print_wrn(
+                                    "{} forward lookup incorrect for u={} b={} PacketLengthType={} "
+                                    "PacketLength={} tm_mode_index={} mcs_index={}",
+                                    radio_device_class_string,
+                                    u,
+                                    b,
+                                    PacketLengthType,
+                                    PacketLength,
+                                    tm_mode_index,
+                                    mcs_index);
+                                return true;
+                            }
+
+                            if (expected) {
+                                ++nof_packet_sizes;
+                                N_TB_byte_set.insert(q->N_TB_byte);
+                            }
+                        }
+                    }
+
+                    // test all sizes at which the result can change, plus the neighbours
+                    std::set<uint32_t> N_TB_byte_test{1};
+                    for (const uint32_t N_TB_byte : N_TB_byte_set) {
+                        N_TB_byte_test.insert({N_TB_byte - 1, N_TB_byte, N_TB_byte + 1});
+                    }
+
+                    // reverse lookup must be identical to a brute-force search
+                    for (uint32_t mcs_index_max = 0; mcs_index_max <= psdef_max.mcs_index;
+                         ++mcs_index_max) {
+                        for (const uint32_t N_TB_byte : N_TB_byte_test) {
+                            const sp3::packet_sizes_t* expected = nullptr;
+
+                            for (uint32_t PacketLength = 1;
+                                 PacketLength <= nof_PacketLength && expected == nullptr;
+                                 ++PacketLength) {
+                                for (uint32_t mcs_index = 0; mcs_index <= mcs_index_max;
+                                     ++mcs_index) {
+                                    const auto* q_lut =
+                                        lut.get_packet_sizes({.u = u,
+                                                              .b = b,
+                                                              .PacketLengthType = PacketLengthType,
+                                                              .PacketLength = PacketLength,
+                                                              .tm_mode_index = tm_mode_index,
+                                                              .mcs_index = mcs_index,
+                                                              .Z = psdef_max.Z});
+
+                                    if (q_lut != nullptr && N_TB_byte <= q_lut->N_TB_byte) {
+                                        expected = q_lut;
+                                        break;
+                                    }
+                                }
+                            }
+
+                            if (lut.get_packet_sizes_min(N_TB_byte,
+                                                         u,
+                                                         b,
+                                                         PacketLengthType,
+                                                         tm_mode_index,
+                                                         mcs_index_max) != expected) {
+                                dectnrp_print_wrn(
+                                    "{} reverse lookup incorrect for N_TB_byte={} u={} b={} "
+                                    "PacketLengthType={} tm_mode_index={} mcs_index_max={}",
+                                    radio_device_class_string,
+                                    N_TB_byte,
+                                    u,
+                                    b,
+                                    PacketLengthType,
+                                    tm_mode_index,
+                                    mcs_index_max);
+                                return true;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (nof_packet_sizes != lut.get_nof_packet_sizes() ||
+        lut.get_packet_sizes(psdef_max) == nullptr) {
+        dectnrp_print_wrn("{} number of packet sizes incorrect", radio_device_class_string);
+        return true;
+    }
+
+    return false;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    const std::vector<std::string> rdc_vec = {
+        "1.1.1.A", "8.1.1.A", "1.8.1.A", "2.8.2.A", "2.12.4.A", "8.12.8.A", "8.16.8.A"};
+
+    bool any_error = false;
+
+    for (const auto& rdc : rdc_vec) {
+        if (test_radio_device_class(rdc)) {
+            dectnrp_print_wrn("packet sizes LUT test failed for {}", rdc);
+            any_error = true;
+        }
+    }
+
+    return any_error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
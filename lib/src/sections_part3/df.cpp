@@ -0,0 +1,59 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/sections_part3/df.hpp"
+
+#include "dectnrp/common/prog/assert.hpp"
+
+namespace dectnrp::sp3 {
+
+std::vector<df_pxc_t::run_t> df_pxc_t::get_runs(const std::vector<uint32_t>& k_i) {
+    std::vector<run_t> runs;
+
+    for (const uint32_t k : k_i) {
+        if (!runs.empty() && runs.back().start + runs.back().length == k) {
+            ++runs.back().length;
+            continue;
+        }
+
+        dectnrp_assert(runs.empty() || runs.back().start + runs.back().length < k,
+                       "subcarrier indices not ascending");
+
+        runs.push_back(run_t{k, 1});
+    }
+
+    return runs;
+}
+
+void df_pxc_t::init_k_i_runs_all_symbols() {
+    k_i_runs_all_symbols.clear();
+
+    for (const auto& k_i_b : k_i_all_symbols) {
+        k_i_runs_all_symbols.push_back(common::vec3d<run_t>());
+        for (const auto& k_i_b_N_TS : k_i_b) {
+            k_i_runs_all_symbols.back().push_back(common::vec2d<run_t>());
+            for (const auto& k_i_one_symbol : k_i_b_N_TS) {
+                k_i_runs_all_symbols.back().back().push_back(get_runs(k_i_one_symbol));
+            }
+        }
+    }
+}
+
+}  // namespace dectnrp::sp3
@@ -173,4 +173,22 @@ int srsran_mod_modulate_bytes_FIX(const srsran_modem_table_t* q,
     return nbits / q->nbits_x_symbol;
 }
 
+srsran_mod_t get_srsran_mod(const uint32_t N_bps) {
+    switch (N_bps) {
+        case 1:
+            return SRSRAN_MOD_BPSK;
+        case 2:
+            return SRSRAN_MOD_QPSK;
+        case 4:
+            return SRSRAN_MOD_16QAM;
+        case 6:
+            return SRSRAN_MOD_64QAM;
+        case 8:
+            return SRSRAN_MOD_256QAM;
+        default:
+            dectnrp_assert_failure("no srsRAN modulation with {} bits per symbol", N_bps);
+            return SRSRAN_MOD_BPSK;
+    }
+}
+
 }  // namespace dectnrp::sp3::fix
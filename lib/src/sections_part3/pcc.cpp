@@ -78,12 +78,16 @@ pcc_t::pcc_t(const uint32_t b_max, const uint32_t N_TS_max) {
             k_i_all_symbols[b_idx].push_back(k_i_per_symbol_single);
         }
     }
+
+    init_k_i_runs_all_symbols();
 }
 
 void pcc_t::set_configuration(const uint32_t b, const uint32_t N_TS) {
     config_local_cnt = 0;
     ptr_l_all_symbols = &l_all_symbols[phyres::b2b_idx[b]][phyres::N_TS_2_N_TS_idx_vec[N_TS]];
     ptr_k_i_all_symbols = &k_i_all_symbols[phyres::b2b_idx[b]][phyres::N_TS_2_N_TS_idx_vec[N_TS]];
+    ptr_k_i_runs_all_symbols =
+        &k_i_runs_all_symbols[phyres::b2b_idx[b]][phyres::N_TS_2_N_TS_idx_vec[N_TS]];
 }
 
 bool pcc_t::is_symbol_index(const uint32_t l) {
@@ -107,6 +111,10 @@ const std::vector<uint32_t>& pcc_t::get_k_i_one_symbol() const {
     return ptr_k_i_all_symbols->at(config_local_cnt - 1);
 }
 
+const std::vector<df_pxc_t::run_t>& pcc_t::get_k_i_runs_one_symbol() const {
+    return ptr_k_i_runs_all_symbols->at(config_local_cnt - 1);
+}
+
 std::vector<uint32_t> pcc_t::get_k_i_linear(const uint32_t b, const uint32_t N_TS) {
     // get packet dimensions
     const uint32_t b_idx = phyres::b2b_idx[b];
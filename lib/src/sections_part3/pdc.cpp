@@ -103,6 +103,8 @@ pdc_t::pdc_t(const uint32_t b_max, const uint32_t N_TS_max) {
             k_i_all_symbols[b_idx].push_back(k_i_per_symbol_single);
         }
     }
+
+    init_k_i_runs_all_symbols();
 }
 
 void pdc_t::set_configuration(const uint32_t b, const uint32_t N_TS) {
@@ -111,6 +113,7 @@ void pdc_t::set_configuration(const uint32_t b, const uint32_t N_TS) {
     config_N_TS_idx = phyres::N_TS_2_N_TS_idx_vec[N_TS];
 
     k_i_all_symbols_effective = &k_i_all_symbols[config_b_idx][config_N_TS_idx];
+    k_i_runs_all_symbols_effective = &k_i_runs_all_symbols[config_b_idx][config_N_TS_idx];
 
     if (config_N_TS <= 2) {
         l_limit = 6;    // repetition range starts at this index
@@ -152,6 +155,10 @@ const std::vector<uint32_t>& pdc_t::get_k_i_one_symbol() const {
     return k_i_all_symbols_effective->at(l_equivalent);
 }
 
+const std::vector<df_pxc_t::run_t>& pdc_t::get_k_i_runs_one_symbol() const {
+    return k_i_runs_all_symbols_effective->at(l_equivalent);
+}
+
 uint32_t pdc_t::get_N_DF_symb(const uint32_t u, const uint32_t N_PACKET_symb) {
     if (u == 1) {
         return N_PACKET_symb - 2;
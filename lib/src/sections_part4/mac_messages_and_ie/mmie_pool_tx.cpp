@@ -20,71 +20,17 @@
 
 #include "dectnrp/sections_part4/mac_messages_and_ie/mmie_pool_tx.hpp"
 
-#include "dectnrp/sections_part4/mac_messages_and_ie/association_release_message.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/association_request_message.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/association_response_message.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/broadcast_indication_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/cluster_beacon_message.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/configuration_request_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/group_assignment_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/higher_layer_signalling.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/load_info_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/mac_security_info_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/measurement_report_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/neighbouring_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/network_beacon_message.hpp"
 #include "dectnrp/sections_part4/mac_messages_and_ie/padding_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/radio_device_status_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/random_access_resource_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/rd_capability_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/reconfiguration_request_message.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/reconfiguration_response_message.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/resource_allocation_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/route_info_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/user_plane_data.hpp"
-
-// separated as not standard-compliant
-#include "dectnrp/sections_part4/mac_messages_and_ie/extensions/power_target_ie.hpp"
-#include "dectnrp/sections_part4/mac_messages_and_ie/extensions/time_announce_ie.hpp"
 
 namespace dectnrp::sp4 {
 
 mmie_pool_tx_t::mmie_pool_tx_t() {
-    /* Each MMIE that is already implemented should be contained in the pool at least once. Same
-     * order as in Table 6.3.4-2, Table 6.3.4-3 and Table 6.3.4-4.
-     */
-    // set_nof_elements<padding_ie_t>(1);
-    set_nof_elements<higher_layer_signalling_t>(1);
-    set_nof_elements<user_plane_data_t>(1);
-    // reserved
-    set_nof_elements<network_beacon_message_t>(1);
-    set_nof_elements<cluster_beacon_message_t>(1);
-    set_nof_elements<association_request_message_t>(1);
-    set_nof_elements<association_response_message_t>(1);
-    set_nof_elements<association_release_message_t>(1);
-    set_nof_elements<reconfiguration_request_message_t>(1);
-    set_nof_elements<reconfiguration_response_message_t>(1);
-    // additional MAC messages
-    set_nof_elements<mac_security_info_ie_t>(1);
-    set_nof_elements<route_info_ie_t>(1);
-    set_nof_elements<resource_allocation_ie_t>(1);
-    set_nof_elements<random_access_resource_ie_t>(1);
-    set_nof_elements<rd_capability_ie_t>(1);
-    set_nof_elements<neighbouring_ie_t>(1);
-    set_nof_elements<broadcast_indication_ie_t>(1);
-    set_nof_elements<group_assignment_ie_t>(1);
-    set_nof_elements<load_info_ie_t>(1);
-    set_nof_elements<measurement_report_ie_t>(1);
-    // reserved
-    // escape
-    // IE type extension
-    set_nof_elements<configuration_request_ie_t>(1);
-    set_nof_elements<radio_device_status_ie_t>(1);
-    /*
-     * The following MMIEs are not part of the standard, and exist only in this project.
-     */
-    set_nof_elements<extensions::power_target_ie_t>(1);
-    set_nof_elements<extensions::time_announce_ie_t>(1);
+    // each MMIE in mmie_types_t is contained in the pool at least once
+    std::apply(
+        []<typename... Ts>(mmie_array_t<Ts>&... arr) {
+            ((arr.elements = std::make_unique<Ts[]>(1), arr.size = 1), ...);
+        },
+        pool);
 }
 
 void mmie_pool_tx_t::fill_with_padding_ies(uint8_t* mac_pdu_offset,
@@ -24,6 +24,7 @@
 #include "dectnrp/common/prog/assert.hpp"
 #include "dectnrp/sections_part4/mac_messages_and_ie/cluster_beacon_message.hpp"
 #include "dectnrp/sections_part4/mac_messages_and_ie/extensions/power_target_ie.hpp"
+#include "dectnrp/sections_part4/mac_messages_and_ie/mmie_pool_tx.hpp"
 #include "dectnrp/sections_part4/mac_messages_and_ie/padding_ie.hpp"
 #include "dectnrp/sections_part4/mac_messages_and_ie/resource_allocation_ie.hpp"
 #include "dectnrp/sections_part4/mac_messages_and_ie/user_plane_data.hpp"
@@ -43,7 +44,7 @@ void mac_multiplexing_header_t::zero() {
     mac_ext = mac_ext_t::not_defined;
     ie_type.mac_ext_00_01_10 = ie_type_mac_ext_00_01_10_t::not_defined;
     length = common::adt::UNDEFINED_NUMERIC_32;
-    tinfo = nullptr;
+    mmie_idx = mmie_idx_undefined;
 }
 
 bool mac_multiplexing_header_t::is_valid() const {
@@ -146,7 +147,8 @@ bool mac_multiplexing_header_t::unpack([[maybe_unused]] const uint8_t* mac_pdu_o
 
 bool mac_multiplexing_header_t::unpack_mac_ext_ie_type(const uint8_t* mac_pdu_offset) {
     dectnrp_assert(mac_ext == mac_ext_t::not_defined &&
-                       length == common::adt::UNDEFINED_NUMERIC_32 && tinfo == nullptr,
+                       length == common::adt::UNDEFINED_NUMERIC_32 &&
+                       mmie_idx == mmie_idx_undefined,
                    "fields not zero");
 
     mac_ext = common::adt::from_coded_value<mac_ext_t>(mac_pdu_offset[0] >> 6);
@@ -171,115 +173,115 @@ bool mac_multiplexing_header_t::unpack_mac_ext_ie_type(const uint8_t* mac_pdu_of
 
 #ifdef ACTIVATE_Padding_IE
                     case Padding_IE:
-                        tinfo = &typeid(padding_ie_t);
+                        mmie_idx = mmie_idx_padding;
                         break;
 #endif
 
 #ifdef ACTIVATE_Network_Beacon_Message
                     case Network_Beacon_Message:
-                        tinfo = &typeid(network_beacon_message_t);
+                        mmie_idx = mmie_index_v<network_beacon_message_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Cluster_Beacon_Message
                     case Cluster_Beacon_Message:
-                        tinfo = &typeid(cluster_beacon_message_t);
+                        mmie_idx = mmie_index_v<cluster_beacon_message_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Association_Request_Message
                     case Association_Request_Message:
-                        tinfo = &typeid(association_request_message_t);
+                        mmie_idx = mmie_index_v<association_request_message_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Association_Response_Message
                     case Association_Response_Message:
-                        tinfo = &typeid(association_response_message_t);
+                        mmie_idx = mmie_index_v<association_response_message_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Association_Release_Message
                     case Association_Release_Message:
-                        tinfo = &typeid(association_release_message_t);
+                        mmie_idx = mmie_index_v<association_release_message_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Reconfiguration_Request_Message
                     case Reconfiguration_Request_Message:
-                        tinfo = &typeid(reconfiguration_request_message_t);
+                        mmie_idx = mmie_index_v<reconfiguration_request_message_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Reconfiguration_Response_Message
                     case Reconfiguration_Response_Message:
-                        tinfo = &typeid(reconfiguration_response_message_t);
+                        mmie_idx = mmie_index_v<reconfiguration_response_message_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_MAC_Security_Info_IE
                     case Security_Info_IE:
-                        tinfo = &typeid(mac_security_info_ie_t);
+                        mmie_idx = mmie_index_v<mac_security_info_ie_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Route_Info_IE
                     case Route_Info_IE:
-                        tinfo = &typeid(route_info_ie_t);
+                        mmie_idx = mmie_index_v<route_info_ie_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Resource_Allocation_IE
                     case Resource_Allocation_IE:
-                        tinfo = &typeid(resource_allocation_ie_t);
+                        mmie_idx = mmie_index_v<resource_allocation_ie_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Random_Access_Resource_IE
                     case Random_Access_Resource_IE:
-                        tinfo = &typeid(random_access_resource_ie_t);
+                        mmie_idx = mmie_index_v<random_access_resource_ie_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_RD_Capability_IE
                     case RD_Capability_IE:
-                        tinfo = &typeid(rd_capability_ie_t);
+                        mmie_idx = mmie_index_v<rd_capability_ie_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Neighbouring_IE
                     case Neighbouring_IE:
-                        tinfo = &typeid(neighbouring_ie_t);
+                        mmie_idx = mmie_index_v<neighbouring_ie_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Broadcast_Indication_IE
                     case Broadcast_Indication_IE:
-                        tinfo = &typeid(broadcast_indication_ie_t);
+                        mmie_idx = mmie_index_v<broadcast_indication_ie_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Load_Info_IE
                     case Load_Info_IE:
-                        tinfo = &typeid(load_info_ie_t);
+                        mmie_idx = mmie_index_v<load_info_ie_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Measurement_Report_IE
                     case Measurement_Report_IE:
-                        tinfo = &typeid(measurement_report_ie_t);
+                        mmie_idx = mmie_index_v<measurement_report_ie_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Power_Target_IE
                     case Power_Target_IE:
-                        tinfo = &typeid(extensions::power_target_ie_t);
+                        mmie_idx = mmie_index_v<extensions::power_target_ie_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Time_Announce_IE
                     case Time_Announce_IE:
-                        tinfo = &typeid(extensions::time_announce_ie_t);
+                        mmie_idx = mmie_index_v<extensions::time_announce_ie_t>;
                         break;
 #endif
 
@@ -303,14 +305,14 @@ bool mac_multiplexing_header_t::unpack_mac_ext_ie_type(const uint8_t* mac_pdu_of
 
 #ifdef ACTIVATE_Padding_IE
                     case Padding_IE:
-                        tinfo = &typeid(padding_ie_t);
+                        mmie_idx = mmie_idx_padding;
                         break;
 #endif
 
 #ifdef ACTIVATE_Higher_Layer_Signalling
                     case Higher_Layer_Signalling_Flow_1:
                     case Higher_Layer_Signalling_Flow_2:
-                        tinfo = &typeid(higher_layer_signalling_t);
+                        mmie_idx = mmie_index_v<higher_layer_signalling_t>;
                         break;
 #endif
 
@@ -319,13 +321,13 @@ bool mac_multiplexing_header_t::unpack_mac_ext_ie_type(const uint8_t* mac_pdu_of
                     case User_Plane_Data_Flow_2:
                     case User_Plane_Data_Flow_3:
                     case User_Plane_Data_Flow_4:
-                        tinfo = &typeid(user_plane_data_t);
+                        mmie_idx = mmie_index_v<user_plane_data_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Group_Assignment_IE
                     case Group_Assignment_IE:
-                        tinfo = &typeid(group_assignment_ie_t);
+                        mmie_idx = mmie_index_v<group_assignment_ie_t>;
                         break;
 #endif
 
@@ -350,7 +352,7 @@ bool mac_multiplexing_header_t::unpack_mac_ext_ie_type(const uint8_t* mac_pdu_of
 #ifdef ACTIVATE_Higher_Layer_Signalling
                     case Higher_Layer_Signalling_Flow_1:
                     case Higher_Layer_Signalling_Flow_2:
-                        tinfo = &typeid(higher_layer_signalling_t);
+                        mmie_idx = mmie_index_v<higher_layer_signalling_t>;
                         break;
 #endif
 
@@ -359,13 +361,13 @@ bool mac_multiplexing_header_t::unpack_mac_ext_ie_type(const uint8_t* mac_pdu_of
                     case User_Plane_Data_Flow_2:
                     case User_Plane_Data_Flow_3:
                     case User_Plane_Data_Flow_4:
-                        tinfo = &typeid(user_plane_data_t);
+                        mmie_idx = mmie_index_v<user_plane_data_t>;
                         break;
 #endif
 
 #ifdef ACTIVATE_Group_Assignment_IE
                     case Group_Assignment_IE:
-                        tinfo = &typeid(group_assignment_ie_t);
+                        mmie_idx = mmie_index_v<group_assignment_ie_t>;
                         break;
 #endif
 
@@ -396,13 +398,13 @@ bool mac_multiplexing_header_t::unpack_mac_ext_ie_type(const uint8_t* mac_pdu_of
 
 #ifdef ACTIVATE_Padding_IE
                             case Padding_IE:
-                                tinfo = &typeid(padding_ie_t);
+                                mmie_idx = mmie_idx_padding;
                                 break;
 #endif
 
 #ifdef ACTIVATE_Configuration_Request_IE
                             case Configuration_Request_IE:
-                                tinfo = &typeid(configuration_request_ie_t);
+                                mmie_idx = mmie_index_v<configuration_request_ie_t>;
                                 break;
 #endif
 
@@ -422,13 +424,13 @@ bool mac_multiplexing_header_t::unpack_mac_ext_ie_type(const uint8_t* mac_pdu_of
 
 #ifdef ACTIVATE_Padding_IE
                             case Padding_IE:
-                                tinfo = &typeid(padding_ie_t);
+                                mmie_idx = mmie_idx_padding;
                                 break;
 #endif
 
 #ifdef ACTIVATE_Radio_Device_Status_IE
                             case Radio_Device_Status_IE:
-                                tinfo = &typeid(radio_device_status_ie_t);
+                                mmie_idx = mmie_index_v<radio_device_status_ie_t>;
                                 break;
 #endif
 
@@ -447,7 +449,7 @@ bool mac_multiplexing_header_t::unpack_mac_ext_ie_type(const uint8_t* mac_pdu_of
             break;
     }
 
-    return tinfo != nullptr;
+    return mmie_idx != mmie_idx_undefined;
 }
 
 void mac_multiplexing_header_t::unpack_length(const uint8_t* mac_pdu_offset) {
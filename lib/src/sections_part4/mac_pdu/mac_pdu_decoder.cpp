@@ -20,6 +20,10 @@
 
 #include "dectnrp/sections_part4/mac_pdu/mac_pdu_decoder.hpp"
 
+#include <array>
+#include <type_traits>
+#include <utility>
+
 #include "dectnrp/common/prog/assert.hpp"
 #include "dectnrp/limits.hpp"
 #include "dectnrp/sections_part4/mac_messages_and_ie/higher_layer_signalling.hpp"
@@ -29,12 +33,46 @@
 
 namespace dectnrp::sp4 {
 
+namespace {
+
+/// properties of an MMIE type the decoder must know, resolved at compile time
+struct mmie_decoding_t {
+        bool is_packing_peeking;
+        bool is_packing;
+        void (*set_mu)(mmie_t* mmie, const uint32_t mu);
+};
+
+template <typename T>
+constexpr mmie_decoding_t get_mmie_decoding() {
+    mmie_decoding_t ret{.is_packing_peeking = std::is_base_of_v<mmie_packing_peeking_t, T>,
+                        .is_packing = std::is_base_of_v<mmie_packing_t, T>,
+                        .set_mu = nullptr};
+
+    if constexpr (std::is_base_of_v<mu_depending_t, T>) {
+        ret.set_mu = [](mmie_t* mmie, const uint32_t mu) { static_cast<T*>(mmie)->set_mu(mu); };
+    }
+
+    return ret;
+}
+
+template <std::size_t... Is>
+constexpr std::array<mmie_decoding_t, sizeof...(Is)> get_mmie_decoding_table(
+    std::index_sequence<Is...>) {
+    return {get_mmie_decoding<std::tuple_element_t<Is, mmie_types_t>>()...};
+}
+
+/// jump table from the MMIE index decoded in the MAC multiplexing header to MMIE properties
+constexpr std::array<mmie_decoding_t, mmie_types_size> mmie_decoding_table =
+    get_mmie_decoding_table(std::make_index_sequence<mmie_types_size>{});
+
+}  // namespace
+
 mac_pdu_decoder_t::mac_pdu_decoder_t() {
     // the RX pool has to contain some MAC messages/IEs more than once
     set_nof_elements<higher_layer_signalling_t>(limits::max_nof_higher_layer_signalling);
     set_nof_elements<user_plane_data_t>(limits::max_nof_user_plane_data_per_mac_pdu);
 
-    index_next_ie.reserve(get_nof_mmie());
+    index_next_ie.fill(0);
     mmie_decoded_vec.reserve(get_nof_mmie_elements());
 }
 
@@ -59,9 +97,7 @@ void mac_pdu_decoder_t::set_configuration(uint8_t* a_,
     N_bytes_required = mht.get_packed_size();
     mmh.zero();
     mmie = nullptr;
-    for (auto& elem : index_next_ie) {
-        elem.second = 0;
-    }
+    index_next_ie.fill(0);
     mmie_decoded_vec.clear();
 
     dectnrp_assert(a_cnt_r + N_bytes_required <= a_cnt_w_tb, "first state requires too many bytes");
@@ -174,14 +210,14 @@ void mac_pdu_decoder_t::decode(const uint32_t a_cnt_w_) noexcept {
                      * Type: 00000, the receiver can assume that the rest of the MAC PDU, except the
                      * MIC, is padding."
                      */
-                    if (*mmh.tinfo == typeid(padding_ie_t)) {
+                    if (mmh.mmie_idx == mac_multiplexing_header_t::mmie_idx_padding) {
                         prepare_mac_pdu_premature_abort();
                         break;
                     }
 
                     // get a pointer to the corresponding MMIE, and by that implicitly check whether
                     // another instance of the MMIE is still available in the pool
-                    if ((mmie = get_mmie_from_pool(*mmh.tinfo)) == nullptr) {
+                    if ((mmie = get_mmie_from_pool(mmh.mmie_idx)) == nullptr) {
                         prepare_mac_pdu_premature_abort();
                         break;
                     }
@@ -192,9 +228,7 @@ void mac_pdu_decoder_t::decode(const uint32_t a_cnt_w_) noexcept {
                      * Otherwise, we have to determine the size by peeking at the packed MAC
                      * message/IE.
                      */
-                    if (mmie_packing_peeking_t* mmie_packing_peeking =
-                            dynamic_cast<mmie_packing_peeking_t*>(mmie);
-                        mmie_packing_peeking != nullptr) {
+                    if (mmie_decoding_table[mmh.mmie_idx].is_packing_peeking) {
                         // make a copy of the MAC multiplexing header
                         mmie->mac_multiplexing_header = mmh;
 
@@ -204,7 +238,8 @@ void mac_pdu_decoder_t::decode(const uint32_t a_cnt_w_) noexcept {
                         state = B_MAC_MESSAGE_IE_PEEK;
 
                         // read enough bytes to peak the MMIE size
-                        N_bytes_required = mmie_packing_peeking->get_packed_size_min_to_peek();
+                        N_bytes_required = static_cast<mmie_packing_peeking_t*>(mmie)
+                                               ->get_packed_size_min_to_peek();
                     } else {
                         // a_cnt_r is not incremented here, but in the next state
                         // A_MAC_MUX_HEADER_UNPACK_LENGTH_OR_FIXED_SIZE
@@ -242,9 +277,12 @@ void mac_pdu_decoder_t::decode(const uint32_t a_cnt_w_) noexcept {
 
             case B_MAC_MESSAGE_IE_PEEK:
                 {
+                    const auto& mmie_decoding =
+                        mmie_decoding_table[mmie->mac_multiplexing_header.mmie_idx];
+
                     // set subcarrier scaling factor if applicable
-                    if (mu_depending_t* mu_depending = dynamic_cast<mu_depending_t*>(mmie)) {
-                        mu_depending->set_mu(mu);
+                    if (mmie_decoding.set_mu != nullptr) {
+                        mmie_decoding.set_mu(mmie, mu);
                     }
 
                     // a_cnt_r is not incremented here by the size required to peek, but instead the
@@ -253,7 +291,7 @@ void mac_pdu_decoder_t::decode(const uint32_t a_cnt_w_) noexcept {
                     state = MAC_MESSAGE_IE_UNPACK;
 
                     if (const auto res =
-                            dynamic_cast<mmie_packing_peeking_t*>(mmie)->get_packed_size_by_peeking(
+                            static_cast<mmie_packing_peeking_t*>(mmie)->get_packed_size_by_peeking(
                                 a + a_cnt_r)) {
                         N_bytes_required = res.value();
                     } else {
@@ -268,15 +306,16 @@ void mac_pdu_decoder_t::decode(const uint32_t a_cnt_w_) noexcept {
                 {
                     bool is_mmie_unpacked_content_valid = true;
 
-                    if (auto packing = dynamic_cast<mmie_packing_t*>(mmie); packing != nullptr) {
+                    if (mmie_decoding_table[mmie->mac_multiplexing_header.mmie_idx].is_packing) {
                         // unpack must return true, otherwise one of the fields is set incorrectly
-                        if (!packing->unpack(a + a_cnt_r)) {
+                        if (!static_cast<mmie_packing_t*>(mmie)->unpack(a + a_cnt_r)) {
                             is_mmie_unpacked_content_valid = false;
                         }
                     } else {
-                        auto flowing = dynamic_cast<mmie_flowing_t*>(mmie);
+                        auto flowing = static_cast<mmie_flowing_t*>(mmie);
 
-                        dectnrp_assert(flowing != nullptr, "must be flowing");
+                        dectnrp_assert(dynamic_cast<mmie_flowing_t*>(mmie) != nullptr,
+                                       "must be flowing");
 
                         // not really unpacking, instead we save the pointer from which we can copy
                         flowing->data_ptr = const_cast<uint8_t*>(a + a_cnt_r);
@@ -284,7 +323,7 @@ void mac_pdu_decoder_t::decode(const uint32_t a_cnt_w_) noexcept {
 
                     if (is_mmie_unpacked_content_valid) {
                         // increment index of next available MMIE
-                        ++index_next_ie[*mmie->mac_multiplexing_header.tinfo];
+                        ++index_next_ie[mmie->mac_multiplexing_header.mmie_idx];
 
                         // message IE is valid, add to vector containing decoded IEs
                         mmie_decoded_vec.push_back(mmie);
@@ -340,10 +379,8 @@ bool mac_pdu_decoder_t::has_reached_valid_final_state() const noexcept {
            ((state == STATES::MAC_PDU_DONE) or (state == STATES::MAC_PDU_PREMATURE_ABORT));
 };
 
-mmie_t* mac_pdu_decoder_t::get_mmie_from_pool(const std::type_index& type_idx) noexcept {
-    auto& vec = pool[type_idx];
-    std::size_t& i = index_next_ie[type_idx];
-    return i < vec.size() ? vec[i].get() : nullptr;
+mmie_t* mac_pdu_decoder_t::get_mmie_from_pool(const std::size_t mmie_idx) const noexcept {
+    return get_by_index_or_nullptr(mmie_idx, index_next_ie[mmie_idx]);
 }
 
 }  // namespace dectnrp::sp4
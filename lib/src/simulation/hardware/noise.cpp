@@ -20,24 +20,185 @@
 
 #include "dectnrp/simulation/hardware/noise.hpp"
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <numbers>
+
+#include "dectnrp/common/prog/assert.hpp"
 
 namespace dectnrp::simulation {
 
-noise_t::noise_t(const uint32_t seed_) { srsran_channel_awgn_init(&srsran_channel_awgn, seed_); }
+/* Philox4x32-10 from J. K. Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC'11.
+ * The generator and the transform are written as loops over a block of samples without branches,
+ * which the compiler vectorizes with the widest SIMD instructions available.
+ */
+static constexpr uint32_t philox_M0{0xD2511F53};
+static constexpr uint32_t philox_M1{0xCD9E8D57};
+static constexpr uint32_t philox_W0{0x9E3779B9};
+static constexpr uint32_t philox_W1{0xBB67AE85};
+static constexpr uint32_t philox_rounds{10};
+
+/// number of complex samples per block, requires half as many calls of the generator
+static constexpr uint32_t B{64};
+
+/// one round on words x0 to x3, see Salmon et al., Fig. 2
+static inline void philox_round(uint32_t& x0,
+                                uint32_t& x1,
+                                uint32_t& x2,
+                                uint32_t& x3,
+                                const uint32_t key0,
+                                const uint32_t key1) {
+    const uint64_t p0 = uint64_t{philox_M0} * x0;
+    const uint64_t p1 = uint64_t{philox_M1} * x2;
+
+    const uint32_t y0 = static_cast<uint32_t>(p1 >> 32) ^ x1 ^ key0;
+    const uint32_t y2 = static_cast<uint32_t>(p0 >> 32) ^ x3 ^ key1;
+
+    x0 = y0;
+    x1 = static_cast<uint32_t>(p1);
+    x2 = y2;
+    x3 = static_cast<uint32_t>(p0);
+}
+
+/// four output words of B/2 consecutive counters
+static void philox_block(const uint64_t counter,
+                         const uint32_t ant_idx,
+                         uint32_t key0,
+                         uint32_t key1,
+                         uint32_t (&x)[4][B / 2]) {
+    for (uint32_t i = 0; i < B / 2; ++i) {
+        x[0][i] = static_cast<uint32_t>(counter + i);
+        x[1][i] = static_cast<uint32_t>((counter + i) >> 32);
+        x[2][i] = ant_idx;
+        x[3][i] = 0;
+    }
+
+    for (uint32_t r = 0; r < philox_rounds; ++r) {
+        for (uint32_t i = 0; i < B / 2; ++i) {
+            philox_round(x[0][i], x[1][i], x[2][i], x[3][i], key0, key1);
+        }
+
+        key0 += philox_W0;
+        key1 += philox_W1;
+    }
+}
+
+/// natural logarithm for u in (0,1], relative error below 1e-7
+static inline float log_approx(const float u) {
+    const uint32_t bits = std::bit_cast<uint32_t>(u);
+
+    // u = m * 2^e with m in [sqrt(0.5), sqrt(2))
+    float m = std::bit_cast<float>((bits & 0x007FFFFF) | 0x3F800000);
+    float e = static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+    const bool m_large = m > std::numbers::sqrt2_v<float>;
+    m = m_large ? m * 0.5f : m;
+    e = m_large ? e + 1.0f : e;
+
+    // ln(m) = 2 * atanh(s) with |s| < 0.172
+    const float s = (m - 1.0f) / (m + 1.0f);
+    const float s2 = s * s;
+    const float p = 1.0f + s2 * (1.0f / 3.0f + s2 * (1.0f / 5.0f + s2 * (1.0f / 7.0f + s2 / 9.0f)));
+
+    return e * std::numbers::ln2_v<float> + 2.0f * s * p;
+}
+
+/// Box-Muller transform of n pairs of words, noise is added to interleaved real and imag parts
+static inline void add_block(const uint32_t* w_r,
+                             const uint32_t* w_phi,
+                             const float N0,
+                             const float* inp,
+                             float* out,
+                             const uint32_t n) {
+    for (uint32_t i = 0; i < n; ++i) {
+        // uniform in (0,1], so the logarithm is finite
+        const float u = static_cast<float>(static_cast<int32_t>((w_r[i] >> 8) + 1)) * 0x1p-24f;
+
+        // N0/2 per dimension
+        const float r = std::sqrt(-N0 * log_approx(u));
 
-noise_t::~noise_t() { srsran_channel_awgn_free(&srsran_channel_awgn); }
+        // angle is q*pi/2 + x with quadrant q and x uniform in [-pi/4, pi/4)
+        const uint32_t q = w_phi[i] >> 30;
+        const float t = static_cast<float>(static_cast<int32_t>((w_phi[i] >> 6) & 0x00FFFFFF));
+        const float x = (t * 0x1p-24f - 0.5f) * (std::numbers::pi_v<float> / 2.0f);
+        const float x2 = x * x;
 
-void noise_t::awgn(const cf_t* inp,
+        // Taylor series, error below 4e-7 for |x| <= pi/4
+        const float s = x * (1.0f + x2 * (-1.0f / 6.0f + x2 * (1.0f / 120.0f - x2 / 5040.0f)));
+        const float c =
+            1.0f +
+            x2 * (-1.0f / 2.0f + x2 * (1.0f / 24.0f + x2 * (-1.0f / 720.0f + x2 / 40320.0f)));
+
+        // rotate by q*pi/2
+        const bool q_odd = (q & 1) == 1;
+        const float cos_abs = q_odd ? s : c;
+        const float sin_abs = q_odd ? c : s;
+        const float cos_phi = (q == 1 || q == 2) ? -cos_abs : cos_abs;
+        const float sin_phi = (q >= 2) ? -sin_abs : sin_abs;
+
+        out[2 * i] = inp[2 * i] + r * cos_phi;
+        out[2 * i + 1] = inp[2 * i + 1] + r * sin_phi;
+    }
+}
+
+noise_t::noise_t(const uint32_t seed_, const uint32_t stream_)
+    : seed(seed_),
+      stream(stream_) {
+    reset();
+}
+
+void noise_t::awgn(const uint32_t ant_idx,
+                   const cf_t* inp,
                    cf_t* out,
                    const uint32_t nof_samples,
                    const float net_bandwidth_norm,
                    const float snr_in_net_bandwidth_norm_dB) {
-    // https://github.com/srsran/srsRAN_4G/blob/master/lib/src/phy/channel/ch_awgn.c#L108
-    srsran_channel_awgn_set_n0(&srsran_channel_awgn,
-                               -10.0f * log10(net_bandwidth_norm) - snr_in_net_bandwidth_norm_dB);
+    dectnrp_assert(ant_idx < counter.size(), "antenna index out of range");
+
+    // noise power across full bandwidth for a signal power of 1 within the net bandwidth
+    const float N0 =
+        std::pow(10.0f, (-10.0f * std::log10(net_bandwidth_norm) - snr_in_net_bandwidth_norm_dB) /
+                            10.0f);
+
+    const float* inp_f = reinterpret_cast<const float*>(inp);
+    float* out_f = reinterpret_cast<float*>(out);
+
+    uint32_t x[4][B / 2];
+
+    for (uint32_t offset = 0; offset < nof_samples; offset += B) {
+        philox_block(counter[ant_idx], ant_idx, seed, stream, x);
+
+        // a partial block at the end still consumes all counters of the block
+        counter[ant_idx] += B / 2;
+
+        const uint32_t n = std::min(B, nof_samples - offset);
+
+        // first half of block from words 0 and 1, second half from words 2 and 3
+        add_block(x[0], x[1], N0, &inp_f[2 * offset], &out_f[2 * offset], std::min(n, B / 2));
+
+        if (n > B / 2) {
+            add_block(x[2],
+                      x[3],
+                      N0,
+                      &inp_f[2 * (offset + B / 2)],
+                      &out_f[2 * (offset + B / 2)],
+                      n - B / 2);
+        }
+    }
+}
+
+void noise_t::reset() { counter.fill(0); }
+
+std::array<uint32_t, 4> noise_t::philox4x32_10(std::array<uint32_t, 4> x,
+                                               std::array<uint32_t, 2> key) {
+    for (uint32_t r = 0; r < philox_rounds; ++r) {
+        philox_round(x[0], x[1], x[2], x[3], key[0], key[1]);
+
+        key[0] += philox_W0;
+        key[1] += philox_W1;
+    }
 
-    srsran_channel_awgn_run_c(&srsran_channel_awgn, inp, out, nof_samples);
+    return x;
 }
 
 }  // namespace dectnrp::simulation
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2023-present Maxim Penner
+ *
+ * This file is part of DECTNRP.
+ *
+ * DECTNRP is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * DECTNRP is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ */
+
+#include "dectnrp/simulation/hardware/noise.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "dectnrp/common/prog/print.hpp"
+
+using namespace dectnrp;
+
+/// known-answer vectors of Philox4x32-10 from Random123, counter, key and output
+static bool test_philox() {
+    struct kat_t {
+            std::array<uint32_t, 4> x;
+            std::array<uint32_t, 2> key;
+            std::array<uint32_t, 4> y;
+    };
+
+    const std::vector<kat_t> kat_vec{
+        {{0x00000000, 0x00000000, 0x00000000, 0x00000000},
+         {0x00000000, 0x00000000},
+         {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+        {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+         {0xffffffff, 0xffffffff},
+         {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+        {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+         {0xa4093822, 0x299f31d0},
+         {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}}};
+
+    for (const auto& kat : kat_vec) {
+        if (simulation::noise_t::philox4x32_10(kat.x, kat.key) != kat.y) {
+            dectnrp_print_wrn("Philox4x32-10 output does not match known answer");
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// mean, variance, kurtosis and correlation of the Gaussian output
+static bool test_moments() {
+    constexpr uint32_t N{1U << 20};
+
+    // N0 = 1, so real and imaginary part each have variance 1/2
+    simulation::noise_t noise(123, 0);
+    std::vector<cf_t> samples(N, cf_t{0.0f, 0.0f});
+    noise.awgn(0, samples.data(), samples.data(), N, 1.0f, 0.0f);
+
+    double sum[2]{}, sum2[2]{}, sum4[2]{}, sum_re_im{};
+    for (const auto& elem : samples) {
+        const double v[2]{__real__ elem, __imag__ elem};
+        for (uint32_t d = 0; d < 2; ++d) {
+            sum[d] += v[d];
+            sum2[d] += v[d] * v[d];
+            sum4[d] += v[d] * v[d] * v[d] * v[d];
+        }
+        sum_re_im += v[0] * v[1];
+    }
+
+    bool any_error = false;
+
+    for (uint32_t d = 0; d < 2; ++d) {
+        const double mean = sum[d] / N;
+        const double var = sum2[d] / N - mean * mean;
+        const double kurtosis = (sum4[d] / N) / (var * var);
+
+        // standard errors are about 7e-4 for the mean, 7e-4 for the variance and 5e-3 for kurtosis
+        if (std::abs(mean) > 5.0e-3 || std::abs(var - 0.5) > 5.0e-3 ||
+            std::abs(kurtosis - 3.0) > 0.03) {
+            dectnrp_print_wrn("dimension {} mean={} var={} kurtosis={}", d, mean, var, kurtosis);
+            any_error = true;
+        }
+    }
+
+    if (std::abs(sum_re_im / N) > 5.0e-3) {
+        dectnrp_print_wrn("real and imaginary part correlated");
+        any_error = true;
+    }
+
+    return any_error;
+}
+
+/// identical seed and stream give identical noise, a different stream or antenna does not
+static bool test_streams() {
+    constexpr uint32_t N{1000};
+
+    auto generate = [](simulation::noise_t& noise, const uint32_t ant_idx) {
+        std::vector<cf_t> samples(N, cf_t{0.0f, 0.0f});
+        noise.awgn(ant_idx, samples.data(), samples.data(), N, 1.0f, 0.0f);
+        return samples;
+    };
+
+    auto is_equal = [](const std::vector<cf_t>& a, const std::vector<cf_t>& b) {
+        for (uint32_t i = 0; i < N; ++i) {
+            if (__real__ a[i] != __real__ b[i] || __imag__ a[i] != __imag__ b[i]) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    simulation::noise_t noise_a(7, 0);
+    simulation::noise_t noise_b(7, 0);
+    simulation::noise_t noise_c(7, 1);
+
+    const auto a = generate(noise_a, 0);
+
+    if (!is_equal(a, generate(noise_b, 0)) || is_equal(a, generate(noise_c, 0)) ||
+        is_equal(a, generate(noise_b, 1)) || is_equal(a, generate(noise_a, 0))) {
+        dectnrp_print_wrn("noise streams not reproducible or not independent");
+        return true;
+    }
+
+    noise_a.reset();
+
+    if (!is_equal(a, generate(noise_a, 0))) {
+        dectnrp_print_wrn("reset does not restart the counter");
+        return true;
+    }
+
+    return false;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv) {
+    bool any_error = false;
+
+    if (test_philox()) {
+        dectnrp_print_wrn("Philox test failed");
+        any_error = true;
+    }
+
+    if (test_moments()) {
+        dectnrp_print_wrn("moments test failed");
+        any_error = true;
+    }
+
+    if (test_streams()) {
+        dectnrp_print_wrn("streams test failed");
+        any_error = true;
+    }
+
+    return any_error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <cmath>
 
+#include "dectnrp/common/adt/decibels.hpp"
 #include "dectnrp/common/prog/assert.hpp"
 #include "dectnrp/common/thread/watch.hpp"
 #include "dectnrp/simulation/topology/graph.hpp"
@@ -62,7 +63,16 @@ vspace_t::vspace_t(const uint32_t nof_hw_simulator_,
 
     wchannel_randomgen.shuffle();
 
-    wchannel_noise_source = std::make_unique<noise_t>(wchannel_randomgen.randi(0, UINT32_MAX - 1));
+#ifdef SIMULATION_NOISE_SEED
+    wchannel_seed = SIMULATION_NOISE_SEED;
+#else
+    wchannel_seed = wchannel_randomgen.randi(0, UINT32_MAX - 1);
+#endif
+
+    // every hw has its own noise stream, so noise does not depend on the order of reading
+    for (uint32_t i = 0; i < nof_hw_simulator; ++i) {
+        wchannel_noise_source_vec.push_back(std::make_unique<noise_t>(wchannel_seed, i));
+    }
 
     // as for the topology, we assume a complete graph
     wchannel_inter_vec.resize(topology::complete_graph_nof_edges(nof_hw_simulator));
@@ -384,8 +394,8 @@ void vspace_t::wchannel_generate_graph() {
 
             // instantiate same channel for each edge
             if (sim_channel_name_inter == channel_awgn_t::name) {
-                wchannel_inter_vec[edge_cnt] =
-                    std::make_unique<channel_awgn_t>(i, j, samp_rate_common, spp_size_common);
+                wchannel_inter_vec[edge_cnt] = std::make_unique<channel_awgn_t>(
+                    i, j, samp_rate_common, spp_size_common, wchannel_get_seed(i, j));
 
             } else if (sim_channel_name_inter.substr(0, channel_doubly_t::name.size()) ==
                        channel_doubly_t::name) {
@@ -396,7 +406,8 @@ void vspace_t::wchannel_generate_graph() {
                                                        spp_size_common,
                                                        vspptx_vec[i]->nof_antennas,
                                                        vspptx_vec[j]->nof_antennas,
-                                                       sim_channel_name_inter);
+                                                       sim_channel_name_inter,
+                                                       wchannel_get_seed(i, j));
             } else if (sim_channel_name_inter.substr(0, channel_flat_t::name.size()) ==
                        channel_flat_t::name) {
                 wchannel_inter_vec[edge_cnt] =
@@ -405,7 +416,8 @@ void vspace_t::wchannel_generate_graph() {
                                                      samp_rate_common,
                                                      spp_size_common,
                                                      vspptx_vec[i]->nof_antennas,
-                                                     vspptx_vec[j]->nof_antennas);
+                                                     vspptx_vec[j]->nof_antennas,
+                                                     wchannel_get_seed(i, j));
             } else {
                 dectnrp_assert_failure("Unknown channel name.");
             }
@@ -420,8 +432,8 @@ void vspace_t::wchannel_generate_graph() {
     for (uint32_t i = 0; i < nof_hw_simulator; ++i) {
         // instantiate same channel for each edge
         if (sim_channel_name_intra == channel_awgn_t::name) {
-            wchannel_intra_vec[i] =
-                std::make_unique<channel_awgn_t>(i, i, samp_rate_common, spp_size_common);
+            wchannel_intra_vec[i] = std::make_unique<channel_awgn_t>(
+                i, i, samp_rate_common, spp_size_common, wchannel_get_seed(i, i));
 
         } else if (sim_channel_name_intra.substr(0, channel_doubly_t::name.size()) ==
                    channel_doubly_t::name) {
@@ -431,7 +443,8 @@ void vspace_t::wchannel_generate_graph() {
                                                                        spp_size_common,
                                                                        vspptx_vec[i]->nof_antennas,
                                                                        vspptx_vec[i]->nof_antennas,
-                                                                       sim_channel_name_intra);
+                                                                       sim_channel_name_intra,
+                                                                       wchannel_get_seed(i, i));
         } else if (sim_channel_name_intra.substr(0, channel_flat_t::name.size()) ==
                    channel_flat_t::name) {
             wchannel_intra_vec[i] = std::make_unique<channel_flat_t>(i,
@@ -439,13 +452,19 @@ void vspace_t::wchannel_generate_graph() {
                                                                      samp_rate_common,
                                                                      spp_size_common,
                                                                      vspptx_vec[i]->nof_antennas,
-                                                                     vspptx_vec[i]->nof_antennas);
+                                                                     vspptx_vec[i]->nof_antennas,
+                                                                     wchannel_get_seed(i, i));
         } else {
             dectnrp_assert_failure("Unknown channel name.");
         }
     }
 }
 
+uint32_t vspace_t::wchannel_get_seed(const uint32_t id_0, const uint32_t id_1) const {
+    // spread the index of every pair of simulators across all bits
+    return wchannel_seed ^ ((id_0 * nof_hw_simulator + id_1 + 1) * 0x9e3779b9U);
+}
+
 void vspace_t::wchannel_execute(vspprx_t& vspprx) const {
     // step 0: create reference to own transmission
     const vspptx_t& vspptx = *vspptx_vec[vspprx.id].get();
@@ -464,6 +483,14 @@ void vspace_t::wchannel_execute(vspprx_t& vspprx) const {
         const uint32_t idx =
             topology::complete_graph_sorted_edge_index(nof_hw_simulator, vspprx.id, i);
 
+#ifdef SIMULATION_VSPACE_PRUNE_BELOW_NOISE_DB
+        // received signal would be buried in noise
+        if (wchannel_is_prunable(vspptx, vspprx, *vspptx_vec[i].get())) {
+            wchannel_inter_vec[idx]->skip(vspprx, *vspptx_vec[i].get());
+            continue;
+        }
+#endif
+
         // pass transmitted spp through channel and add output to received spp
         wchannel_inter_vec[idx]->superimpose(vspptx, vspprx, *vspptx_vec[i].get());
     }
@@ -490,26 +517,65 @@ void vspace_t::wchannel_execute(vspprx_t& vspprx) const {
     if (noise_type == NOISE_TYPE_t::relative) {
         // add noise across full bandwidth
         for (size_t i = 0; i < vspprx.nof_antennas; ++i) {
-            wchannel_noise_source->awgn(vspprx.spp.at(i),
-                                        vspprx.spp.at(i),
-                                        vspprx.spp_size,
-                                        vspptx.meta.net_bandwidth_norm,
-                                        vspprx.meta.rx_snr_in_net_bandwidth_norm_dB);
+            wchannel_noise_source_vec[vspprx.id]->awgn(
+                i,
+                vspprx.spp.at(i),
+                vspprx.spp.at(i),
+                vspprx.spp_size,
+                vspptx.meta.net_bandwidth_norm,
+                vspprx.meta.rx_snr_in_net_bandwidth_norm_dB);
         }
     } else if (noise_type == NOISE_TYPE_t::thermal) {
-        // calculate absolute noise power
-        const float noise_power_dBm = -174.0f + 10.0f * log10(static_cast<float>(samp_rate_common));
-
         // add noise across full bandwidth
         for (size_t i = 0; i < vspprx.nof_antennas; ++i) {
-            wchannel_noise_source->awgn(vspprx.spp.at(i),
-                                        vspprx.spp.at(i),
-                                        vspprx.spp_size,
-                                        1.0f,
-                                        vspprx.meta.rx_power_ant_0dBFS.at(i) - noise_power_dBm -
-                                            vspprx.meta.rx_noise_figure_dB);
+            wchannel_noise_source_vec[vspprx.id]->awgn(
+                i,
+                vspprx.spp.at(i),
+                vspprx.spp.at(i),
+                vspprx.spp_size,
+                1.0f,
+                -wchannel_get_noise_floor_dB(vspptx, vspprx, i));
+        }
+    }
+}
+
+float vspace_t::wchannel_get_noise_floor_dB(const vspptx_t& vspptx,
+                                             const vspprx_t& vspprx,
+                                             const size_t rx_idx) const {
+    if (noise_type == NOISE_TYPE_t::relative) {
+        return -10.0f * std::log10(vspptx.meta.net_bandwidth_norm) -
+               vspprx.meta.rx_snr_in_net_bandwidth_norm_dB;
+    }
+
+    // absolute noise power across full bandwidth
+    const float noise_power_dBm =
+        -174.0f + 10.0f * std::log10(static_cast<float>(samp_rate_common));
+
+    return noise_power_dBm + vspprx.meta.rx_noise_figure_dB -
+           vspprx.meta.rx_power_ant_0dBFS.at(rx_idx);
+}
+
+#ifdef SIMULATION_VSPACE_PRUNE_BELOW_NOISE_DB
+bool vspace_t::wchannel_is_prunable(const vspptx_t& vspptx,
+                                    const vspprx_t& vspprx,
+                                    const vspptx_t& vspptx_other) const {
+    for (size_t rx_idx = 0; rx_idx < vspprx.nof_antennas; ++rx_idx) {
+        const float threshold_dB = wchannel_get_noise_floor_dB(vspptx, vspprx, rx_idx) -
+                                   SIMULATION_VSPACE_PRUNE_BELOW_NOISE_DB;
+
+        for (size_t tx_idx = 0; tx_idx < vspptx_other.nof_antennas; ++tx_idx) {
+            // received power of a TX signal with unit power
+            const float rx_power_dB = common::adt::mag2db(channel_t::get_large_scale_via_pathloss(
+                vspptx, vspprx, vspptx_other, tx_idx, rx_idx));
+
+            if (rx_power_dB >= threshold_dB) {
+                return false;
+            }
         }
     }
+
+    return true;
 }
+#endif
 
 }  // namespace dectnrp::simulation
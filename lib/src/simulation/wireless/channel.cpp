@@ -32,11 +32,14 @@ namespace dectnrp::simulation {
 channel_t::channel_t(const uint32_t id_0_,
                      const uint32_t id_1_,
                      const uint32_t samp_rate_,
-                     const uint32_t spp_size_)
+                     const uint32_t spp_size_,
+                     const uint32_t seed_)
     : id_0(id_0_),
       id_1(id_1_),
       samp_rate(samp_rate_),
       spp_size(spp_size_) {
+    randomgen.set_seed(seed_);
+
     large_scale_stage = srsran_vec_cf_malloc(spp_size);
     small_scale_stage = srsran_vec_cf_malloc(spp_size);
 }
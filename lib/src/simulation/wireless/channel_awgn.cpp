@@ -33,14 +33,20 @@ const std::string channel_awgn_t::name = "awgn";
 channel_awgn_t::channel_awgn_t(const uint32_t id_0_,
                                const uint32_t id_1_,
                                const uint32_t samp_rate_,
-                               const uint32_t spp_size_)
-    : channel_t(id_0_, id_1_, samp_rate_, spp_size_) {}
+                               const uint32_t spp_size_,
+                               const uint32_t seed_)
+    : channel_t(id_0_, id_1_, samp_rate_, spp_size_, seed_) {}
 
 void channel_awgn_t::superimpose(const vspptx_t& vspptx,
                                  vspprx_t& vspprx,
                                  const vspptx_t& vspptx_other) const {
     dectnrp_assert(are_args_valid(vspptx_other, vspprx), "Incorrect two nodes");
 
+    // channel without memory, nothing to superimpose if other device is not transmitting
+    if (vspptx_other.tx_idx < 0) {
+        return;
+    }
+
     // superimpose every TX antenna ..
     for (uint32_t tx_idx = 0; tx_idx < vspptx_other.nof_antennas; ++tx_idx) {
         // ... onto every RX antenna
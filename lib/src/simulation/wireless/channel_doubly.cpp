@@ -37,8 +37,9 @@ channel_doubly_t::channel_doubly_t(const uint32_t id_0_,
                                    const uint32_t spp_size_,
                                    const uint32_t nof_antennas_0_,
                                    const uint32_t nof_antennas_1_,
-                                   const std::string sim_channel_name_intxx_)
-    : channel_t(id_0_, id_1_, samp_rate_, spp_size_),
+                                   const std::string sim_channel_name_intxx_,
+                                   const uint32_t seed_)
+    : channel_t(id_0_, id_1_, samp_rate_, spp_size_, seed_),
       nof_antennas_0(nof_antennas_0_),
       nof_antennas_1(nof_antennas_1_) {
     // init all links ...
@@ -63,10 +64,20 @@ void channel_doubly_t::superimpose(const vspptx_t& vspptx,
     // a single link has two directions, is this the primary direction?
     const bool primary_direction = vspptx_other.id < vspprx.id;
 
+    // no TX samples in this spp
+    const bool inp_is_zero = vspptx_other.tx_idx < 0;
+
     // superimpose every TX antenna ...
     for (uint32_t tx_idx = 0; tx_idx < vspptx_other.nof_antennas; ++tx_idx) {
         // ... onto every RX antenna
         for (uint32_t rx_idx = 0; rx_idx < vspprx.nof_antennas; ++rx_idx) {
+            auto& link = link_vec[tx_idx * vspprx.nof_antennas + rx_idx];
+
+            // zero input and zero history lead to zero output
+            if (inp_is_zero && link->is_history_zero(primary_direction)) {
+                continue;
+            }
+
             // large scale also includes RX sensitivity
             const float large_scale =
                 get_large_scale_via_pathloss(vspptx, vspprx, vspptx_other, tx_idx, rx_idx);
@@ -76,8 +87,11 @@ void channel_doubly_t::superimpose(const vspptx_t& vspptx,
                 vspptx_other.spp[tx_idx], large_scale, large_scale_stage, vspprx.spp_size);
 
             // apply small scale fading
-            link_vec[tx_idx * vspprx.nof_antennas + rx_idx]->pass_through_link(
-                large_scale_stage, small_scale_stage, primary_direction, vspptx.meta.now_64);
+            link->pass_through_link(large_scale_stage,
+                                    small_scale_stage,
+                                    primary_direction,
+                                    vspptx.meta.now_64,
+                                    inp_is_zero);
 
             // apply superposition
             srsran_vec_sum_ccc(
@@ -86,10 +100,22 @@ void channel_doubly_t::superimpose(const vspptx_t& vspptx,
     }
 }
 
+void channel_doubly_t::skip(const vspprx_t& vspprx, const vspptx_t& vspptx_other) const {
+    dectnrp_assert(are_args_valid(vspptx_other, vspprx), "Incorrect two devices");
+
+    const bool primary_direction = vspptx_other.id < vspprx.id;
+
+    for (uint32_t tx_idx = 0; tx_idx < vspptx_other.nof_antennas; ++tx_idx) {
+        for (uint32_t rx_idx = 0; rx_idx < vspprx.nof_antennas; ++rx_idx) {
+            link_vec[tx_idx * vspprx.nof_antennas + rx_idx]->set_history_zero(primary_direction);
+        }
+    }
+}
+
 void channel_doubly_t::randomize_small_scale() {
     // (re-)randomize every single link
     for (auto& elem : link_vec) {
-        elem->randomize();
+        elem->randomize(randomgen);
     }
 }
 
@@ -25,7 +25,6 @@ extern "C" {
 }
 
 #include "dectnrp/common/prog/assert.hpp"
-#include "dectnrp/common/randomgen.hpp"
 
 namespace dectnrp::simulation {
 
@@ -36,8 +35,9 @@ channel_flat_t::channel_flat_t(const uint32_t id_0_,
                                const uint32_t samp_rate_,
                                const uint32_t spp_size_,
                                const uint32_t nof_antennas_0_,
-                               const uint32_t nof_antennas_1_)
-    : channel_t(id_0_, id_1_, samp_rate_, spp_size_),
+                               const uint32_t nof_antennas_1_,
+                               const uint32_t seed_)
+    : channel_t(id_0_, id_1_, samp_rate_, spp_size_, seed_),
       nof_antennas_0(nof_antennas_0_),
       nof_antennas_1(nof_antennas_1_) {
     coeffs.resize(nof_antennas_0 * nof_antennas_1);
@@ -50,6 +50,11 @@ void channel_flat_t::superimpose(const vspptx_t& vspptx,
                                  const vspptx_t& vspptx_other) const {
     dectnrp_assert(are_args_valid(vspptx_other, vspprx), "Incorrect two devices");
 
+    // channel without memory, nothing to superimpose if other device is not transmitting
+    if (vspptx_other.tx_idx < 0) {
+        return;
+    }
+
     // superimpose every TX antenna ..
     for (uint32_t tx_idx = 0; tx_idx < vspptx_other.nof_antennas; ++tx_idx) {
         // ... onto every RX antenna
@@ -76,10 +81,6 @@ void channel_flat_t::superimpose(const vspptx_t& vspptx,
 }
 
 void channel_flat_t::randomize_small_scale() {
-    // time dependent random numbers
-    common::randomgen_t randomgen;
-    randomgen.shuffle();
-
     // Rayleigh flat
     for (uint32_t i = 0; i < coeffs.size(); ++i) {
         coeffs[i] =
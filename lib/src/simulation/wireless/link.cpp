@@ -32,7 +32,6 @@ extern "C" {
 #include "dectnrp/common/adt/decibels.hpp"
 #include "dectnrp/common/prog/assert.hpp"
 #include "dectnrp/common/prog/log.hpp"
-#include "dectnrp/common/randomgen.hpp"
 
 namespace dectnrp::simulation {
 
@@ -54,11 +53,20 @@ link_t::link_t(const uint32_t samp_rate_,
         history_stage = srsran_vec_cf_malloc(spp_size * 2);
     }
 
+    ones_stage = srsran_vec_cf_malloc(spp_size);
+    for (uint32_t i = 0; i < spp_size; ++i) {
+        ones_stage[i] = cf_t{1.0f, 0.0f};
+    }
+
     sinusoid_stage = srsran_vec_cf_malloc(spp_size);
     superposition_stage = srsran_vec_cf_malloc(spp_size);
 
+    // set_pdp() can be called again, so allocate for the maximum number of taps
+    for (uint32_t i = 0; i < WIRELESS_CHANNEL_DOUBLY_NOF_TAPS; ++i) {
+        tap_coeff_stage_vec.push_back(srsran_vec_cf_malloc(spp_size));
+    }
+
     set_pdp();
-    randomize();
 }
 
 link_t::~link_t() {
@@ -66,8 +74,13 @@ link_t::~link_t() {
         free(history_stage);
     }
 
+    free(ones_stage);
     free(sinusoid_stage);
     free(superposition_stage);
+
+    for (auto tap_coeff_stage : tap_coeff_stage_vec) {
+        free(tap_coeff_stage);
+    }
 }
 
 void link_t::set_pdp() {
@@ -75,6 +88,9 @@ void link_t::set_pdp() {
     tap_delays_smpl.clear();
     tap_powers_linear.clear();
 
+    // coefficients depend on the tap powers
+    tap_coeff_time_64 = INT64_MIN;
+
     const double Ts = 1.0 / static_cast<double>(samp_rate);
 
     // go over entire PDP and count the finite values
@@ -159,11 +175,7 @@ void link_t::print_pdp(const std::string prefix) const {
     dectnrp_log_inf("{}", info);
 }
 
-void link_t::randomize() {
-    // time dependent random numbers
-    common::randomgen_t randomgen;
-    randomgen.shuffle();
-
+void link_t::randomize(common::randomgen_t& randomgen) {
     const double samp_rate_d = static_cast<double>(samp_rate);
 
     /* Clarke's model assumes evenly distributed angles of arrival. Jakes' model assumes randomly
@@ -208,28 +220,62 @@ void link_t::randomize() {
         srsran_vec_cf_zero(history_stage, spp_size * 2);
     }
 
+    history_is_zero_arr.fill(true);
+
     srsran_vec_cf_zero(sinusoid_stage, spp_size);
     srsran_vec_cf_zero(superposition_stage, spp_size);
+
+    // coefficients of the former sinusoids are invalid
+    tap_coeff_time_64 = INT64_MIN;
 }
 
 void link_t::pass_through_link(const cf_t* inp,
                                cf_t* out,
                                const bool primary_direction,
-                               const int64_t time_64) {
+                               const int64_t time_64,
+                               const bool inp_is_zero) {
     // zero output, used for superposition
     srsran_vec_cf_zero(out, spp_size);
 
-    cf_t* history_stage = primary_direction ? history_stage_arr[0] : history_stage_arr[1];
+    const uint32_t dir_idx = primary_direction ? 0 : 1;
+
+    cf_t* history_stage = history_stage_arr[dir_idx];
+
+    // former calls may have been skipped
+    if (history_is_zero_arr[dir_idx]) {
+        srsran_vec_cf_zero(history_stage, spp_size);
+    }
 
     // copy input right next to former samples
     srsran_vec_cf_copy(&history_stage[spp_size], inp, spp_size);
 
+    // the other direction may have already calculated the coefficients at this time
+    if (time_64 != tap_coeff_time_64) {
+        set_tap_coeff(time_64);
+    }
+
     for (uint32_t i = 0; i < tap_delays_smpl.size(); ++i) {
         // offset of this tap
         const uint32_t offset = spp_size - tap_delays_smpl[i];
 
-        // on the superposition stage, we superimpose the sinusoids of this tap
-        srsran_vec_cf_zero(superposition_stage, spp_size);
+        // apply time-variant coefficient to delayed input
+        srsran_vec_prod_ccc(
+            tap_coeff_stage_vec[i], &history_stage[offset], superposition_stage, spp_size);
+
+        // superimpose taps
+        srsran_vec_sum_ccc(superposition_stage, out, out, spp_size);
+    }
+
+    // overwrite history
+    srsran_vec_cf_copy(history_stage, inp, spp_size);
+
+    history_is_zero_arr[dir_idx] = inp_is_zero;
+}
+
+void link_t::set_tap_coeff(const int64_t time_64) {
+    for (uint32_t i = 0; i < tap_delays_smpl.size(); ++i) {
+        // on the tap coefficient stage, we superimpose the sinusoids of this tap
+        srsran_vec_cf_zero(tap_coeff_stage_vec[i], spp_size);
 
         for (uint32_t j = 0; j < WIRELESS_CHANNEL_DOUBLY_NOF_SINUSOIDS; ++j) {
             // phase rotation sample to sample
@@ -250,13 +296,14 @@ void link_t::pass_through_link(const cf_t* inp,
 
             // rotate
             volk_32fc_s32fc_x2_rotator2_32fc((lv_32fc_t*)sinusoid_stage,
-                                             (const lv_32fc_t*)&history_stage[offset],
+                                             (const lv_32fc_t*)ones_stage,
                                              &rotA,
                                              &rotB,
                                              spp_size);
 
             // superimpose sinusoids of this tap
-            srsran_vec_sum_ccc(sinusoid_stage, superposition_stage, superposition_stage, spp_size);
+            srsran_vec_sum_ccc(
+                sinusoid_stage, tap_coeff_stage_vec[i], tap_coeff_stage_vec[i], spp_size);
         }
 
         /* Each complex sinusoid has an RMS of 1, and therefore a power of 1. If we have 40
@@ -269,14 +316,10 @@ void link_t::pass_through_link(const cf_t* inp,
         scale *= sqrt(tap_powers_linear[i]);
 
         // scale with the number of sinusoids and the tap power
-        srsran_vec_sc_prod_cfc(superposition_stage, scale, superposition_stage, spp_size);
-
-        // superimpose taps
-        srsran_vec_sum_ccc(superposition_stage, out, out, spp_size);
+        srsran_vec_sc_prod_cfc(tap_coeff_stage_vec[i], scale, tap_coeff_stage_vec[i], spp_size);
     }
 
-    // overwrite history
-    srsran_vec_cf_copy(history_stage, inp, spp_size);
+    tap_coeff_time_64 = time_64;
 }
 
 constexpr double link_t::tap_delays_ns_generic[WIRELESS_CHANNEL_DOUBLY_NOF_PROFILE]
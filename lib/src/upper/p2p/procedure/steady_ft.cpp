@@ -46,7 +46,7 @@ steady_ft_t::steady_ft_t(args_t& args, ft_t& ft_)
     // ##################################################
     // MAC Layer
 
-    ft.contact_list.reserve(10);
+    ft.contact_list.reserve(rd.N_pt);
 
     // init contact list
     for (uint32_t firmware_id_pt = 0; firmware_id_pt < rd.N_pt; ++firmware_id_pt) {
@@ -67,6 +67,7 @@ steady_ft_t::steady_ft_t(args_t& args, ft_t& ft_)
         contact.identity = identity_pt;
         contact.allocation_pt = init_allocation_pt(firmware_id_pt);
         contact.mimo_csi = phy::mimo_csi_t();
+        contact.dispersion_csi = phy::dispersion_csi_t();
         contact.conn_idx_server = conn_idx_server;
         contact.conn_idx_client = conn_idx_client;
 
@@ -277,30 +278,37 @@ phy::maclow_phy_t steady_ft_t::worksub_pcc_21(const phy::phy_maclow_t& phy_maclo
 
     dectnrp_assert(plcf_21 != nullptr, "cast ill-formed");
 
+    // local index of sending PT, single lookup in a dense table
+    const auto contact_idx = ft.contact_list.get_idx_from_srdid(plcf_21->TransmitterIdentity);
+
     // is this a packet from the correct network, from a known PT, and for this FT?
-    if (plcf_21->ShortNetworkID != rd.identity_ft.ShortNetworkID ||
-        !ft.contact_list.is_srdid_known(plcf_21->TransmitterIdentity) ||
+    if (plcf_21->ShortNetworkID != rd.identity_ft.ShortNetworkID || !contact_idx.has_value() ||
         plcf_21->ReceiverIdentity != rd.identity_ft.ShortRadioDeviceID) {
         return phy::maclow_phy_t();
     }
 
-    // load long radio device ID of sending PT
-    const auto lrdid = ft.contact_list.get_lrdid_from_srdid(plcf_21->TransmitterIdentity);
-
     // load contact information of PT
-    auto& contact = ft.contact_list.get_contact(lrdid);
+    auto& contact = ft.contact_list.get_contact_from_idx(contact_idx.value());
+
+    // long radio device ID of sending PT
+    const auto lrdid = contact.identity.LongRadioDeviceID;
 
     contact.sync_report = phy_maclow.sync_report;
 
     contact.mimo_csi.update_from_feedback(
         plcf_21->FeedbackFormat, plcf_21->feedback_info_pool, phy_maclow.sync_report);
 
-    return worksub_pcc2pdc(phy_maclow,
-                           2,
-                           rd.identity_ft.NetworkID,
-                           0,
-                           phy::harq::finalize_rx_t::reset_and_terminate,
-                           phy::maclow_phy_handle_t(phy::handle_pcc2pdc_t::th21, lrdid));
+    auto maclow_phy = worksub_pcc2pdc(phy_maclow,
+                                      2,
+                                      rd.identity_ft.NetworkID,
+                                      0,
+                                      phy::harq::finalize_rx_t::reset_and_terminate,
+                                      phy::maclow_phy_handle_t(phy::handle_pcc2pdc_t::th21, lrdid));
+
+    // let the PHY pick channel estimation based on the known channel of this PT
+    maclow_phy.dispersion_hint = contact.dispersion_csi.get_hint();
+
+    return maclow_phy;
 }
 
 phy::machigh_phy_t steady_ft_t::worksub_pdc_10(
@@ -336,8 +344,11 @@ phy::machigh_phy_t steady_ft_t::worksub_pdc_21(const phy::phy_machigh_t& phy_mac
 
         const sp4::user_plane_data_t* upd = static_cast<sp4::user_plane_data_t*>(mmie);
 
-        if (rd.application_client->write_nto(
-                contact.conn_idx_client, upd->get_data_ptr(), upd->get_data_size()) > 0) {
+        // user plane data is not copied, instead the HARQ process stays pinned until forwarded
+        if (rd.application_client->write_ref_nto(contact.conn_idx_client,
+                                                  upd->get_data_ptr(),
+                                                  upd->get_data_size(),
+                                                  phy_machigh.maclow_phy.hp_rx) > 0) {
             ++datagram_cnt;
         }
     }
@@ -348,6 +359,8 @@ phy::machigh_phy_t steady_ft_t::worksub_pdc_21(const phy::phy_machigh_t& phy_mac
         rd.cqi_lut.get_highest_mcs_possible(phy_machigh.pdc_report.snr_dB),
         phy_machigh.phy_maclow.sync_report);
 
+    contact.dispersion_csi.update_from_phy(phy_machigh.pdc_report.dispersion_report);
+
     return phy::machigh_phy_t();
 }
 
@@ -20,6 +20,8 @@
 
 #include "dectnrp/upper/p2p/procedure/steady_pt.hpp"
 
+#include <algorithm>
+
 #include "dectnrp/common/prog/assert.hpp"
 #include "dectnrp/common/prog/log.hpp"
 #include "dectnrp/sections_part4/mac_messages_and_ie/mmie.hpp"
@@ -40,6 +42,7 @@ steady_pt_t::steady_pt_t(args_t& args, pt_t& pt_)
     pt.contact_pt.identity = init_identity_pt(tpoint_config.firmware_id);
     pt.contact_pt.allocation_pt = init_allocation_pt(tpoint_config.firmware_id);
     pt.contact_pt.mimo_csi = phy::mimo_csi_t();
+    pt.contact_pt.dispersion_csi = phy::dispersion_csi_t();
     pt.contact_pt.conn_idx_server = 0;
     pt.contact_pt.conn_idx_client = 0;
 
@@ -81,9 +84,18 @@ phy::machigh_phy_t steady_pt_t::work_irregular(const phy::irregular_report_t& ir
     // update time of callbacks
     rd.callbacks.run(buffer_rx.get_rx_time_passed());
 
+    /* Wake up exactly when the next callback is due. Callbacks can also be added while processing
+     * packets, so we wake up at least once per beacon period. The period is counted from the time
+     * this call was requested for, not from the time it was processed, so it does not drift.
+     */
     ret.irregular_report =
         irregular_report.get_same_with_time_increment(rd.allocation_ft.get_beacon_period());
 
+    if (rd.callbacks.get_next_64() < ret.irregular_report.call_asap_after_this_time_has_passed_64) {
+        ret.irregular_report =
+            phy::irregular_report_t(rd.callbacks.get_next_64(), irregular_report.handle);
+    }
+
     return ret;
 }
 
@@ -113,7 +125,8 @@ phy::irregular_report_t steady_pt_t::entry() {
         duration_lut.get_N_samples_from_duration(sp3::duration_ec_t::s001,
                                                  rd.worksub_callback_log_period_sec));
 
-    return phy::irregular_report_t(now_64 + rd.allocation_ft.get_beacon_period());
+    return phy::irregular_report_t(
+        std::min(rd.callbacks.get_next_64(), now_64 + rd.allocation_ft.get_beacon_period()));
 }
 
 std::optional<phy::maclow_phy_t> steady_pt_t::worksub_pcc_10(const phy::phy_maclow_t& phy_maclow) {
@@ -174,13 +187,18 @@ std::optional<phy::maclow_phy_t> steady_pt_t::worksub_pcc_10(const phy::phy_macl
         worksub_agc(phy_maclow.sync_report, *plcf_10, t_agc_tx_change_64, t_agc_rx_change_64);
     }
 
-    return worksub_pcc2pdc(
+    auto maclow_phy = worksub_pcc2pdc(
         phy_maclow,
         1,
         rd.identity_ft.NetworkID,
         0,
         phy::harq::finalize_rx_t::reset_and_terminate,
         phy::maclow_phy_handle_t(phy::handle_pcc2pdc_t::th10, rd.identity_ft.ShortRadioDeviceID));
+
+    // let the PHY pick channel estimation based on the known channel of the FT
+    maclow_phy.dispersion_hint = pt.contact_pt.dispersion_csi.get_hint();
+
+    return maclow_phy;
 }
 
 phy::maclow_phy_t steady_pt_t::worksub_pcc_20(
@@ -205,13 +223,18 @@ phy::maclow_phy_t steady_pt_t::worksub_pcc_21(const phy::phy_maclow_t& phy_maclo
     pt.contact_pt.mimo_csi.update_from_feedback(
         plcf_21->FeedbackFormat, plcf_21->feedback_info_pool, phy_maclow.sync_report);
 
-    return worksub_pcc2pdc(
+    auto maclow_phy = worksub_pcc2pdc(
         phy_maclow,
         2,
         rd.identity_ft.NetworkID,
         0,
         phy::harq::finalize_rx_t::reset_and_terminate,
         phy::maclow_phy_handle_t(phy::handle_pcc2pdc_t::th21, rd.identity_ft.ShortRadioDeviceID));
+
+    // let the PHY pick channel estimation based on the known channel of the FT
+    maclow_phy.dispersion_hint = pt.contact_pt.dispersion_csi.get_hint();
+
+    return maclow_phy;
 }
 
 phy::machigh_phy_t steady_pt_t::worksub_pdc_10(const phy::phy_machigh_t& phy_machigh) {
@@ -259,6 +282,8 @@ phy::machigh_phy_t steady_pt_t::worksub_pdc_10(const phy::phy_machigh_t& phy_mac
         rd.cqi_lut.get_highest_mcs_possible(phy_machigh.pdc_report.snr_dB),
         phy_machigh.phy_maclow.sync_report);
 
+    pt.contact_pt.dispersion_csi.update_from_phy(phy_machigh.pdc_report.dispersion_report);
+
     phy::machigh_phy_t machigh_phy;
 
     // check if we can generate any uplink
@@ -286,7 +311,7 @@ phy::machigh_phy_t steady_pt_t::worksub_pdc_21(const phy::phy_machigh_t& phy_mac
         if (const auto* mmie_child = dynamic_cast<const sp4::user_plane_data_t*>(mmie);
             mmie_child != nullptr) {
             // try submiting to application_client
-            if (worksub_mmie_user_plane_data(*mmie_child)) {
+            if (worksub_mmie_user_plane_data(*mmie_child, phy_machigh.maclow_phy.hp_rx)) {
                 ++datagram_cnt;
             }
             continue;
@@ -299,6 +324,8 @@ phy::machigh_phy_t steady_pt_t::worksub_pdc_21(const phy::phy_machigh_t& phy_mac
         rd.cqi_lut.get_highest_mcs_possible(phy_machigh.pdc_report.snr_dB),
         phy_machigh.phy_maclow.sync_report);
 
+    pt.contact_pt.dispersion_csi.update_from_phy(phy_machigh.pdc_report.dispersion_report);
+
     return phy::machigh_phy_t();
 }
 
@@ -353,9 +380,13 @@ void steady_pt_t::worksub_mmie_time_announce(
 #endif
 }
 
-bool steady_pt_t::worksub_mmie_user_plane_data(const sp4::user_plane_data_t& upd) {
-    return rd.application_client->write_nto(
-               pt.contact_pt.conn_idx_client, upd.get_data_ptr(), upd.get_data_size()) > 0;
+bool steady_pt_t::worksub_mmie_user_plane_data(const sp4::user_plane_data_t& upd,
+                                               phy::harq::process_rx_t* hp_rx) {
+    // user plane data is not copied, instead the HARQ process stays pinned until forwarded
+    return rd.application_client->write_ref_nto(pt.contact_pt.conn_idx_client,
+                                                upd.get_data_ptr(),
+                                                upd.get_data_size(),
+                                                hp_rx) > 0;
 }
 
 void steady_pt_t::worksub_mmie_resource_allocation(
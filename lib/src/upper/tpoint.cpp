@@ -46,6 +46,9 @@ tpoint_t::tpoint_t(const tpoint_config_t& tpoint_config_, phy::mac_lower_t& mac_
     dectnrp_assert(tx_order_id == 0, "radio layer expects 0 as first transmission order");
     dectnrp_assert(tx_earliest_64 <= common::adt::UNDEFINED_EARLY_64,
                    "must be negative so first transmission is guaranteed to occur later");
+
+    stats.register_metrics({{"tpoint", std::to_string(tpoint_config.id)},
+                            {"firmware", tpoint_config.firmware_name}});
 };
 
 #ifdef UPPER_TPOINT_ENABLE_WORK_PCC_ERROR
@@ -36,4 +36,18 @@ std::string tpoint_stats_t::get_as_string() const {
     return str;
 }
 
+void tpoint_stats_t::register_metrics(const metrics::labels_t& labels) const {
+    metrics::register_counter("mac_rx_pcc_success", "PCC of interest", labels, rx_pcc_success);
+    metrics::register_counter(
+        "mac_rx_pcc2pdc_success", "PDC requested for new data", labels, rx_pcc2pdc_success);
+    metrics::register_counter("mac_rx_pcc2pdc_running_success",
+                              "PDC requested for retransmission",
+                              labels,
+                              rx_pcc2pdc_running_success);
+    metrics::register_counter("mac_rx_pdc_success", "PDC processed", labels, rx_pdc_success);
+    metrics::register_counter("mac_rx_pdc_fail", "PDC with errors", labels, rx_pdc_fail);
+    metrics::register_counter("mac_rx_pdc_has_mmie", "PDC with MMIE", labels, rx_pdc_has_mmie);
+    metrics::register_counter("mac_beacon_cnt", "beacons", labels, beacon_cnt);
+}
+
 }  // namespace dectnrp::upper
@@ -176,7 +176,8 @@ int64_t tfw_txrxdelay_t::generate_packet_asap(phy::machigh_phy_t& machigh_phy) {
                                     .DAC_scale = agc_tx.get_ofdm_amplitude_factor(),
                                     .iq_phase_rad = 0.0f,
                                     .iq_phase_increment_s2s_post_resampling_rad = 0.0f,
-                                    .GI_percentage = 5};
+                                    .GI_percentage = 5,
+                                    .cacheable = true};
 
     radio::buffer_tx_meta_t buffer_tx_meta = {
         .tx_order_id = tx_order_id,
@@ -21,6 +21,7 @@
 #include "dectnrp/upper/upper.hpp"
 
 #include "dectnrp/common/prog/assert.hpp"
+#include "dectnrp/common/thread/cpu_topology.hpp"
 #include "dectnrp/limits.hpp"
 #include "dectnrp/phy/interfaces/layers_downwards/mac_lower.hpp"
 #include "dectnrp/phy/pool/token.hpp"
@@ -132,8 +133,13 @@ void upper_t::init_one_to_many(const radio::radio_t& radio_, const phy::phy_t& p
 
     // vector with all hw + worker_pool pairs
     for (uint32_t id = 0; id < phy_.get_nof_layer_unit(); ++id) {
+        const auto& worker_pool_config = phy_.phy_config.get_layer_unit_config(id);
+
+        // HARQ buffers on the NUMA node of the worker pool
+        const common::cpu_domain_scope_t cpu_domain_scope(worker_pool_config.cpu_domain);
+
         mac_lower.lower_ctrl_vec.emplace_back(radio_.get_layer_unit(id),
-                                              phy_.phy_config.get_layer_unit_config(id),
+                                              worker_pool_config,
                                               phy_.get_layer_unit(id).get_job_queue());
     }
 
@@ -181,17 +187,24 @@ void upper_t::init_one_to_one(const radio::radio_t& radio_, const phy::phy_t& ph
         // tpoint controls this hw + worker_pool pair through this interface
         phy::mac_lower_t& mac_lower = mac_lower_vec.at(t_id);
 
-        // vector with a single hw + worker_pool pair given to tpoint
-        mac_lower.lower_ctrl_vec.emplace_back(radio_.get_layer_unit(t_id),
-                                              phy_.phy_config.get_layer_unit_config(t_id),
-                                              phy_.get_layer_unit(t_id).get_job_queue());
+        const auto& worker_pool_config = phy_.phy_config.get_layer_unit_config(t_id);
 
         // load configuration of this tpoint
         const auto& tpoint_config = upper_config.get_layer_unit_config(t_id);
 
         dectnrp_assert(tpoint_config.id == t_id, "incorrect ID");
 
-        add_tpoint(tpoint_config, mac_lower);
+        // HARQ buffers and tpoint on the NUMA node of the worker pool
+        {
+            const common::cpu_domain_scope_t cpu_domain_scope(worker_pool_config.cpu_domain);
+
+            // vector with a single hw + worker_pool pair given to tpoint
+            mac_lower.lower_ctrl_vec.emplace_back(radio_.get_layer_unit(t_id),
+                                                  worker_pool_config,
+                                                  phy_.get_layer_unit(t_id).get_job_queue());
+
+            add_tpoint(tpoint_config, mac_lower);
+        }
 
         /* We give every worker pool a pointer to a unique tpoint. They also all get a new shared
          * pointer to a new token. However, they have to call the token with the same ID within